@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+# Converts PNG images into LVGL 8 C image sources (LV_IMG_CF_TRUE_COLOR_ALPHA),
+# laid out like the ones in material/ and material_46/: one pixel block per
+# LV_COLOR_DEPTH, picked at compile time. The 16 bpp blocks hold RGB565 + A8,
+# which is what a GUPPY_RGB565 build renders from.
+#
+#   ./img-convert.py material/*.png -o material
+#   ./img-convert.py --depth 16 icon.png      (RGB565 + A8 only)
+#
+# SVGs go through svg-convert.sh and rsvg-convert -f png first. The themes in
+# assets/ are packed with img-pack.py after converting.
+
+import argparse
+import os
+import re
+import sys
+
+try:
+    from PIL import Image
+except ImportError:
+    print("Pillow not installed (pip install pillow).")
+    sys.exit(1)
+
+HEADER = """#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMG_{upper}
+#define LV_ATTRIBUTE_IMG_{upper}
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_{upper} uint8_t {name}_map[] = {{
+"""
+
+FOOTER = """}};
+
+const lv_img_dsc_t {name} = {{
+  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .header.always_zero = 0,
+  .header.reserved = 0,
+  .header.w = {w},
+  .header.h = {h},
+  .data_size = {px} * LV_IMG_PX_SIZE_ALPHA_BYTE,
+  .data = {name}_map,
+}};
+"""
+
+
+def px_332(r, g, b, a):
+    return [(r & 0xe0) | ((g & 0xe0) >> 3) | (b >> 6), a]
+
+
+def px_565(r, g, b, a):
+    c = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+    return [c & 0xff, c >> 8, a]
+
+
+def px_565_swap(r, g, b, a):
+    c = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+    return [c >> 8, c & 0xff, a]
+
+
+def px_8888(r, g, b, a):
+    return [b, g, r, a]
+
+
+BLOCKS = {
+    8: [("LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8",
+         "Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit", px_332)],
+    16: [("LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0",
+          "Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit", px_565),
+         ("LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0",
+          "Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped",
+          px_565_swap)],
+    32: [("LV_COLOR_DEPTH == 32", None, px_8888)],
+}
+
+
+def convert(path, out_dir, depths):
+    name = re.sub(r"\W", "_", os.path.splitext(os.path.basename(path))[0])
+    img = Image.open(path).convert("RGBA")
+    w, h = img.size
+    pixels = list(img.getdata())
+
+    out = [HEADER.format(name=name, upper=name.upper())]
+    for depth in depths:
+        for cond, fmt, conv in BLOCKS[depth]:
+            out.append("#if {}\n".format(cond))
+            if fmt:
+                out.append("  /*Pixel format: {}*/\n".format(fmt))
+            for y in range(h):
+                row = []
+                for r, g, b, a in pixels[y * w:(y + 1) * w]:
+                    row.extend(conv(r, g, b, a))
+                out.append("  " + "".join("0x{:02x}, ".format(v) for v in row) + "\n")
+            out.append("#endif\n")
+    out.append(FOOTER.format(name=name, w=w, h=h, px=w * h))
+
+    dest = os.path.join(out_dir or os.path.dirname(path) or ".", name + ".c")
+    with open(dest, "w") as f:
+        f.write("".join(out))
+    print("{} -> {} ({}x{})".format(path, dest, w, h))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="PNG to LVGL C image converter")
+    parser.add_argument("images", nargs="+", help="PNG files")
+    parser.add_argument("-o", "--out", help="output directory, defaults to next to the image")
+    parser.add_argument("--depth", type=int, choices=[8, 16, 32], action="append",
+                        help="only emit blocks for these color depths (repeatable)")
+    args = parser.parse_args()
+
+    depths = sorted(set(args.depth)) if args.depth else [8, 16, 32]
+    for path in args.images:
+        convert(path, args.out, depths)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,448 @@
+#!/usr/bin/env python3
+# Packs LVGL images into the compressed asset format decoded by AssetStore
+# (src/asset_store.cpp). Input is either a PNG or an LVGL C image as written
+# by img-convert.py (its 32 bit block is read back). The output is a C image
+# source with the same symbol name, LV_IMG_CF_USER_ENCODED_0 and a payload of
+#
+#   'G' 'P' format 0 | b g r 0xff | LZ4 block
+#
+# format 0 is an A8 mask of a single color icon (the color is in the header),
+# format 1 is the whole image as B G R A. Monochrome icons (everything the
+# theme recolors) take a quarter of the pixels before compression.
+#
+# With --svg, icons that have a same named SVG there also carry its paths
+# (flag 1 in the byte after the format), so they can be rasterized at any
+# size on the device (icon_size in guppyconfig.json):
+#
+#   'G' 'P' format 1 | b g r 0xff | raster length (u32) | LZ4 block |
+#   name length (u8) | name | path program
+#
+# The path program is the SVG's <path> elements with everything turned into
+# absolute M/L/Q/C/Z, little endian:
+#
+#   viewBox x y w h (f32) | path count (u16) |
+#   per path: fill rule (u8, 1 = evenodd) | r g b a (u8) |
+#             command count (u16) | coordinate count (u16) |
+#             commands (u8) | coordinates (f32)
+#
+#   ./img-pack.py material/*.c                (in place)
+#   ./img-pack.py --svg material_svg material/*.c
+#   ./img-pack.py icon.png -o material
+
+import argparse
+import os
+import re
+import struct
+import sys
+import xml.etree.ElementTree as ET
+
+MAGIC = b"GP"
+FORMAT_A8 = 0
+FORMAT_ARGB = 1
+FLAG_VECTOR = 1
+
+HEADER = """#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMG_{upper}
+#define LV_ATTRIBUTE_IMG_{upper}
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_{upper} uint8_t {name}_map[] = {{
+  /*Packed: {desc}, {raw} bytes LZ4 compressed*/
+"""
+
+FOOTER = """}};
+
+const lv_img_dsc_t {name} = {{
+  .header.cf = LV_IMG_CF_USER_ENCODED_0,
+  .header.always_zero = 0,
+  .header.reserved = 0,
+  .header.w = {w},
+  .header.h = {h},
+  .data_size = {size},
+  .data = {name}_map,
+}};
+"""
+
+MIN_MATCH = 4
+LAST_LITERALS = 5
+MF_LIMIT = 12
+MAX_OFFSET = 65535
+
+
+def lz4_length(n):
+    out = bytearray()
+    while n >= 255:
+        out.append(255)
+        n -= 255
+    out.append(n)
+    return out
+
+
+def lz4_compress(src):
+    """LZ4 block format, greedy matching on a 4 byte hash of every position."""
+    n = len(src)
+    out = bytearray()
+    table = {}
+    anchor = 0
+    i = 0
+
+    def sequence(lit_end, offset, match):
+        lit = lit_end - anchor
+        token = (min(lit, 15) << 4) | (min(match - MIN_MATCH, 15) if match else 0)
+        out.append(token)
+        if lit >= 15:
+            out.extend(lz4_length(lit - 15))
+        out.extend(src[anchor:lit_end])
+        if match:
+            out.extend((offset & 0xff, offset >> 8))
+            if match - MIN_MATCH >= 15:
+                out.extend(lz4_length(match - MIN_MATCH - 15))
+
+    while i + MF_LIMIT <= n:
+        key = src[i:i + MIN_MATCH]
+        ref = table.get(key)
+        table[key] = i
+        if ref is None or i - ref > MAX_OFFSET:
+            i += 1
+            continue
+
+        match = MIN_MATCH
+        while i + match < n - LAST_LITERALS and src[ref + match] == src[i + match]:
+            match += 1
+
+        sequence(i, i - ref, match)
+        i += match
+        anchor = i
+
+    sequence(n, 0, 0)
+    return bytes(out)
+
+
+def lz4_decompress(src, size):
+    out = bytearray()
+    i = 0
+    while i < len(src):
+        token = src[i]
+        i += 1
+        lit = token >> 4
+        if lit == 15:
+            while True:
+                lit += src[i]
+                i += 1
+                if src[i - 1] != 255:
+                    break
+        out.extend(src[i:i + lit])
+        i += lit
+        if i >= len(src):
+            break
+        offset = src[i] | (src[i + 1] << 8)
+        i += 2
+        match = token & 15
+        if match == 15:
+            while True:
+                match += src[i]
+                i += 1
+                if src[i - 1] != 255:
+                    break
+        match += MIN_MATCH
+        for _ in range(match):
+            out.append(out[-offset])
+    assert len(out) == size
+    return bytes(out)
+
+
+def read_c(path):
+    """B G R A pixels of the 32 bit block of an LVGL C image"""
+    with open(path) as f:
+        s = f.read()
+    block = re.search(r"#if LV_COLOR_DEPTH == 32\n(.*?)#endif", s, re.S)
+    w = re.search(r"\.header\.w = (\d+)", s)
+    h = re.search(r"\.header\.h = (\d+)", s)
+    if not block or not w or not h or "LV_IMG_CF_TRUE_COLOR_ALPHA" not in s:
+        return None
+    data = bytes(int(v, 16) for v in re.findall(r"0x([0-9a-fA-F]{2})", block.group(1)))
+    w, h = int(w.group(1)), int(h.group(1))
+    if len(data) != w * h * 4:
+        return None
+    return w, h, data
+
+
+def read_packed(path):
+    """B G R A pixels of an image this script packed before"""
+    with open(path) as f:
+        s = f.read()
+    block = re.search(r"_map\[\] = \{(.*?)\};", s, re.S)
+    w = re.search(r"\.header\.w = (\d+)", s)
+    h = re.search(r"\.header\.h = (\d+)", s)
+    if not block or not w or not h or "LV_IMG_CF_USER_ENCODED_0" not in s:
+        return None
+    hexdump = re.sub(r"/\*.*?\*/", "", block.group(1))
+    p = bytes(int(v, 16) for v in re.findall(r"0x([0-9a-fA-F]{2})", hexdump))
+    w, h = int(w.group(1)), int(h.group(1))
+    if p[:2] != MAGIC:
+        return None
+
+    body = p[8:]
+    if p[3] & FLAG_VECTOR:
+        n = struct.unpack("<I", body[:4])[0]
+        body = body[4:4 + n]
+    if p[2] == FORMAT_A8:
+        data = bytearray()
+        for a in lz4_decompress(body, w * h):
+            data.extend((p[4], p[5], p[6], a))
+        return w, h, bytes(data)
+    return w, h, lz4_decompress(body, w * h * 4)
+
+
+def read_png(path):
+    try:
+        from PIL import Image
+    except ImportError:
+        print("Pillow not installed (pip install pillow).")
+        sys.exit(1)
+    img = Image.open(path).convert("RGBA")
+    w, h = img.size
+    data = bytearray()
+    for r, g, b, a in img.getdata():
+        data.extend((b, g, r, a))
+    return w, h, bytes(data)
+
+
+def mono_color(data, tolerance):
+    """the color of a single color icon, None if it has more than one.
+    anti-aliased edges come out of rsvg a step off (0xfefefe on white)."""
+    counts = {}
+    for i in range(0, len(data), 4):
+        if data[i + 3]:
+            c = data[i:i + 3]
+            counts[c] = counts.get(c, 0) + 1
+    if not counts:
+        return b"\xff\xff\xff"
+    color = max(counts, key=counts.get)
+    for c in counts:
+        if any(abs(c[k] - color[k]) > tolerance for k in range(3)):
+            return None
+    return color
+
+
+PATH_TOKEN = re.compile(r"[MmLlHhVvCcSsQqTtAaZz]|[-+]?(?:\d*\.\d+|\d+\.?)(?:[eE][-+]?\d+)?")
+PATH_ARGS = {"M": 2, "L": 2, "H": 1, "V": 1, "C": 6, "S": 4, "Q": 4, "T": 2, "A": 7, "Z": 0}
+
+
+def parse_path(d):
+    """SVG path data as absolute (command, coordinates) pairs of M L Q C Z"""
+    tokens = PATH_TOKEN.findall(d)
+    out = []
+    i = 0
+    cmd = None
+    x = y = sx = sy = 0.0
+    ctrl = None  # last control point, for S and T
+    while i < len(tokens):
+        if tokens[i].isalpha():
+            cmd = tokens[i]
+            i += 1
+        elif cmd is None or cmd in "Zz":
+            raise ValueError("coordinates without a command")
+        up = cmd.upper()
+        rel = cmd != up
+        n = PATH_ARGS[up]
+        args = [float(v) for v in tokens[i:i + n]]
+        if len(args) != n:
+            raise ValueError("path data ends early")
+        i += n
+        ox, oy = (x, y) if rel else (0.0, 0.0)
+
+        if up == "M":
+            x, y = ox + args[0], oy + args[1]
+            sx, sy = x, y
+            out.append(("M", [x, y]))
+            ctrl = None
+            # further pairs are lines
+            cmd = "l" if rel else "L"
+        elif up in "LHV":
+            if up == "L":
+                x, y = ox + args[0], oy + args[1]
+            elif up == "H":
+                x = ox + args[0]
+            else:
+                y = oy + args[0]
+            out.append(("L", [x, y]))
+            ctrl = None
+        elif up in "CS":
+            if up == "C":
+                c1 = [ox + args[0], oy + args[1]]
+                rest = args[2:]
+            else:
+                c1 = [2 * x - ctrl[0], 2 * y - ctrl[1]] if ctrl and ctrl[2] == "C" else [x, y]
+                rest = args
+            c2 = [ox + rest[0], oy + rest[1]]
+            x, y = ox + rest[2], oy + rest[3]
+            out.append(("C", c1 + c2 + [x, y]))
+            ctrl = (c2[0], c2[1], "C")
+        elif up in "QT":
+            if up == "Q":
+                c = [ox + args[0], oy + args[1]]
+                end = args[2:]
+            else:
+                c = [2 * x - ctrl[0], 2 * y - ctrl[1]] if ctrl and ctrl[2] == "Q" else [x, y]
+                end = args
+            x, y = ox + end[0], oy + end[1]
+            out.append(("Q", c + [x, y]))
+            ctrl = (c[0], c[1], "Q")
+        elif up == "A":
+            # not used by the icon sets, drawn as a straight line
+            print("  arc drawn as a line")
+            x, y = ox + args[5], oy + args[6]
+            out.append(("L", [x, y]))
+            ctrl = None
+        else:
+            out.append(("Z", []))
+            x, y = sx, sy
+            ctrl = None
+    return out
+
+
+def parse_color(v):
+    v = v.strip().lower()
+    if v.startswith("#"):
+        h = v[1:]
+        if len(h) == 3:
+            h = "".join(c * 2 for c in h)
+        return tuple(int(h[k:k + 2], 16) for k in (0, 2, 4))
+    m = re.match(r"rgb\(([^)]*)\)", v)
+    if m:
+        out = []
+        for c in m.group(1).split(","):
+            c = c.strip()
+            out.append(round(float(c[:-1]) * 2.55) if c.endswith("%") else int(c))
+        return tuple(out)
+    return {"white": (255, 255, 255), "black": (0, 0, 0)}.get(v)
+
+
+def read_svg(path):
+    """the path program of an SVG, None if it uses what we can't draw"""
+    root = ET.parse(path).getroot()
+    vb = [float(v) for v in re.split(r"[\s,]+", root.get("viewBox", "").strip()) if v]
+    if len(vb) != 4:
+        vb = [0.0, 0.0, float(root.get("width", "0").rstrip("px")),
+              float(root.get("height", "0").rstrip("px"))]
+
+    out = bytearray(struct.pack("<4f", *vb))
+    paths = []
+    for el in root.iter():
+        if el.get("transform") is not None:
+            print("{}: transforms aren't supported".format(path))
+            return None
+        if el.tag.split("}")[-1] != "path":
+            continue
+
+        style = dict(el.attrib)
+        for kv in el.get("style", "").split(";"):
+            if ":" in kv:
+                k, v = kv.split(":", 1)
+                style[k.strip()] = v.strip()
+        if style.get("fill", "black") == "none":
+            continue
+        color = parse_color(style.get("fill", "black"))
+        if color is None:
+            print("{}: unknown fill {}".format(path, style.get("fill")))
+            return None
+        if color == (0, 0, 0):
+            # as svg-convert.sh does, the icons are drawn white
+            color = (255, 255, 255)
+        alpha = float(style.get("fill-opacity", "1")) * float(style.get("opacity", "1"))
+        evenodd = style.get("fill-rule", "nonzero") == "evenodd"
+
+        cmds = parse_path(el.get("d", ""))
+        coords = [c for _, args in cmds for c in args]
+        paths.append(struct.pack("<B4BHH", evenodd, color[0], color[1], color[2],
+                                 round(alpha * 255), len(cmds), len(coords))
+                     + bytes(ord(c) for c, _ in cmds)
+                     + struct.pack("<{}f".format(len(coords)), *coords))
+
+    out += struct.pack("<H", len(paths))
+    for p in paths:
+        out += p
+    return bytes(out)
+
+
+def pack(path, out_dir, tolerance, svg_dir):
+    name = re.sub(r"\W", "_", os.path.splitext(os.path.basename(path))[0])
+    img = read_png(path) if path.lower().endswith(".png") else read_c(path) or read_packed(path)
+    if img is None:
+        print("{}: not a true color alpha image, skipped".format(path))
+        return
+    w, h, data = img
+
+    color = mono_color(data, tolerance)
+    if color is not None:
+        fmt = FORMAT_A8
+        raw = data[3::4]
+        desc = "A8 mask, color 0x{:02x}{:02x}{:02x}".format(color[2], color[1], color[0])
+    else:
+        fmt = FORMAT_ARGB
+        raw = data
+        color = b"\x00\x00\x00"
+        desc = "ARGB8888"
+
+    body = lz4_compress(raw)
+    assert lz4_decompress(body, len(raw)) == raw
+
+    vector = None
+    svg = os.path.join(svg_dir, name + ".svg") if svg_dir else None
+    if svg and os.path.exists(svg):
+        vector = read_svg(svg)
+
+    if vector is not None:
+        payload = (MAGIC + bytes((fmt, FLAG_VECTOR)) + color + b"\xff"
+                   + struct.pack("<I", len(body)) + body
+                   + bytes((len(name),)) + name.encode() + vector)
+        desc += " + vector"
+    else:
+        payload = MAGIC + bytes((fmt, 0)) + color + b"\xff" + body
+
+    out = [HEADER.format(name=name, upper=name.upper(), desc=desc, raw=len(raw))]
+    for i in range(0, len(payload), 32):
+        out.append("  " + "".join("0x{:02x}, ".format(v) for v in payload[i:i + 32]) + "\n")
+    out.append(FOOTER.format(name=name, w=w, h=h, size=len(payload)))
+
+    dest = os.path.join(out_dir or os.path.dirname(path) or ".", name + ".c")
+    with open(dest, "w") as f:
+        f.write("".join(out))
+    print("{} -> {} ({}x{}, {}, {} -> {} bytes)".format(
+        path, dest, w, h, "A8" if fmt == FORMAT_A8 else "ARGB", w * h * 4, len(payload)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="LVGL image to packed asset converter")
+    parser.add_argument("images", nargs="+", help="PNG files or LVGL C images")
+    parser.add_argument("-o", "--out", help="output directory, defaults to next to the image")
+    parser.add_argument("--tolerance", type=int, default=2,
+                        help="max channel difference for an icon to count as single color")
+    parser.add_argument("--svg", help="directory with the icons' SVG sources")
+    args = parser.parse_args()
+
+    for path in args.images:
+        pack(path, args.out, args.tolerance, args.svg)
+
+
+if __name__ == "__main__":
+    main()
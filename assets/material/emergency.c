@@ -22,281 +22,136 @@
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_EMERGENCY uint8_t emergency_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x18, 0xc5, 0x5a, 0xc5, 0x91, 0xc5, 0xb9, 0xc5, 0xdb, 0xc5, 0xee, 0xc5, 0xfa, 0xc5, 0xfa, 0xc5, 0xee, 0xc5, 0xdb, 0xc5, 0xb9, 0xc5, 0x91, 0xc5, 0x59, 0xc5, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x0a, 0xe5, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x13, 0xc5, 0x6e, 0xc5, 0xcb, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xca, 0xc5, 0x6d, 0xc5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x62, 0xc5, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x04, 0xc5, 0xb4, 0xc5, 0xff, 0xc5, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x1c, 0xc5, 0x90, 0xc5, 0xf5, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf4, 0xc5, 0x8f, 0xc5, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x80, 0xc5, 0xff, 0xc5, 0xb3, 0xc9, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x9c, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x05, 0xc5, 0x78, 0xc5, 0xf4, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf4, 0xc5, 0x76, 0xc9, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x80, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x62, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xdc, 0xe5, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x27, 0xc5, 0xd0, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xcf, 0xe5, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x0d, 0xc5, 0xdd, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x2a, 0xc5, 0xf4, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xe8, 0xc5, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x53, 0xc5, 0xf3, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xe5, 0xc5, 0xab, 0xc5, 0x84, 0xc5, 0x67, 0xc5, 0x5a, 0xc5, 0x5a, 0xc5, 0x67, 0xc5, 0x85, 0xc5, 0xac, 0xc5, 0xe6, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf2, 0xc5, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x24, 0xc5, 0xe9, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf4, 0xc5, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x03, 0xc5, 0xcb, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf9, 0xe5, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x68, 0xc5, 0xfc, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xe4, 0xc5, 0x84, 0xc5, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x2c, 0xc5, 0x85, 0xc5, 0xe5, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfc, 0xc5, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x38, 0xc5, 0xfa, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xc9, 0xe0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x69, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x68, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xe4, 0xc5, 0x64, 0xe5, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x07, 0xc5, 0x66, 0xc5, 0xe6, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x73, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x15, 0xc5, 0xee, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xb8, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x53, 0xc5, 0xfc, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfe, 0xc5, 0x94, 0xe5, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x0e, 0xc5, 0x96, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfc, 0xc5, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xc5, 0xba, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xec, 0xe5, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x86, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf7, 0xc5, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x27, 0xc5, 0xf3, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf3, 0xc5, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x54, 0xc5, 0xf4, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf2, 0xc5, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x25, 0xc5, 0xf8, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xc5, 0x0f, 0xc5, 0xf0, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x06, 0xc5, 0xd0, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xec, 0xc5, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x39, 0xc5, 0x55, 0xc5, 0x55, 0xc5, 0x55, 0xc5, 0x55, 0xc5, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x38, 0xc5, 0xed, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xce, 0xc9, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x83, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xef, 0xc5, 0x0e, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xc5, 0x76, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xee, 0xc5, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x78, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf3, 0xc5, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xaa, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x38, 0xc5, 0xf4, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x10, 0xc5, 0xf0, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x75, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xc5, 0xd8, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x1b, 0xc5, 0xf4, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfe, 0xc5, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xaa, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x53, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf3, 0xc5, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x84, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xd6, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xe5, 0x37, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfa, 0xe5, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x90, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xaa, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x96, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x18, 0xc5, 0xfb, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x34, 0x00, 0x00, 
-  0x00, 0x00, 0xc5, 0x90, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x13, 0xc5, 0xf5, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xe4, 0xe5, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xaa, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x0e, 0xc5, 0xe6, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf4, 0xc5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xb5, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x8d, 0x00, 0x00, 
-  0x00, 0x00, 0xc5, 0xd5, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x6d, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xaa, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x66, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x58, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xd1, 0x00, 0x00, 
-  0xe5, 0x17, 0xc5, 0xfe, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfc, 0xc5, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xcb, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xe4, 0xe5, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xaa, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x07, 0xc5, 0xe4, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x12, 0xc5, 0xfd, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfe, 0xc5, 0x15, 
-  0xc5, 0x55, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x19, 0xc5, 0xfe, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xaa, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x86, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfe, 0xe5, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xcc, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x53, 
-  0xc5, 0x80, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x59, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xaa, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x2d, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xe5, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x8f, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x7e, 
-  0xc5, 0xa6, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x91, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xaa, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xc5, 0xe6, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x66, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xa4, 
-  0xc5, 0xcc, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xe5, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xb9, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xaa, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xad, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x3f, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xca, 
-  0xc5, 0xe0, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xdd, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xaa, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x85, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x21, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xde, 
-  0xc5, 0xec, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xed, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xaa, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x69, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x14, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xeb, 
-  0xc5, 0xf9, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xe5, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf9, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xaa, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x5c, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x07, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf8, 
-  0xc5, 0xf9, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xe5, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf9, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xaa, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x5c, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x07, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf8, 
-  0xc5, 0xec, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xed, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xaa, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x69, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x14, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xeb, 
-  0xc5, 0xe0, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xdc, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x72, 0xc5, 0xaa, 0xc5, 0xaa, 0xc5, 0xaa, 0xc5, 0xaa, 0xe5, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x86, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x21, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xde, 
-  0xc5, 0xcc, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xe5, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xb8, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xad, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x3f, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xca, 
-  0xc5, 0xa6, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x91, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xc5, 0xe7, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x66, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xa4, 
-  0xc5, 0x7f, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x59, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xe5, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x2e, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x8f, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x7d, 
-  0xc5, 0x54, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x18, 0xc5, 0xfe, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x87, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfe, 0xe5, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xcc, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xe5, 0x52, 
-  0xe5, 0x17, 0xc5, 0xfe, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfc, 0xc5, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xca, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xe5, 0xe5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x07, 0xc5, 0xe5, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x12, 0xc5, 0xfd, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfe, 0xc5, 0x15, 
-  0x00, 0x00, 0xc5, 0xd4, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x6d, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xaa, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x68, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x58, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xd0, 0x00, 0x00, 
-  0x00, 0x00, 0xc5, 0x8f, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x13, 0xc5, 0xf4, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xe6, 0xc5, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xaa, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x0f, 0xc5, 0xe7, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf4, 0xc5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xb5, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x8b, 0x00, 0x00, 
-  0x00, 0x00, 0xc5, 0x36, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfa, 0xe5, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x8f, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xaa, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x99, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x17, 0xc5, 0xfb, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x33, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xc5, 0xd7, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x1b, 0xc5, 0xf4, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xaa, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x56, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf2, 0xc5, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x84, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xd5, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xc5, 0x76, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xef, 0xc5, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x76, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf4, 0xc5, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xaa, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x39, 0xc5, 0xf5, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x10, 0xc5, 0xf0, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x75, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xc5, 0x0f, 0xc5, 0xef, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x05, 0xc5, 0xce, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xed, 0xc5, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x39, 0xc5, 0x55, 0xc5, 0x55, 0xc5, 0x55, 0xc5, 0x55, 0xc5, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x39, 0xc5, 0xed, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xcd, 0xc9, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x84, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xee, 0xc5, 0x0e, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x84, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf7, 0xc5, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x26, 0xc5, 0xf2, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf4, 0xc5, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x56, 0xc5, 0xf5, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf1, 0xc5, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x25, 0xc5, 0xf8, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x13, 0xc5, 0xed, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xb9, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x51, 0xc5, 0xfc, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x96, 0xc5, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x0f, 0xc5, 0x99, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfc, 0xc5, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xc5, 0xbb, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xeb, 0xe5, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x67, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xe5, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x66, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xe6, 0xc5, 0x66, 0xe5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x07, 0xc5, 0x69, 0xc5, 0xe7, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfe, 0xc5, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x74, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x02, 0xc5, 0xca, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfa, 0xc5, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x66, 0xc5, 0xfc, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xe5, 0xc5, 0x86, 0xe5, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x2e, 0xc5, 0x87, 0xc5, 0xe6, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfc, 0xc5, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x3a, 0xc5, 0xfa, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xc8, 0xe0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x28, 0xc5, 0xf4, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xe9, 0xc5, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x50, 0xc5, 0xf2, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xe7, 0xc5, 0xad, 0xc5, 0x86, 0xc5, 0x68, 0xc5, 0x5b, 0xc5, 0x5b, 0xc5, 0x68, 0xc5, 0x86, 0xc5, 0xad, 0xc5, 0xe7, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf1, 0xc5, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x25, 0xc5, 0xea, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf3, 0xe5, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x5f, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xdd, 0xe5, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x25, 0xc5, 0xce, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xcd, 0xc5, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x0d, 0xc5, 0xdd, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x9a, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x05, 0xc5, 0x75, 0xc5, 0xf3, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf2, 0xc5, 0x73, 0xc9, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x80, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x04, 0xc5, 0xb3, 0xc5, 0xff, 0xc5, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x19, 0xc5, 0x8e, 0xc5, 0xf4, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf4, 0xc5, 0x8d, 0xc5, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x80, 0xc5, 0xff, 0xc5, 0xb2, 0xa0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x0a, 0xe5, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x13, 0xc5, 0x6c, 0xc5, 0xc8, 0xc5, 0xfe, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfe, 0xc5, 0xc7, 0xc5, 0x6b, 0xe5, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x62, 0xc5, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x16, 0xe5, 0x57, 0xc5, 0x8f, 0xc5, 0xb7, 0xc5, 0xd8, 0xc5, 0xed, 0xc5, 0xf9, 0xc5, 0xf9, 0xc5, 0xed, 0xc5, 0xd8, 0xc5, 0xb7, 0xc5, 0x8f, 0xe5, 0x57, 0xe5, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xc9, 0x18, 0x25, 0xd1, 0x5a, 0x05, 0xd1, 0x91, 0x05, 0xd1, 0xb9, 0x05, 0xd1, 0xdb, 0x05, 0xd1, 0xee, 0x05, 0xd1, 0xfa, 0x05, 0xd1, 0xfa, 0x05, 0xd1, 0xee, 0x05, 0xd1, 0xdb, 0x05, 0xd1, 0xb9, 0x05, 0xd1, 0x91, 0x25, 0xd1, 0x59, 0x05, 0xc9, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xd0, 0x0a, 0x05, 0xd1, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xc8, 0x13, 0x05, 0xd1, 0x6e, 0x05, 0xd1, 0xcb, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xca, 0x05, 0xd1, 0x6d, 0xe5, 0xc8, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x62, 0xc6, 0xd0, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc2, 0x04, 0x05, 0xd1, 0xb4, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x1c, 0x05, 0xd1, 0x90, 0x05, 0xd1, 0xf5, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf4, 0x05, 0xd1, 0x8f, 0xe5, 0xd0, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x80, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xb3, 0x08, 0xc2, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x9c, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xd1, 0x05, 0x25, 0xd1, 0x78, 0x05, 0xd1, 0xf4, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf4, 0x05, 0xd1, 0x76, 0xa6, 0xd1, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x80, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x62, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xdc, 0x65, 0xd9, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x27, 0x05, 0xd1, 0xd0, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xcf, 0x05, 0xd1, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xd9, 0x0d, 0x05, 0xd1, 0xdd, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x2a, 0x05, 0xd1, 0xf4, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xe8, 0x25, 0xd1, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x53, 0x05, 0xd1, 0xf3, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xe5, 0x05, 0xd1, 0xab, 0x05, 0xd1, 0x84, 0x05, 0xd1, 0x67, 0x25, 0xd1, 0x5a, 0x25, 0xd1, 0x5a, 0x05, 0xd1, 0x67, 0x05, 0xd1, 0x85, 0x05, 0xd1, 0xac, 0x05, 0xd1, 0xe6, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf2, 0x05, 0xd1, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x24, 0x05, 0xd1, 0xe9, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf4, 0x05, 0xd1, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x03, 0x05, 0xd1, 0xcb, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf9, 0x05, 0xd1, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x68, 0x05, 0xd1, 0xfc, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xe4, 0x05, 0xd1, 0x84, 0x05, 0xd1, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x2c, 0x05, 0xd1, 0x85, 0x05, 0xd1, 0xe5, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfc, 0x05, 0xd1, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x38, 0x05, 0xd1, 0xfa, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xc9, 0x00, 0xf8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x69, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x68, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xe4, 0x05, 0xd1, 0x64, 0x65, 0xd9, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd9, 0x07, 0x05, 0xd1, 0x66, 0x05, 0xd1, 0xe6, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x73, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x15, 0x05, 0xd1, 0xee, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xb8, 0x00, 0xf8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x53, 0x05, 0xd1, 0xfc, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfe, 0x05, 0xd1, 0x94, 0x45, 0xd9, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xc9, 0x0e, 0x05, 0xd1, 0x96, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfc, 0x05, 0xd1, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x05, 0xd1, 0xba, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xec, 0xe5, 0xd8, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x86, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf7, 0x25, 0xd1, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x27, 0x05, 0xd1, 0xf3, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf3, 0x05, 0xd1, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x54, 0x05, 0xd1, 0xf4, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf2, 0x25, 0xd1, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x25, 0x05, 0xd1, 0xf8, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xd1, 0x0f, 0x05, 0xd1, 0xf0, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xd9, 0x06, 0x05, 0xd1, 0xd0, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xec, 0x05, 0xd1, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x39, 0x05, 0xd1, 0x55, 0x05, 0xd1, 0x55, 0x05, 0xd1, 0x55, 0x05, 0xd1, 0x55, 0x05, 0xd1, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x38, 0x05, 0xd1, 0xed, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xce, 0xa6, 0xd1, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x83, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xef, 0x25, 0xc9, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x76, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xee, 0x25, 0xc9, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x78, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf3, 0x05, 0xd1, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x38, 0x05, 0xd1, 0xf4, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xd1, 0x10, 0x05, 0xd1, 0xf0, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xd8, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xd0, 0x1b, 0x05, 0xd1, 0xf4, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfe, 0x05, 0xd1, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x53, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf3, 0x05, 0xd1, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x84, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0xd1, 0x37, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfa, 0x26, 0xd1, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x90, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x96, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xc9, 0x18, 0x05, 0xd1, 0xfb, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x25, 0xd1, 0x34, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0xd1, 0x90, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xc8, 0x13, 0x05, 0xd1, 0xf5, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xe4, 0x45, 0xd9, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xc9, 0x0e, 0x05, 0xd1, 0xe6, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf4, 0xe5, 0xc8, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xb5, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x8d, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0xd1, 0xd5, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x6d, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x66, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x58, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xd1, 0x00, 0x00, 0x00, 
-  0x06, 0xd1, 0x17, 0x05, 0xd1, 0xfe, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfc, 0x06, 0xd1, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xcb, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xe4, 0x65, 0xd9, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd9, 0x07, 0x05, 0xd1, 0xe4, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xd8, 0x12, 0x05, 0xd1, 0xfd, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfe, 0x25, 0xd1, 0x15, 
-  0x05, 0xd1, 0x55, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x19, 0x05, 0xd1, 0xfe, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x86, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfe, 0x26, 0xd1, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xcc, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x53, 
-  0x05, 0xd1, 0x80, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x59, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x2d, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x8f, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x7e, 
-  0x05, 0xd1, 0xa6, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x91, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x05, 0xd1, 0xe6, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x66, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xa4, 
-  0x05, 0xd1, 0xcc, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xb9, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xad, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x3f, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xca, 
-  0x05, 0xd1, 0xe0, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xdd, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x85, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x21, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xde, 
-  0x05, 0xd1, 0xec, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0xe5, 0xc8, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xed, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x69, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xd1, 0x14, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xeb, 
-  0x05, 0xd1, 0xf9, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x65, 0xd9, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xf9, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x5c, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd9, 0x07, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf8, 
-  0x05, 0xd1, 0xf9, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x65, 0xd9, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xf9, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x5c, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd9, 0x07, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf8, 
-  0x05, 0xd1, 0xec, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0xe5, 0xc8, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xed, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x69, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xd1, 0x14, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xeb, 
-  0x05, 0xd1, 0xe0, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xdc, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x72, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x86, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x21, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xde, 
-  0x05, 0xd1, 0xcc, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xb8, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xad, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x3f, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xca, 
-  0x05, 0xd1, 0xa6, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x91, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x05, 0xd1, 0xe7, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x66, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xa4, 
-  0x05, 0xd1, 0x7f, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x59, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x25, 0xd1, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x2e, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x8f, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x7d, 
-  0x05, 0xd1, 0x54, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xc9, 0x18, 0x05, 0xd1, 0xfe, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x87, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfe, 0x26, 0xd1, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xcc, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x25, 0xd1, 0x52, 
-  0x06, 0xd1, 0x17, 0x05, 0xd1, 0xfe, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfc, 0x06, 0xd1, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xca, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xe5, 0x25, 0xd9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd9, 0x07, 0x05, 0xd1, 0xe5, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xd8, 0x12, 0x05, 0xd1, 0xfd, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfe, 0x25, 0xd1, 0x15, 
-  0x00, 0x00, 0x00, 0x05, 0xd1, 0xd4, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x6d, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x68, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x58, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xd0, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0xd1, 0x8f, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xc8, 0x13, 0x05, 0xd1, 0xf4, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xe6, 0x25, 0xc9, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xd1, 0x0f, 0x05, 0xd1, 0xe7, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf4, 0xe5, 0xc8, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xb5, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x8b, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0xd1, 0x36, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfa, 0x26, 0xd1, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x8f, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x99, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xd1, 0x17, 0x05, 0xd1, 0xfb, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x25, 0xd1, 0x33, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xd7, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xd0, 0x1b, 0x05, 0xd1, 0xf4, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x56, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf2, 0x05, 0xc9, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x84, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x76, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xef, 0x25, 0xc9, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x76, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf4, 0x05, 0xd1, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x39, 0x05, 0xd1, 0xf5, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xd1, 0x10, 0x05, 0xd1, 0xf0, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xd1, 0x0f, 0x05, 0xd1, 0xef, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xd1, 0x05, 0x05, 0xd1, 0xce, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xed, 0x05, 0xd1, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x39, 0x05, 0xd1, 0x55, 0x05, 0xd1, 0x55, 0x05, 0xd1, 0x55, 0x05, 0xd1, 0x55, 0x05, 0xd1, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x39, 0x05, 0xd1, 0xed, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xcd, 0xa6, 0xd1, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x84, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xee, 0x25, 0xc9, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x84, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf7, 0x25, 0xd1, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x26, 0x05, 0xd1, 0xf2, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf4, 0x05, 0xd1, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x56, 0x05, 0xd1, 0xf5, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf1, 0x25, 0xd1, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x25, 0x05, 0xd1, 0xf8, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xc8, 0x13, 0x05, 0xd1, 0xed, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xb9, 0x00, 0xf8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x51, 0x05, 0xd1, 0xfc, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x96, 0x25, 0xc9, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xd1, 0x0f, 0x05, 0xd1, 0x99, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfc, 0x05, 0xd1, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x05, 0xd1, 0xbb, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xeb, 0x06, 0xd1, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x67, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x66, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xe6, 0x05, 0xd1, 0x66, 0x25, 0xd9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd9, 0x07, 0x25, 0xd1, 0x69, 0x05, 0xd1, 0xe7, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfe, 0x05, 0xd1, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x74, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x02, 0x05, 0xd1, 0xca, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfa, 0x05, 0xd1, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x66, 0x05, 0xd1, 0xfc, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xe5, 0x05, 0xd1, 0x86, 0x25, 0xd1, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x2e, 0x05, 0xd1, 0x87, 0x05, 0xd1, 0xe6, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfc, 0x05, 0xd1, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x3a, 0x05, 0xd1, 0xfa, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xc8, 0x00, 0xf8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x28, 0x05, 0xd1, 0xf4, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xe9, 0x25, 0xd1, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x50, 0x05, 0xd1, 0xf2, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xe7, 0x05, 0xd1, 0xad, 0x05, 0xd1, 0x86, 0x05, 0xd1, 0x68, 0x05, 0xd1, 0x5b, 0x05, 0xd1, 0x5b, 0x05, 0xd1, 0x68, 0x05, 0xd1, 0x86, 0x05, 0xd1, 0xad, 0x05, 0xd1, 0xe7, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf1, 0x05, 0xd1, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x25, 0x05, 0xd1, 0xea, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf3, 0x05, 0xd1, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x5f, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xdd, 0x45, 0xd9, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x25, 0x05, 0xd1, 0xce, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xcd, 0x25, 0xd1, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xd9, 0x0d, 0x05, 0xd1, 0xdd, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x9a, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xd1, 0x05, 0x05, 0xd1, 0x75, 0x05, 0xd1, 0xf3, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf2, 0x05, 0xd1, 0x73, 0xa6, 0xd1, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x80, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc2, 0x04, 0x05, 0xd1, 0xb3, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x19, 0x05, 0xd1, 0x8e, 0x05, 0xd1, 0xf4, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf4, 0x05, 0xd1, 0x8d, 0x05, 0xc9, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x80, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xb2, 0x00, 0xa8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xd0, 0x0a, 0x05, 0xd1, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xc8, 0x13, 0x05, 0xd1, 0x6c, 0x05, 0xd1, 0xc8, 0x05, 0xd1, 0xfe, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfe, 0x05, 0xd1, 0xc7, 0x05, 0xd1, 0x6b, 0xe5, 0xd8, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x62, 0xc6, 0xd0, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xd1, 0x16, 0x05, 0xd1, 0x57, 0x05, 0xd1, 0x8f, 0x05, 0xd1, 0xb7, 0x05, 0xd1, 0xd8, 0x05, 0xd1, 0xed, 0x05, 0xd1, 0xf9, 0x05, 0xd1, 0xf9, 0x05, 0xd1, 0xed, 0x05, 0xd1, 0xd8, 0x05, 0xd1, 0xb7, 0x05, 0xd1, 0x8f, 0x05, 0xd1, 0x57, 0x26, 0xd1, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x05, 0x18, 0xd1, 0x25, 0x5a, 0xd1, 0x05, 0x91, 0xd1, 0x05, 0xb9, 0xd1, 0x05, 0xdb, 0xd1, 0x05, 0xee, 0xd1, 0x05, 0xfa, 0xd1, 0x05, 0xfa, 0xd1, 0x05, 0xee, 0xd1, 0x05, 0xdb, 0xd1, 0x05, 0xb9, 0xd1, 0x05, 0x91, 0xd1, 0x25, 0x59, 0xc9, 0x05, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xc6, 0x0a, 0xd1, 0x05, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xe5, 0x13, 0xd1, 0x05, 0x6e, 0xd1, 0x05, 0xcb, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xca, 0xd1, 0x05, 0x6d, 0xc8, 0xe5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x62, 0xd0, 0xc6, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x08, 0x04, 0xd1, 0x05, 0xb4, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x1c, 0xd1, 0x05, 0x90, 0xd1, 0x05, 0xf5, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf4, 0xd1, 0x05, 0x8f, 0xd0, 0xe5, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x80, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xb3, 0xc2, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x9c, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xa6, 0x05, 0xd1, 0x25, 0x78, 0xd1, 0x05, 0xf4, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf4, 0xd1, 0x05, 0x76, 0xd1, 0xa6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x80, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x62, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xdc, 0xd9, 0x65, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x27, 0xd1, 0x05, 0xd0, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xcf, 0xd1, 0x05, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x45, 0x0d, 0xd1, 0x05, 0xdd, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x2a, 0xd1, 0x05, 0xf4, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xe8, 0xd1, 0x25, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x53, 0xd1, 0x05, 0xf3, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xe5, 0xd1, 0x05, 0xab, 0xd1, 0x05, 0x84, 0xd1, 0x05, 0x67, 0xd1, 0x25, 0x5a, 0xd1, 0x25, 0x5a, 0xd1, 0x05, 0x67, 0xd1, 0x05, 0x85, 0xd1, 0x05, 0xac, 0xd1, 0x05, 0xe6, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf2, 0xd1, 0x05, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x24, 0xd1, 0x05, 0xe9, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf4, 0xd1, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x03, 0xd1, 0x05, 0xcb, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf9, 0xd1, 0x05, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x68, 0xd1, 0x05, 0xfc, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xe4, 0xd1, 0x05, 0x84, 0xd1, 0x05, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x2c, 0xd1, 0x05, 0x85, 0xd1, 0x05, 0xe5, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfc, 0xd1, 0x05, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x38, 0xd1, 0x05, 0xfa, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xc9, 0xf8, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x69, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x68, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xe4, 0xd1, 0x05, 0x64, 0xd9, 0x65, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x25, 0x07, 0xd1, 0x05, 0x66, 0xd1, 0x05, 0xe6, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x73, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x15, 0xd1, 0x05, 0xee, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xb8, 0xf8, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x53, 0xd1, 0x05, 0xfc, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfe, 0xd1, 0x05, 0x94, 0xd9, 0x45, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x25, 0x0e, 0xd1, 0x05, 0x96, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfc, 0xd1, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x01, 0xd1, 0x05, 0xba, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xec, 0xd8, 0xe5, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x86, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf7, 0xd1, 0x25, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x27, 0xd1, 0x05, 0xf3, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf3, 0xd1, 0x05, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x54, 0xd1, 0x05, 0xf4, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf2, 0xd1, 0x25, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x25, 0xd1, 0x05, 0xf8, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x24, 0x0f, 0xd1, 0x05, 0xf0, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x65, 0x06, 0xd1, 0x05, 0xd0, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xec, 0xd1, 0x05, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x39, 0xd1, 0x05, 0x55, 0xd1, 0x05, 0x55, 0xd1, 0x05, 0x55, 0xd1, 0x05, 0x55, 0xd1, 0x05, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x38, 0xd1, 0x05, 0xed, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xce, 0xd1, 0xa6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x83, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xef, 0xc9, 0x25, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x76, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xee, 0xc9, 0x25, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x78, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf3, 0xd1, 0x05, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x38, 0xd1, 0x05, 0xf4, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x06, 0x10, 0xd1, 0x05, 0xf0, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xd8, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xe5, 0x1b, 0xd1, 0x05, 0xf4, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfe, 0xd1, 0x05, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x53, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf3, 0xd1, 0x05, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x84, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd1, 0x05, 0x37, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfa, 0xd1, 0x26, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x90, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x96, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x05, 0x18, 0xd1, 0x05, 0xfb, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x25, 0x34, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd1, 0x05, 0x90, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xe5, 0x13, 0xd1, 0x05, 0xf5, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xe4, 0xd9, 0x45, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x25, 0x0e, 0xd1, 0x05, 0xe6, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf4, 0xc8, 0xe5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xb5, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x8d, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd1, 0x05, 0xd5, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x6d, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x66, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x58, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xd1, 0x00, 0x00, 0x00, 
-  0xd1, 0x06, 0x17, 0xd1, 0x05, 0xfe, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfc, 0xd1, 0x06, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xcb, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xe4, 0xd9, 0x65, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x25, 0x07, 0xd1, 0x05, 0xe4, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xe5, 0x12, 0xd1, 0x05, 0xfd, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfe, 0xd1, 0x25, 0x15, 
-  0xd1, 0x05, 0x55, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x19, 0xd1, 0x05, 0xfe, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x86, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfe, 0xd1, 0x26, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xcc, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x53, 
-  0xd1, 0x05, 0x80, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x59, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x2d, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x8f, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x7e, 
-  0xd1, 0x05, 0xa6, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x91, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x01, 0xd1, 0x05, 0xe6, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x66, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xa4, 
-  0xd1, 0x05, 0xcc, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xb9, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xad, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x3f, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xca, 
-  0xd1, 0x05, 0xe0, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xdd, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x85, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x21, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xde, 
-  0xd1, 0x05, 0xec, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xc8, 0xe5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xed, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x69, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x45, 0x14, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xeb, 
-  0xd1, 0x05, 0xf9, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd9, 0x65, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xf9, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x5c, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x25, 0x07, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf8, 
-  0xd1, 0x05, 0xf9, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd9, 0x65, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xf9, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x5c, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x25, 0x07, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf8, 
-  0xd1, 0x05, 0xec, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xc8, 0xe5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xed, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x69, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x45, 0x14, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xeb, 
-  0xd1, 0x05, 0xe0, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xdc, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x72, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x86, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x21, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xde, 
-  0xd1, 0x05, 0xcc, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xb8, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xad, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x3f, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xca, 
-  0xd1, 0x05, 0xa6, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x91, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x01, 0xd1, 0x05, 0xe7, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x66, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xa4, 
-  0xd1, 0x05, 0x7f, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x59, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x25, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x2e, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x8f, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x7d, 
-  0xd1, 0x05, 0x54, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x05, 0x18, 0xd1, 0x05, 0xfe, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x87, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfe, 0xd1, 0x26, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xcc, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x25, 0x52, 
-  0xd1, 0x06, 0x17, 0xd1, 0x05, 0xfe, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfc, 0xd1, 0x06, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xca, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xe5, 0xd9, 0x25, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x25, 0x07, 0xd1, 0x05, 0xe5, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xe5, 0x12, 0xd1, 0x05, 0xfd, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfe, 0xd1, 0x25, 0x15, 
-  0x00, 0x00, 0x00, 0xd1, 0x05, 0xd4, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x6d, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x68, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x58, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xd0, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd1, 0x05, 0x8f, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xe5, 0x13, 0xd1, 0x05, 0xf4, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xe6, 0xc9, 0x25, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x24, 0x0f, 0xd1, 0x05, 0xe7, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf4, 0xc8, 0xe5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xb5, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x8b, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd1, 0x05, 0x36, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfa, 0xd1, 0x26, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x8f, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x99, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x06, 0x17, 0xd1, 0x05, 0xfb, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x25, 0x33, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xd7, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xe5, 0x1b, 0xd1, 0x05, 0xf4, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x56, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf2, 0xc9, 0x05, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x84, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x76, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xef, 0xc9, 0x25, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x76, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf4, 0xd1, 0x05, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x39, 0xd1, 0x05, 0xf5, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x06, 0x10, 0xd1, 0x05, 0xf0, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x24, 0x0f, 0xd1, 0x05, 0xef, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xa6, 0x05, 0xd1, 0x05, 0xce, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xed, 0xd1, 0x05, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x39, 0xd1, 0x05, 0x55, 0xd1, 0x05, 0x55, 0xd1, 0x05, 0x55, 0xd1, 0x05, 0x55, 0xd1, 0x05, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x39, 0xd1, 0x05, 0xed, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xcd, 0xd1, 0xa6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x84, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xee, 0xc9, 0x25, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x84, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf7, 0xd1, 0x25, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x26, 0xd1, 0x05, 0xf2, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf4, 0xd1, 0x05, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x56, 0xd1, 0x05, 0xf5, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf1, 0xd1, 0x25, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x25, 0xd1, 0x05, 0xf8, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xe5, 0x13, 0xd1, 0x05, 0xed, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xb9, 0xf8, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x51, 0xd1, 0x05, 0xfc, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x96, 0xc9, 0x25, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x24, 0x0f, 0xd1, 0x05, 0x99, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfc, 0xd1, 0x05, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x01, 0xd1, 0x05, 0xbb, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xeb, 0xd1, 0x06, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x67, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x66, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xe6, 0xd1, 0x05, 0x66, 0xd9, 0x25, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x25, 0x07, 0xd1, 0x25, 0x69, 0xd1, 0x05, 0xe7, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfe, 0xd1, 0x05, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x74, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0xd1, 0x05, 0xca, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfa, 0xd1, 0x05, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x66, 0xd1, 0x05, 0xfc, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xe5, 0xd1, 0x05, 0x86, 0xd1, 0x25, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x2e, 0xd1, 0x05, 0x87, 0xd1, 0x05, 0xe6, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfc, 0xd1, 0x05, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x3a, 0xd1, 0x05, 0xfa, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xc8, 0xf8, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x28, 0xd1, 0x05, 0xf4, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xe9, 0xd1, 0x25, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x50, 0xd1, 0x05, 0xf2, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xe7, 0xd1, 0x05, 0xad, 0xd1, 0x05, 0x86, 0xd1, 0x05, 0x68, 0xd1, 0x05, 0x5b, 0xd1, 0x05, 0x5b, 0xd1, 0x05, 0x68, 0xd1, 0x05, 0x86, 0xd1, 0x05, 0xad, 0xd1, 0x05, 0xe7, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf1, 0xd1, 0x05, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x25, 0xd1, 0x05, 0xea, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf3, 0xd1, 0x05, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x5f, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xdd, 0xd9, 0x45, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x25, 0xd1, 0x05, 0xce, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xcd, 0xd1, 0x25, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x45, 0x0d, 0xd1, 0x05, 0xdd, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x9a, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xa6, 0x05, 0xd1, 0x05, 0x75, 0xd1, 0x05, 0xf3, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf2, 0xd1, 0x05, 0x73, 0xd1, 0xa6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x80, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x08, 0x04, 0xd1, 0x05, 0xb3, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x19, 0xd1, 0x05, 0x8e, 0xd1, 0x05, 0xf4, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf4, 0xd1, 0x05, 0x8d, 0xc9, 0x05, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x80, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xb2, 0xa8, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xc6, 0x0a, 0xd1, 0x05, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xe5, 0x13, 0xd1, 0x05, 0x6c, 0xd1, 0x05, 0xc8, 0xd1, 0x05, 0xfe, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfe, 0xd1, 0x05, 0xc7, 0xd1, 0x05, 0x6b, 0xd8, 0xe5, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x62, 0xd0, 0xc6, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x26, 0x16, 0xd1, 0x05, 0x57, 0xd1, 0x05, 0x8f, 0xd1, 0x05, 0xb7, 0xd1, 0x05, 0xd8, 0xd1, 0x05, 0xed, 0xd1, 0x05, 0xf9, 0xd1, 0x05, 0xf9, 0xd1, 0x05, 0xed, 0xd1, 0x05, 0xd8, 0xd1, 0x05, 0xb7, 0xd1, 0x05, 0x8f, 0xd1, 0x05, 0x57, 0xd1, 0x26, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x1f, 0xc9, 0x18, 0x27, 0x22, 0xce, 0x5a, 0x28, 0x21, 0xcf, 0x91, 0x29, 0x21, 0xce, 0xb9, 0x28, 0x20, 0xcf, 0xdb, 0x28, 0x21, 0xce, 0xee, 0x28, 0x20, 0xcf, 0xfa, 0x28, 0x20, 0xcf, 0xfa, 0x28, 0x21, 0xce, 0xee, 0x28, 0x20, 0xcf, 0xdb, 0x29, 0x21, 0xce, 0xb9, 0x28, 0x21, 0xcf, 0x91, 0x28, 0x22, 0xce, 0x59, 0x2a, 0x1f, 0xc9, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x19, 0xcc, 0x0a, 0x29, 0x21, 0xd0, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1a, 0xc9, 0x13, 0x29, 0x20, 0xce, 0x6e, 0x29, 0x20, 0xcf, 0xcb, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0xca, 0x2a, 0x20, 0xcd, 0x6d, 0x28, 0x1a, 0xc9, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xd0, 0x62, 0x33, 0x19, 0xcc, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0xbf, 0x04, 0x29, 0x20, 0xce, 0xb4, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xd1, 0x1c, 0x28, 0x21, 0xcf, 0x90, 0x28, 0x21, 0xcf, 0xf5, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xf4, 0x29, 0x21, 0xce, 0x8f, 0x25, 0x1c, 0xcf, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xcf, 0x80, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0xb3, 0x3f, 0x3f, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xcf, 0x9c, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xcc, 0x05, 0x28, 0x22, 0xce, 0x78, 0x28, 0x21, 0xce, 0xf4, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xf4, 0x29, 0x20, 0xcf, 0x76, 0x33, 0x33, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xcf, 0x80, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xd0, 0x62, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0xdc, 0x2a, 0x2a, 0xd4, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x20, 0xd1, 0x27, 0x28, 0x21, 0xcf, 0xd0, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xcf, 0x28, 0x21, 0xd0, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x27, 0xd7, 0x0d, 0x29, 0x21, 0xce, 0xdd, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xce, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x1e, 0xce, 0x2a, 0x28, 0x21, 0xce, 0xf4, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xce, 0xe8, 0x2a, 0x23, 0xcd, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x21, 0xcd, 0x53, 0x28, 0x20, 0xce, 0xf3, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xe5, 0x28, 0x20, 0xcf, 0xab, 0x28, 0x20, 0xce, 0x84, 0x2a, 0x20, 0xcf, 0x67, 0x27, 0x22, 0xce, 0x5a, 0x27, 0x22, 0xce, 0x5a, 0x2a, 0x20, 0xcf, 0x67, 0x28, 0x20, 0xcf, 0x85, 0x29, 0x20, 0xcf, 0xac, 0x29, 0x21, 0xcf, 0xe6, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0xf2, 0x28, 0x1f, 0xcf, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x23, 0xcd, 0x24, 0x28, 0x20, 0xce, 0xe9, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xf4, 0x26, 0x1f, 0xcc, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x03, 0x29, 0x20, 0xcf, 0xcb, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xce, 0xf9, 0x29, 0x20, 0xd0, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x1f, 0xcd, 0x68, 0x29, 0x21, 0xcf, 0xfc, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xe4, 0x28, 0x20, 0xce, 0x84, 0x2a, 0x1e, 0xce, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x22, 0xd0, 0x2c, 0x28, 0x20, 0xcf, 0x85, 0x29, 0x21, 0xcf, 0xe5, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xfc, 0x28, 0x20, 0xcf, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1f, 0xcc, 0x38, 0x28, 0x20, 0xcf, 0xfa, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xce, 0xc9, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x22, 0xce, 0x69, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x1f, 0xcd, 0x68, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xe4, 0x28, 0x21, 0xce, 0x64, 0x2a, 0x2a, 0xd4, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xda, 0x07, 0x28, 0x20, 0xcf, 0x66, 0x29, 0x21, 0xcf, 0xe6, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x21, 0xce, 0x73, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xce, 0x15, 0x28, 0x21, 0xce, 0xee, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xb8, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x21, 0xcd, 0x53, 0x29, 0x21, 0xcf, 0xfc, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xfe, 0x29, 0x20, 0xce, 0x94, 0x27, 0x27, 0xd7, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xc8, 0x0e, 0x28, 0x20, 0xcf, 0x96, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xfc, 0x29, 0x1f, 0xcf, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x29, 0x20, 0xcf, 0xba, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xec, 0x2a, 0x1c, 0xd4, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0x86, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xf7, 0x2b, 0x24, 0xcc, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x20, 0xd1, 0x27, 0x28, 0x20, 0xce, 0xf3, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xce, 0xf3, 0x28, 0x1f, 0xcf, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x21, 0xce, 0x54, 0x28, 0x21, 0xce, 0xf4, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0xf2, 0x29, 0x22, 0xce, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x22, 0xce, 0x25, 0x29, 0x20, 0xce, 0xf8, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xcc, 0x0f, 0x29, 0x20, 0xcf, 0xf0, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x2a, 0xd4, 0x06, 0x28, 0x21, 0xcf, 0xd0, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xec, 0x2a, 0x21, 0xcf, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1f, 0xcd, 0x39, 0x2a, 0x21, 0xcf, 0x55, 0x2a, 0x21, 0xcf, 0x55, 0x2a, 0x21, 0xcf, 0x55, 0x2a, 0x21, 0xcf, 0x55, 0x28, 0x1f, 0xcd, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1f, 0xcc, 0x38, 0x28, 0x21, 0xce, 0xed, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xce, 0x33, 0x33, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xce, 0x83, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xef, 0x24, 0x24, 0xc8, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0x76, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xee, 0x24, 0x24, 0xc8, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x22, 0xce, 0x78, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xce, 0xf3, 0x2a, 0x21, 0xcf, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0xaa, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1f, 0xcc, 0x38, 0x28, 0x21, 0xce, 0xf4, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x1f, 0xcf, 0x10, 0x29, 0x20, 0xcf, 0xf0, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xce, 0xd8, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x1c, 0xcf, 0x1b, 0x28, 0x21, 0xce, 0xf4, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xfe, 0x28, 0x1f, 0xcf, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0xaa, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x21, 0xcd, 0x53, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xce, 0xf3, 0x28, 0x1e, 0xcc, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xce, 0x84, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xd0, 0x37, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0xfa, 0x2e, 0x22, 0xd0, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0x90, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0xaa, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xcf, 0x96, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x1f, 0xc9, 0x18, 0x28, 0x20, 0xcf, 0xfb, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x27, 0x22, 0xcd, 0x34, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0x90, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1a, 0xc9, 0x13, 0x28, 0x21, 0xcf, 0xf5, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xe4, 0x27, 0x27, 0xd7, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0xaa, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xc8, 0x0e, 0x29, 0x21, 0xcf, 0xe6, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xf4, 0x28, 0x1a, 0xc9, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xcf, 0xb5, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0x8d, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0xd5, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x2a, 0x21, 0xcf, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x20, 0xcd, 0x6d, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0xaa, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xcf, 0x66, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1f, 0xcd, 0x58, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xd1, 0x00, 0x00, 0x00, 0x00, 
-  0x2c, 0x21, 0xd2, 0x17, 0x29, 0x21, 0xce, 0xfe, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xfc, 0x2f, 0x1f, 0xcf, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0xcb, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xe4, 0x2a, 0x2a, 0xd4, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0xaa, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xda, 0x07, 0x29, 0x21, 0xce, 0xe4, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xce, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x1c, 0xd4, 0x12, 0x29, 0x21, 0xce, 0xfd, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xfe, 0x24, 0x24, 0xce, 0x15, 
-  0x2a, 0x21, 0xcf, 0x55, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1e, 0xcc, 0x19, 0x29, 0x21, 0xce, 0xfe, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xce, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0xaa, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0x86, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xfe, 0x2e, 0x22, 0xd0, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0xcc, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x27, 0x21, 0xcd, 0x53, 
-  0x29, 0x21, 0xcf, 0x80, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x22, 0xce, 0x59, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x2a, 0x1e, 0xce, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0xaa, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x22, 0xd1, 0x2d, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xd0, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xce, 0x8f, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xce, 0x7e, 
-  0x29, 0x20, 0xcf, 0xa6, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0x91, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0xaa, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x29, 0x21, 0xcf, 0xe6, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xcf, 0x66, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xce, 0xa4, 
-  0x29, 0x20, 0xcf, 0xcc, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xd1, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xce, 0xb9, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0xaa, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xce, 0xad, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xce, 0x3f, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0xca, 
-  0x28, 0x21, 0xcf, 0xe0, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x27, 0x1f, 0xcf, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xce, 0xdd, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xce, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0xaa, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xcf, 0x85, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x1e, 0xd0, 0x21, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xde, 
-  0x29, 0x21, 0xcf, 0xec, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x1a, 0xc9, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xce, 0xed, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x1f, 0xcd, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0xaa, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x22, 0xce, 0x69, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x26, 0xcc, 0x14, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xeb, 
-  0x28, 0x20, 0xce, 0xf9, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x2a, 0x2a, 0xd4, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xce, 0xf9, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x2a, 0x21, 0xcf, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0xaa, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xcf, 0x5c, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xda, 0x07, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0xf8, 
-  0x28, 0x20, 0xce, 0xf9, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x2a, 0x2a, 0xd4, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xce, 0xf9, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x2a, 0x21, 0xcf, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0xaa, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xcf, 0x5c, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xda, 0x07, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0xf8, 
-  0x29, 0x21, 0xcf, 0xec, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x1a, 0xc9, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xce, 0xed, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x1f, 0xcd, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0xaa, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x22, 0xce, 0x69, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x26, 0xcc, 0x14, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xeb, 
-  0x28, 0x21, 0xcf, 0xe0, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x27, 0x1f, 0xcf, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xcf, 0xdc, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xce, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xd0, 0x72, 0x28, 0x21, 0xcf, 0xaa, 0x28, 0x21, 0xcf, 0xaa, 0x28, 0x21, 0xcf, 0xaa, 0x28, 0x21, 0xcf, 0xaa, 0x28, 0x21, 0xd0, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0x86, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x1e, 0xd0, 0x21, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xde, 
-  0x29, 0x20, 0xcf, 0xcc, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xd1, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xce, 0xb8, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xce, 0xad, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xce, 0x3f, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0xca, 
-  0x29, 0x20, 0xcf, 0xa6, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0x91, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x28, 0x21, 0xcf, 0xe7, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xcf, 0x66, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xce, 0xa4, 
-  0x28, 0x20, 0xce, 0x7f, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x22, 0xce, 0x59, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x22, 0xd0, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x21, 0xcd, 0x2e, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xce, 0x8f, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xce, 0x7d, 
-  0x2a, 0x21, 0xce, 0x54, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x1f, 0xc9, 0x18, 0x29, 0x21, 0xce, 0xfe, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0x87, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xfe, 0x2e, 0x22, 0xd0, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0xcc, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x22, 0xd0, 0x52, 
-  0x2c, 0x21, 0xd2, 0x17, 0x29, 0x21, 0xce, 0xfe, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xfc, 0x2f, 0x1f, 0xcf, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xcf, 0xca, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xe5, 0x24, 0x24, 0xda, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xda, 0x07, 0x29, 0x21, 0xcf, 0xe5, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x1c, 0xd4, 0x12, 0x29, 0x21, 0xce, 0xfd, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xfe, 0x24, 0x24, 0xce, 0x15, 
-  0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xce, 0xd4, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x2a, 0x21, 0xcf, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x20, 0xcd, 0x6d, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0xaa, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x1f, 0xcd, 0x68, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1f, 0xcd, 0x58, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xd0, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xce, 0x8f, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1a, 0xc9, 0x13, 0x28, 0x21, 0xce, 0xf4, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xe6, 0x24, 0x24, 0xc8, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0xaa, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xcc, 0x0f, 0x28, 0x21, 0xcf, 0xe7, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xf4, 0x28, 0x1a, 0xc9, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xcf, 0xb5, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0x8b, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x2a, 0x21, 0xcf, 0x36, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0xfa, 0x2e, 0x22, 0xd0, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xce, 0x8f, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0xaa, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xce, 0x99, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x21, 0xd2, 0x17, 0x28, 0x20, 0xcf, 0xfb, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x23, 0xcd, 0x33, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xcf, 0xd7, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x1c, 0xcf, 0x1b, 0x28, 0x21, 0xce, 0xf4, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x2a, 0x21, 0xce, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0xaa, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0x56, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0xf2, 0x2a, 0x1f, 0xc9, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xce, 0x84, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0x76, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xef, 0x24, 0x24, 0xc8, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0x76, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xf4, 0x28, 0x1f, 0xcc, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0xaa, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1f, 0xcd, 0x39, 0x28, 0x21, 0xcf, 0xf5, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x27, 0x21, 0xce, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x1f, 0xcf, 0x10, 0x29, 0x20, 0xcf, 0xf0, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xcc, 0x0f, 0x28, 0x21, 0xce, 0xef, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xcc, 0x05, 0x28, 0x21, 0xce, 0xce, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xed, 0x28, 0x1f, 0xcc, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1f, 0xcd, 0x39, 0x2a, 0x21, 0xcf, 0x55, 0x2a, 0x21, 0xcf, 0x55, 0x2a, 0x21, 0xcf, 0x55, 0x2a, 0x21, 0xcf, 0x55, 0x28, 0x1f, 0xcd, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1f, 0xcd, 0x39, 0x28, 0x21, 0xce, 0xed, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xcd, 0x33, 0x33, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xce, 0x84, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xee, 0x24, 0x24, 0xc8, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xce, 0x84, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xf7, 0x2a, 0x23, 0xcd, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xd0, 0x26, 0x29, 0x20, 0xce, 0xf2, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xf4, 0x27, 0x21, 0xcd, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0x56, 0x28, 0x21, 0xcf, 0xf5, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xf1, 0x2a, 0x23, 0xcd, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x22, 0xce, 0x25, 0x29, 0x20, 0xce, 0xf8, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1a, 0xc9, 0x13, 0x28, 0x21, 0xce, 0xed, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xb9, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1f, 0xcf, 0x51, 0x29, 0x21, 0xcf, 0xfc, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0x96, 0x24, 0x24, 0xc8, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xcc, 0x0f, 0x29, 0x21, 0xce, 0x99, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xfc, 0x2a, 0x20, 0xcd, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x28, 0x20, 0xcf, 0xbb, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xeb, 0x2d, 0x1e, 0xd2, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x20, 0xcf, 0x67, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xd0, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xcf, 0x66, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xe6, 0x28, 0x20, 0xcf, 0x66, 0x24, 0x24, 0xda, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xda, 0x07, 0x29, 0x22, 0xce, 0x69, 0x28, 0x21, 0xcf, 0xe7, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xfe, 0x28, 0x20, 0xcf, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xce, 0x74, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x28, 0x20, 0xcf, 0xca, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0xfa, 0x28, 0x1f, 0xcc, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xcf, 0x66, 0x29, 0x21, 0xcf, 0xfc, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xe5, 0x29, 0x20, 0xcf, 0x86, 0x27, 0x22, 0xd1, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x21, 0xcd, 0x2e, 0x29, 0x20, 0xcf, 0x87, 0x29, 0x21, 0xcf, 0xe6, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xfc, 0x28, 0x20, 0xcf, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x23, 0xce, 0x3a, 0x28, 0x20, 0xcf, 0xfa, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xc8, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x1f, 0xcc, 0x28, 0x28, 0x21, 0xce, 0xf4, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xce, 0xe9, 0x2a, 0x23, 0xcd, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x1f, 0xcf, 0x50, 0x29, 0x20, 0xce, 0xf2, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xe7, 0x29, 0x20, 0xce, 0xad, 0x29, 0x20, 0xcf, 0x86, 0x29, 0x1f, 0xcd, 0x68, 0x2a, 0x21, 0xcf, 0x5b, 0x2a, 0x21, 0xcf, 0x5b, 0x29, 0x1f, 0xcd, 0x68, 0x29, 0x20, 0xcf, 0x86, 0x29, 0x20, 0xce, 0xad, 0x28, 0x21, 0xcf, 0xe7, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xf1, 0x2a, 0x20, 0xcd, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x22, 0xce, 0x25, 0x29, 0x20, 0xcf, 0xea, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xce, 0xf3, 0x27, 0x20, 0xd1, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xce, 0x5f, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xdd, 0x27, 0x27, 0xd7, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x22, 0xce, 0x25, 0x28, 0x21, 0xce, 0xce, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xcd, 0x2a, 0x23, 0xcd, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x27, 0xd7, 0x0d, 0x29, 0x21, 0xce, 0xdd, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcd, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xce, 0x9a, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xcc, 0x05, 0x29, 0x20, 0xcf, 0x75, 0x28, 0x20, 0xce, 0xf3, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0xf2, 0x27, 0x21, 0xce, 0x73, 0x33, 0x33, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xcf, 0x80, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0xbf, 0x04, 0x29, 0x20, 0xce, 0xb3, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1e, 0xcc, 0x19, 0x29, 0x20, 0xce, 0x8e, 0x28, 0x21, 0xce, 0xf4, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xf4, 0x29, 0x20, 0xce, 0x8d, 0x2a, 0x1f, 0xc9, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xcf, 0x80, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0xb2, 0x00, 0x00, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x19, 0xcc, 0x0a, 0x29, 0x21, 0xd0, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1a, 0xc9, 0x13, 0x28, 0x21, 0xcf, 0x6c, 0x28, 0x21, 0xce, 0xc8, 0x29, 0x21, 0xce, 0xfe, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xfe, 0x29, 0x21, 0xcf, 0xc7, 0x28, 0x21, 0xcf, 0x6b, 0x2a, 0x1c, 0xd4, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xd0, 0x62, 0x33, 0x19, 0xcc, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x22, 0xd0, 0x16, 0x29, 0x20, 0xd0, 0x57, 0x29, 0x21, 0xce, 0x8f, 0x28, 0x21, 0xcf, 0xb7, 0x29, 0x21, 0xce, 0xd8, 0x28, 0x21, 0xce, 0xed, 0x28, 0x20, 0xce, 0xf9, 0x28, 0x20, 0xce, 0xf9, 0x28, 0x21, 0xce, 0xed, 0x29, 0x21, 0xce, 0xd8, 0x28, 0x21, 0xcf, 0xb7, 0x29, 0x21, 0xce, 0x8f, 0x29, 0x20, 0xd0, 0x57, 0x2e, 0x22, 0xd0, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
+  /*Packed: ARGB8888 + vector, 16384 bytes LZ4 compressed*/
+  0x47, 0x50, 0x01, 0x01, 0x00, 0x00, 0x00, 0xff, 0xb0, 0x0c, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58, 0xf1, 0x0d, 0x2a, 0x1f, 0xc9, 0x18, 0x27, 
+  0x22, 0xce, 0x5a, 0x28, 0x21, 0xcf, 0x91, 0x29, 0x21, 0xce, 0xb9, 0x28, 0x20, 0xcf, 0xdb, 0x28, 0x21, 0xce, 0xee, 0x28, 0x20, 0xcf, 0xfa, 0x04, 0x00, 0x02, 0x0c, 0x00, 0x11, 0xdb, 0x1c, 0x00, 
+  0x70, 0x21, 0xcf, 0x91, 0x28, 0x22, 0xce, 0x59, 0x34, 0x00, 0x0f, 0x9b, 0x08, 0x71, 0x8f, 0x33, 0x19, 0xcc, 0x0a, 0x29, 0x21, 0xd0, 0x62, 0x8c, 0x00, 0x1d, 0xff, 0x01, 0x28, 0x1a, 0xc9, 0x13, 
+  0x29, 0x20, 0xce, 0x6e, 0x29, 0x20, 0xcf, 0xcb, 0x29, 0x21, 0xcf, 0xff, 0x04, 0x00, 0x21, 0x80, 0x28, 0x20, 0xcf, 0xca, 0x2a, 0x20, 0xcd, 0x6d, 0x4c, 0x00, 0x0f, 0x80, 0x00, 0x1d, 0x00, 0xb4, 
+  0x00, 0x00, 0xbc, 0x00, 0x0f, 0x38, 0x00, 0x1d, 0x08, 0x30, 0x00, 0x83, 0x3f, 0x3f, 0xbf, 0x04, 0x29, 0x20, 0xce, 0xb4, 0xbc, 0x00, 0x18, 0x80, 0x1c, 0x00, 0x0f, 0x0c, 0x00, 0x05, 0xc3, 0x24, 
+  0x24, 0xd1, 0x1c, 0x28, 0x21, 0xcf, 0x90, 0x28, 0x21, 0xcf, 0xf5, 0x38, 0x00, 0x0f, 0xfc, 0x00, 0x22, 0x08, 0x3c, 0x00, 0xcf, 0x28, 0x21, 0xce, 0xf4, 0x29, 0x21, 0xce, 0x8f, 0x25, 0x1c, 0xcf, 
+  0x1b, 0x78, 0x00, 0x05, 0x08, 0x18, 0x00, 0x41, 0x29, 0x21, 0xcf, 0x80, 0x40, 0x00, 0x30, 0x20, 0xce, 0xb3, 0xc4, 0x00, 0x08, 0x1c, 0x00, 0x0f, 0x0c, 0x00, 0x19, 0x41, 0x28, 0x20, 0xcf, 0x9c, 
+  0x48, 0x00, 0x06, 0xc0, 0x01, 0x0f, 0x04, 0x01, 0x06, 0x82, 0x33, 0x33, 0xcc, 0x05, 0x28, 0x22, 0xce, 0x78, 0xac, 0x00, 0x0f, 0xf0, 0x01, 0x23, 0x0b, 0x6c, 0x00, 0x0d, 0x38, 0x01, 0x01, 0x5c, 
+  0x00, 0x30, 0x20, 0xcf, 0x76, 0x6c, 0x00, 0x0f, 0xc8, 0x00, 0x05, 0x05, 0xfc, 0x00, 0x05, 0xb4, 0x00, 0x2f, 0xce, 0x99, 0x2c, 0x00, 0x05, 0x0f, 0x18, 0x00, 0x09, 0x00, 0x40, 0x02, 0x0c, 0x90, 
+  0x00, 0x8c, 0x28, 0x20, 0xcf, 0xdc, 0x2a, 0x2a, 0xd4, 0x0c, 0x38, 0x00, 0x8c, 0x27, 0x20, 0xd1, 0x27, 0x28, 0x21, 0xcf, 0xd0, 0x30, 0x00, 0x0f, 0x10, 0x00, 0x45, 0x8d, 0x28, 0x21, 0xce, 0xcf, 
+  0x28, 0x21, 0xd0, 0x26, 0x88, 0x00, 0x7c, 0x27, 0xd7, 0x0d, 0x29, 0x21, 0xce, 0xdd, 0x78, 0x00, 0x4c, 0x28, 0x20, 0xce, 0x5f, 0x2c, 0x00, 0x0f, 0x10, 0x00, 0x09, 0x41, 0x2a, 0x1e, 0xce, 0x2a, 
+  0x6c, 0x01, 0x05, 0x44, 0x01, 0xac, 0xcf, 0xff, 0x28, 0x20, 0xce, 0xe8, 0x2a, 0x23, 0xcd, 0x24, 0x38, 0x00, 0x8c, 0x27, 0x21, 0xcd, 0x53, 0x28, 0x20, 0xce, 0xf3, 0x74, 0x00, 0x0f, 0x10, 0x00, 
+  0x04, 0xd0, 0xe5, 0x28, 0x20, 0xcf, 0xab, 0x28, 0x20, 0xce, 0x84, 0x2a, 0x20, 0xcf, 0x67, 0x14, 0x05, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0xcf, 0x28, 0x20, 0xcf, 0x85, 0x29, 0x20, 0xcf, 0xac, 
+  0x29, 0x21, 0xcf, 0xe6, 0x3c, 0x00, 0x04, 0x0a, 0x10, 0x02, 0x7c, 0x20, 0xce, 0xf2, 0x28, 0x1f, 0xcf, 0x51, 0x90, 0x00, 0x00, 0xa4, 0x00, 0x48, 0x28, 0x20, 0xce, 0xe9, 0x44, 0x00, 0x00, 0xcc, 
+  0x00, 0x4c, 0x26, 0x1f, 0xcc, 0x28, 0x2c, 0x00, 0x0f, 0x10, 0x00, 0x03, 0x2c, 0xaa, 0x03, 0xb4, 0x04, 0x8c, 0x28, 0x20, 0xce, 0xf9, 0x29, 0x20, 0xd0, 0x37, 0x30, 0x00, 0x88, 0x29, 0x1f, 0xcd, 
+  0x68, 0x29, 0x21, 0xcf, 0xfc, 0x6c, 0x00, 0x0e, 0x0c, 0x00, 0x21, 0xce, 0xe4, 0xf0, 0x00, 0x3c, 0x1e, 0xce, 0x2a, 0x40, 0x00, 0x0f, 0x10, 0x00, 0x05, 0x41, 0x28, 0x22, 0xd0, 0x2c, 0x10, 0x01, 
+  0x3e, 0x21, 0xcf, 0xe5, 0x50, 0x00, 0x09, 0x5c, 0x03, 0x5c, 0xfc, 0x28, 0x20, 0xcf, 0x66, 0x48, 0x00, 0x40, 0x28, 0x1f, 0xcc, 0x38, 0x58, 0x06, 0x08, 0x3c, 0x00, 0x8c, 0x28, 0x20, 0xce, 0xc9, 
+  0x00, 0x00, 0xff, 0x02, 0x2c, 0x00, 0x0c, 0x10, 0x00, 0x48, 0x29, 0x22, 0xce, 0x69, 0x38, 0x00, 0x00, 0x0c, 0x00, 0x4d, 0x28, 0x21, 0xcf, 0x71, 0x28, 0x00, 0x02, 0xfc, 0x00, 0x0a, 0x94, 0x01, 
+  0x07, 0x30, 0x02, 0xcc, 0x29, 0x21, 0xce, 0xe4, 0x28, 0x21, 0xce, 0x64, 0x2a, 0x2a, 0xd4, 0x06, 0x3c, 0x00, 0x0f, 0x10, 0x00, 0x15, 0x40, 0x24, 0x24, 0xda, 0x07, 0xe0, 0x00, 0x0f, 0x14, 0x02, 
+  0x0d, 0x00, 0x24, 0x00, 0x0c, 0x54, 0x00, 0x40, 0x27, 0x21, 0xce, 0x73, 0xbc, 0x00, 0x08, 0x04, 0x00, 0x0f, 0x28, 0x00, 0x01, 0x08, 0x38, 0x00, 0x40, 0x24, 0x24, 0xce, 0x15, 0x98, 0x07, 0x08, 
+  0x34, 0x00, 0x88, 0x29, 0x21, 0xce, 0xb8, 0x00, 0x00, 0xff, 0x01, 0x28, 0x00, 0x00, 0xf4, 0x02, 0x0f, 0xf8, 0x01, 0x07, 0xa8, 0xce, 0xfe, 0x29, 0x20, 0xce, 0x94, 0x27, 0x27, 0xd7, 0x0d, 0x34, 
+  0x00, 0x0f, 0x0c, 0x00, 0x29, 0x8a, 0x24, 0x24, 0xc8, 0x0e, 0x28, 0x20, 0xcf, 0x96, 0x98, 0x00, 0x0a, 0x08, 0x02, 0x4a, 0x29, 0x1f, 0xcf, 0x50, 0x64, 0x00, 0x6b, 0xff, 0x01, 0x29, 0x20, 0xcf, 
+  0xba, 0x34, 0x00, 0x5a, 0xec, 0x2a, 0x1c, 0xd4, 0x12, 0x28, 0x00, 0x06, 0x0e, 0x00, 0x4b, 0x29, 0x20, 0xcf, 0x86, 0x30, 0x00, 0x56, 0xf7, 0x2b, 0x24, 0xcc, 0x23, 0x22, 0x00, 0x21, 0x00, 0x00, 
+  0xec, 0x04, 0x0f, 0xf0, 0x03, 0x04, 0x00, 0x08, 0x04, 0x0f, 0x94, 0x03, 0x01, 0x08, 0x40, 0x00, 0x0f, 0x0c, 0x00, 0x29, 0x40, 0x2a, 0x21, 0xce, 0x54, 0xcc, 0x03, 0x0b, 0xa4, 0x00, 0x02, 0x84, 
+  0x02, 0x78, 0x20, 0xce, 0xf2, 0x29, 0x22, 0xce, 0x25, 0x60, 0x00, 0x00, 0x10, 0x00, 0x4b, 0x29, 0x20, 0xce, 0xf8, 0x30, 0x00, 0x18, 0x82, 0x24, 0x00, 0x04, 0x0c, 0x00, 0x8b, 0x22, 0x22, 0xcc, 
+  0x0f, 0x29, 0x20, 0xcf, 0xf0, 0x2c, 0x00, 0x09, 0xf0, 0x06, 0x00, 0xcc, 0x02, 0x0f, 0xe8, 0x05, 0x08, 0x54, 0xec, 0x2a, 0x21, 0xcf, 0x36, 0x50, 0x00, 0x0f, 0x08, 0x00, 0x09, 0x88, 0x28, 0x1f, 
+  0xcd, 0x39, 0x2a, 0x21, 0xcf, 0x55, 0x04, 0x00, 0x00, 0x14, 0x00, 0x0f, 0x34, 0x00, 0x09, 0x04, 0x1c, 0x00, 0x01, 0xdc, 0x03, 0x3b, 0x21, 0xce, 0xed, 0xa8, 0x00, 0x01, 0x04, 0x01, 0x4c, 0x28, 
+  0x21, 0xce, 0xce, 0x1c, 0x07, 0x48, 0x28, 0x21, 0xce, 0x83, 0x2c, 0x00, 0x40, 0x28, 0x21, 0xce, 0xef, 0x50, 0x02, 0x04, 0x50, 0x00, 0x04, 0x08, 0x00, 0x4b, 0x29, 0x20, 0xcf, 0x76, 0x28, 0x00, 
+  0x1c, 0xee, 0x28, 0x00, 0x00, 0xe0, 0x07, 0x08, 0x24, 0x00, 0x04, 0x0c, 0x00, 0x00, 0xf8, 0x01, 0x0f, 0xfc, 0x00, 0x15, 0x00, 0x70, 0x00, 0x44, 0x28, 0x21, 0xcf, 0xaa, 0x3c, 0x00, 0x04, 0x08, 
+  0x00, 0x00, 0x14, 0x00, 0x00, 0x1c, 0x00, 0x0f, 0x04, 0x00, 0x11, 0x03, 0x04, 0x01, 0x14, 0xf4, 0x3c, 0x00, 0x09, 0x08, 0x00, 0x38, 0x20, 0xcf, 0x75, 0x44, 0x00, 0x4d, 0x2f, 0x1f, 0xcf, 0x10, 
+  0xd8, 0x01, 0x0b, 0x24, 0x00, 0x00, 0x30, 0x00, 0x49, 0x29, 0x21, 0xce, 0xd8, 0x48, 0x00, 0x29, 0x21, 0xcf, 0x28, 0x02, 0x00, 0x7c, 0x09, 0x0f, 0x7c, 0x02, 0x03, 0x2f, 0xce, 0xfe, 0xf4, 0x02, 
+  0x1d, 0x00, 0xec, 0x00, 0x0b, 0x6c, 0x00, 0x10, 0xff, 0x14, 0x00, 0x00, 0x88, 0x00, 0x0f, 0x04, 0x00, 0x15, 0x03, 0x84, 0x04, 0x01, 0xf8, 0x01, 0x08, 0x4c, 0x00, 0x00, 0x8c, 0x01, 0x48, 0x28, 
+  0x1e, 0xcc, 0x19, 0x48, 0x00, 0x00, 0x80, 0x06, 0x09, 0x24, 0x00, 0x38, 0x21, 0xcf, 0xd6, 0x20, 0x00, 0x00, 0xdc, 0x06, 0x09, 0x20, 0x00, 0x78, 0x20, 0xcf, 0xfa, 0x2e, 0x22, 0xd0, 0x16, 0x24, 
+  0x00, 0x00, 0xd4, 0x0a, 0x08, 0x24, 0x00, 0x05, 0x0c, 0x00, 0x38, 0x20, 0xce, 0x94, 0x28, 0x00, 0x0f, 0x0c, 0x00, 0x11, 0x00, 0xec, 0x00, 0x05, 0x40, 0x00, 0x03, 0x34, 0x06, 0x00, 0x14, 0x00, 
+  0x0f, 0x3c, 0x00, 0x11, 0x08, 0x24, 0x00, 0x0f, 0x14, 0x05, 0x06, 0x38, 0x20, 0xce, 0x8d, 0x28, 0x00, 0x00, 0x4c, 0x0d, 0x48, 0x28, 0x20, 0xcf, 0xfb, 0x74, 0x00, 0x44, 0x27, 0x22, 0xcd, 0x34, 
+  0x24, 0x00, 0x0d, 0xdc, 0x00, 0x34, 0x20, 0xce, 0xb2, 0x1c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x80, 0x0c, 0x0f, 0xd0, 0x0b, 0x03, 0x2f, 0xce, 0xe4, 0xe8, 0x05, 0x21, 0x00, 0xec, 0x00, 0x08, 0x8c, 
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x14, 0x00, 0x00, 0x6c, 0x00, 0x0f, 0x04, 0x00, 0x19, 0x00, 0xa0, 0x03, 0x0f, 0x1c, 0x07, 0x01, 0x00, 0xa8, 0x02, 0x00, 0xb4, 0x00, 0x08, 0x4c, 0x00, 0x40, 0x28, 
+  0x20, 0xcf, 0xb5, 0x68, 0x00, 0x05, 0x04, 0x00, 0x07, 0x24, 0x01, 0x45, 0x28, 0x21, 0xcf, 0xd5, 0x18, 0x00, 0x30, 0x21, 0xcf, 0xff, 0x98, 0x04, 0x08, 0x3c, 0x00, 0x00, 0x84, 0x0d, 0x08, 0x20, 
+  0x00, 0x04, 0x0c, 0x00, 0x00, 0xe0, 0x07, 0x08, 0x28, 0x00, 0x0f, 0x0c, 0x00, 0x15, 0x00, 0xec, 0x00, 0x04, 0x44, 0x00, 0x04, 0x08, 0x00, 0x00, 0x14, 0x00, 0x0f, 0x40, 0x00, 0x15, 0x08, 0x28, 
+  0x00, 0x00, 0xd4, 0x07, 0x04, 0x44, 0x00, 0x08, 0x08, 0x00, 0x49, 0x28, 0x21, 0xcf, 0x6c, 0x28, 0x00, 0x38, 0x1f, 0xcd, 0x58, 0x20, 0x00, 0x40, 0x29, 0x20, 0xcf, 0xd1, 0x20, 0x00, 0x87, 0x2c, 
+  0x21, 0xd2, 0x17, 0x29, 0x21, 0xce, 0xfe, 0x1c, 0x00, 0x10, 0xfc, 0x34, 0x04, 0x00, 0x1c, 0x00, 0x04, 0x04, 0x00, 0x0c, 0x10, 0x0a, 0x02, 0x2c, 0x00, 0x20, 0xce, 0xe4, 0x10, 0x06, 0x04, 0x24, 
+  0x00, 0x0f, 0x08, 0x00, 0x19, 0x00, 0xec, 0x00, 0x02, 0x44, 0x00, 0x06, 0xc4, 0x07, 0x00, 0x14, 0x00, 0x0f, 0x44, 0x00, 0x19, 0x04, 0x2c, 0x00, 0x00, 0x24, 0x09, 0x00, 0x6c, 0x09, 0x0d, 0x50, 
+  0x00, 0x01, 0xf0, 0x09, 0x04, 0x26, 0x00, 0x20, 0x00, 0x00, 0xf8, 0x07, 0x46, 0x29, 0x21, 0xce, 0xfd, 0x28, 0x00, 0x20, 0xce, 0xfe, 0xf0, 0x08, 0x00, 0xec, 0x01, 0x06, 0x14, 0x00, 0x00, 0xe8, 
+  0x0b, 0x26, 0xcf, 0xca, 0x36, 0x00, 0x20, 0x00, 0x00, 0x4c, 0x04, 0x0b, 0x20, 0x01, 0x01, 0x74, 0x04, 0x00, 0x54, 0x04, 0x08, 0x28, 0x00, 0x0f, 0x0c, 0x00, 0x19, 0x00, 0xec, 0x00, 0x08, 0x74, 
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x14, 0x00, 0x0f, 0x44, 0x00, 0x19, 0x08, 0x2c, 0x00, 0x0f, 0xb8, 0x08, 0x00, 0x10, 0xff, 0xb4, 0x00, 0x0c, 0xc4, 0x04, 0x40, 0x29, 0x20, 0xcf, 0xcc, 0x6c, 0x00, 
+  0x04, 0x04, 0x00, 0x03, 0x44, 0x05, 0x02, 0x2c, 0x0f, 0x03, 0x88, 0x04, 0x17, 0x29, 0x18, 0x03, 0x00, 0x64, 0x00, 0x00, 0x8c, 0x11, 0x04, 0x30, 0x00, 0x08, 0x08, 0x00, 0x00, 0x24, 0x0d, 0x00, 
+  0x20, 0x00, 0x0f, 0x04, 0x00, 0x21, 0x00, 0xec, 0x00, 0x08, 0x4c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x14, 0x00, 0x0f, 0x4c, 0x00, 0x21, 0x00, 0x34, 0x00, 0x40, 0x27, 0x22, 0xd1, 0x2d, 0x44, 0x00, 
+  0x0d, 0x04, 0x00, 0x30, 0x20, 0xd0, 0x57, 0x20, 0x00, 0x04, 0x04, 0x00, 0x00, 0x44, 0x10, 0x08, 0x24, 0x00, 0x89, 0x28, 0x20, 0xce, 0x7e, 0x29, 0x20, 0xcf, 0xa6, 0x14, 0x00, 0x34, 0x21, 0xce, 
+  0x64, 0x30, 0x00, 0x00, 0x08, 0x00, 0x02, 0xb4, 0x12, 0x06, 0xa8, 0x02, 0x03, 0x2c, 0x00, 0x10, 0xe5, 0x1c, 0x00, 0x0f, 0x04, 0x00, 0x25, 0x00, 0xec, 0x00, 0x03, 0x48, 0x00, 0x01, 0x4c, 0x02, 
+  0x00, 0x0c, 0x00, 0x00, 0x14, 0x00, 0x0f, 0x50, 0x00, 0x25, 0x00, 0xa0, 0x0b, 0x0f, 0x08, 0x05, 0x01, 0x00, 0xf0, 0x00, 0x08, 0x54, 0x00, 0x0c, 0x2c, 0x04, 0x4c, 0x28, 0x20, 0xce, 0xa4, 0x14, 
+  0x02, 0x48, 0x29, 0x21, 0xd1, 0x3d, 0x34, 0x00, 0x00, 0x94, 0x13, 0x00, 0xa0, 0x00, 0x09, 0x04, 0x00, 0x38, 0x20, 0xcf, 0xac, 0x24, 0x00, 0x0f, 0x0c, 0x00, 0x1d, 0x00, 0xec, 0x00, 0x09, 0x50, 
+  0x00, 0x2f, 0x21, 0xcf, 0x00, 0x08, 0x1e, 0x0c, 0x74, 0x00, 0x4f, 0x29, 0x20, 0xce, 0xad, 0x54, 0x00, 0x00, 0x18, 0xb7, 0x28, 0x00, 0x48, 0x28, 0x20, 0xce, 0x3f, 0x24, 0x00, 0x00, 0x60, 0x13, 
+  0x48, 0x28, 0x21, 0xcf, 0xe0, 0x14, 0x00, 0x48, 0x27, 0x1f, 0xcf, 0x20, 0x34, 0x00, 0x0f, 0x50, 0x10, 0x04, 0x18, 0x84, 0x24, 0x00, 0x0f, 0x0c, 0x00, 0x1d, 0x0f, 0x00, 0x01, 0x41, 0x03, 0x30, 
+  0x0f, 0x05, 0x50, 0x02, 0x00, 0xd4, 0x00, 0x00, 0x68, 0x15, 0x08, 0x9c, 0x00, 0x40, 0x26, 0x1e, 0xd0, 0x21, 0x18, 0x00, 0x06, 0x04, 0x00, 0x66, 0xce, 0xde, 0x29, 0x21, 0xcf, 0xec, 0x10, 0x00, 
+  0x2d, 0xcf, 0xff, 0x38, 0x07, 0x0f, 0x6c, 0x0b, 0x01, 0x38, 0x1f, 0xcd, 0x68, 0x58, 0x00, 0x0f, 0x0c, 0x00, 0x1d, 0x0f, 0x00, 0x01, 0x41, 0x0f, 0xb8, 0x0f, 0x01, 0x00, 0xdc, 0x00, 0x08, 0x9c, 
+  0x00, 0x48, 0x26, 0x26, 0xcc, 0x14, 0xec, 0x00, 0x41, 0x29, 0x20, 0xcf, 0xeb, 0xdc, 0x10, 0x04, 0xfc, 0x04, 0x00, 0xfc, 0x07, 0x0b, 0xb0, 0x0f, 0x0c, 0x20, 0x00, 0x00, 0x40, 0x00, 0x48, 0x2a, 
+  0x21, 0xcf, 0x5b, 0x58, 0x00, 0x0f, 0x0c, 0x00, 0x1d, 0x0f, 0x00, 0x01, 0x42, 0x30, 0x21, 0xcf, 0x5c, 0x9c, 0x00, 0x09, 0x04, 0x00, 0x38, 0x20, 0xce, 0xf8, 0x9c, 0x00, 0x02, 0x2c, 0x07, 0x07, 
+  0xcc, 0x04, 0x3c, 0x20, 0xce, 0xf8, 0xe0, 0x00, 0x0c, 0xd4, 0x07, 0x0c, 0x20, 0x00, 0x00, 0x60, 0x00, 0x0f, 0x00, 0x01, 0xb9, 0x00, 0x24, 0x02, 0x00, 0xd4, 0x00, 0x04, 0x04, 0x00, 0x0f, 0x00, 
+  0x03, 0xba, 0x38, 0x20, 0xcf, 0xeb, 0x00, 0x02, 0x0f, 0x00, 0x03, 0x02, 0x0f, 0x00, 0x05, 0x0c, 0x00, 0xf4, 0x15, 0x04, 0x1c, 0x01, 0x04, 0x08, 0x00, 0x0f, 0xfc, 0x08, 0x29, 0x00, 0x90, 0x00, 
+  0x40, 0x28, 0x21, 0xd0, 0x72, 0x04, 0x03, 0x0a, 0x04, 0x00, 0x20, 0xd0, 0x72, 0x1c, 0x00, 0x0f, 0x04, 0x00, 0x25, 0x0f, 0x04, 0x09, 0x01, 0x0f, 0x00, 0x05, 0x12, 0x0b, 0x14, 0x09, 0x0f, 0x00, 
+  0x07, 0x00, 0x14, 0xb8, 0xf8, 0x00, 0x05, 0x08, 0x00, 0x0f, 0x00, 0x07, 0x2c, 0x0f, 0xe4, 0x00, 0x25, 0x0f, 0x38, 0x00, 0x09, 0x0f, 0x00, 0x07, 0x04, 0x18, 0xb6, 0x34, 0x00, 0x0f, 0x00, 0x07, 
+  0x01, 0x0f, 0x00, 0x09, 0x24, 0x18, 0xe6, 0x58, 0x00, 0x0f, 0x0c, 0x00, 0x6f, 0x65, 0xff, 0x01, 0x28, 0x21, 0xcf, 0xe7, 0xa0, 0x01, 0x05, 0xd0, 0x05, 0x28, 0xce, 0x8f, 0x9c, 0x00, 0x0f, 0x00, 
+  0x09, 0x01, 0x49, 0x28, 0x20, 0xce, 0x7f, 0x38, 0x00, 0x0f, 0x00, 0x0b, 0x14, 0x00, 0xa4, 0x16, 0x08, 0x5c, 0x00, 0x0f, 0x0c, 0x00, 0x69, 0x49, 0x26, 0x21, 0xcd, 0x2e, 0xc4, 0x00, 0x04, 0x00, 
+  0x01, 0x38, 0x20, 0xcf, 0x56, 0x98, 0x00, 0x00, 0x10, 0x0a, 0x08, 0x28, 0x00, 0x40, 0x28, 0x20, 0xce, 0x7d, 0x54, 0x14, 0x0a, 0x14, 0x00, 0x0a, 0x00, 0x0d, 0x00, 0x3c, 0x10, 0x00, 0x4c, 0x0c, 
+  0x08, 0x24, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x70, 0x08, 0x08, 0x5c, 0x00, 0x0f, 0x0c, 0x00, 0x69, 0x40, 0x29, 0x20, 0xcf, 0x87, 0x94, 0x00, 0x0a, 0x04, 0x00, 0x2f, 0xce, 0xfe, 0x00, 0x0d, 0x0d, 
+  0x4f, 0x28, 0x22, 0xd0, 0x52, 0x00, 0x0f, 0x11, 0x00, 0x28, 0x0a, 0x0a, 0x5c, 0x00, 0x01, 0x44, 0x07, 0x10, 0xe5, 0x50, 0x07, 0x0f, 0xf8, 0x00, 0x69, 0x00, 0x7c, 0x00, 0x00, 0x84, 0x00, 0x1f, 
+  0x29, 0x28, 0x19, 0x03, 0x10, 0xc7, 0x20, 0x00, 0x04, 0x04, 0x00, 0x0f, 0x00, 0x0f, 0x05, 0x00, 0x20, 0x00, 0x48, 0x28, 0x20, 0xce, 0xd4, 0xe0, 0x00, 0x00, 0x14, 0x0f, 0x00, 0x18, 0x00, 0x04, 
+  0x04, 0x00, 0x0f, 0x00, 0x11, 0x06, 0x0f, 0x7c, 0x19, 0x00, 0x04, 0x34, 0x00, 0x0f, 0x08, 0x00, 0x09, 0x00, 0xf8, 0x05, 0x08, 0x70, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x14, 0x00, 0x0f, 0x34, 0x00, 
+  0x09, 0x0f, 0x1c, 0x00, 0x05, 0x03, 0x84, 0x1a, 0x09, 0xf8, 0x0a, 0x03, 0x50, 0x00, 0x18, 0x6b, 0x34, 0x00, 0x1b, 0x28, 0x00, 0x11, 0x00, 0xc8, 0x16, 0x04, 0x20, 0x00, 0x0c, 0x18, 0x03, 0x1f, 
+  0x29, 0x00, 0x13, 0x02, 0x00, 0x84, 0x1e, 0x01, 0xf8, 0x01, 0x08, 0x6c, 0x00, 0x10, 0xe6, 0x84, 0x12, 0x04, 0x48, 0x00, 0x0f, 0x08, 0x00, 0x15, 0x00, 0xec, 0x00, 0x00, 0xa4, 0x00, 0x08, 0x04, 
+  0x00, 0x00, 0x14, 0x00, 0x0f, 0x40, 0x00, 0x15, 0x04, 0x28, 0x00, 0x00, 0xb4, 0x17, 0x0f, 0xf8, 0x04, 0x01, 0x0f, 0x00, 0x13, 0x11, 0x44, 0x28, 0x21, 0xcf, 0x8b, 0x48, 0x00, 0x00, 0xbc, 0x16, 
+  0x09, 0x8c, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x0d, 0x24, 0x01, 0x03, 0x64, 0x04, 0x00, 0x84, 0x14, 0x04, 0x48, 0x00, 0x0f, 0x08, 0x00, 0x15, 0x00, 0xec, 0x00, 0x08, 0x70, 0x00, 0x00, 0x0c, 0x00, 
+  0x00, 0x14, 0x00, 0x0f, 0x40, 0x00, 0x15, 0x04, 0x28, 0x00, 0x40, 0x29, 0x21, 0xce, 0x99, 0x3c, 0x00, 0x0d, 0x04, 0x00, 0x34, 0x20, 0xcf, 0x8c, 0x24, 0x00, 0x00, 0x08, 0x00, 0x00, 0xe4, 0x03, 
+  0x0c, 0x00, 0x15, 0x40, 0x28, 0x23, 0xcd, 0x33, 0x1c, 0x00, 0x04, 0x04, 0x00, 0x4b, 0x29, 0x21, 0xcf, 0xd7, 0x48, 0x00, 0x14, 0x81, 0x1c, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x00, 0x17, 0x07, 0x00, 
+  0x30, 0x14, 0x20, 0xce, 0x54, 0x24, 0x00, 0x0f, 0x04, 0x00, 0x15, 0x00, 0xec, 0x00, 0x0b, 0x6c, 0x00, 0x0f, 0x00, 0x0f, 0x1e, 0x4c, 0x29, 0x20, 0xcf, 0x56, 0x44, 0x00, 0x01, 0x10, 0x00, 0x30, 
+  0x20, 0xce, 0xf2, 0xb4, 0x05, 0x08, 0x8c, 0x00, 0x00, 0xb0, 0x09, 0x01, 0x1c, 0x00, 0x04, 0xb4, 0x01, 0x38, 0x21, 0xcf, 0xd5, 0x20, 0x00, 0x00, 0x0c, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x0d, 0x28, 
+  0x19, 0x0c, 0x24, 0x00, 0x04, 0x54, 0x00, 0x01, 0x70, 0x02, 0x30, 0x1f, 0xcc, 0x38, 0x48, 0x00, 0x0f, 0x04, 0x00, 0x11, 0x0f, 0x00, 0x01, 0x2d, 0x00, 0x2c, 0x1a, 0x0f, 0x90, 0x16, 0x03, 0x20, 
+  0xcf, 0xff, 0xf8, 0x1c, 0x08, 0x84, 0x00, 0x00, 0xcc, 0x14, 0x0f, 0x00, 0x19, 0x11, 0x02, 0x4c, 0x03, 0x24, 0xce, 0xef, 0xd4, 0x00, 0x03, 0x08, 0x00, 0x09, 0x04, 0x02, 0x00, 0x5c, 0x1a, 0x00, 
+  0x64, 0x1a, 0x03, 0x1c, 0x00, 0x08, 0x08, 0x04, 0x50, 0xff, 0x28, 0x21, 0xce, 0xed, 0x98, 0x19, 0x08, 0x7c, 0x00, 0x0f, 0x0c, 0x00, 0x05, 0x00, 0xc0, 0x00, 0x00, 0x64, 0x05, 0x08, 0x04, 0x00, 
+  0x00, 0x14, 0x00, 0x0f, 0x30, 0x00, 0x05, 0x08, 0x18, 0x00, 0x00, 0x28, 0x00, 0x00, 0x6c, 0x00, 0x0f, 0x84, 0x00, 0x01, 0x40, 0x29, 0x21, 0xce, 0xcd, 0xa4, 0x00, 0x09, 0x30, 0x00, 0x38, 0x20, 
+  0xce, 0x84, 0x2c, 0x00, 0x00, 0xe0, 0x1d, 0x0f, 0xb4, 0x04, 0x05, 0x0c, 0x28, 0x02, 0x40, 0x29, 0x21, 0xcf, 0xf7, 0x50, 0x20, 0x09, 0x50, 0x00, 0x40, 0x21, 0xd0, 0x26, 0x29, 0x6c, 0x1c, 0x03, 
+  0x4c, 0x02, 0x0b, 0x5c, 0x00, 0x10, 0xf4, 0x54, 0x14, 0x08, 0x30, 0x00, 0x0f, 0x0c, 0x00, 0x39, 0x00, 0xf4, 0x02, 0x0f, 0xf8, 0x01, 0x05, 0x4c, 0x29, 0x20, 0xcf, 0xf1, 0xac, 0x00, 0x0f, 0x00, 
+  0x1d, 0x04, 0x09, 0xd4, 0x01, 0x08, 0xa0, 0x00, 0x00, 0xfc, 0x0d, 0x0e, 0x5c, 0x01, 0x20, 0xce, 0xb9, 0x60, 0x13, 0x09, 0x28, 0x00, 0x3f, 0x1f, 0xcf, 0x51, 0x00, 0x1f, 0x07, 0x01, 0x44, 0x16, 
+  0x1f, 0x96, 0x64, 0x01, 0x05, 0x08, 0x48, 0x00, 0x0f, 0x0c, 0x00, 0x15, 0x00, 0x9c, 0x02, 0x0f, 0xec, 0x04, 0x06, 0x02, 0x88, 0x01, 0x5a, 0xfc, 0x2a, 0x20, 0xcd, 0x4e, 0x50, 0x00, 0x68, 0xff, 
+  0x01, 0x28, 0x20, 0xcf, 0xbb, 0xa0, 0x01, 0x00, 0xf0, 0x10, 0x4a, 0x2d, 0x1e, 0xd2, 0x11, 0x28, 0x00, 0x0a, 0x0e, 0x00, 0x00, 0x8c, 0x22, 0x09, 0x34, 0x00, 0x01, 0x9c, 0x13, 0x0e, 0x9c, 0x0d, 
+  0x0c, 0x4c, 0x0b, 0x0c, 0x34, 0x00, 0x00, 0x90, 0x14, 0x00, 0x24, 0x00, 0x00, 0xa0, 0x08, 0x0a, 0x62, 0x00, 0x0f, 0x0e, 0x00, 0x17, 0x00, 0x3c, 0x00, 0x00, 0xd8, 0x11, 0x0f, 0xe4, 0x06, 0x01, 
+  0x06, 0x70, 0x00, 0x6c, 0xce, 0xfe, 0x28, 0x20, 0xcf, 0x65, 0x56, 0x00, 0x46, 0x29, 0x20, 0xce, 0x74, 0x24, 0x00, 0x02, 0xb8, 0x07, 0x0f, 0xb0, 0x19, 0x13, 0x2c, 0xff, 0x02, 0xf0, 0x09, 0x00, 
+  0x4c, 0x22, 0x0f, 0xdc, 0x03, 0x01, 0x00, 0xe0, 0x00, 0x0f, 0x08, 0x02, 0x09, 0x03, 0x80, 0x00, 0x10, 0xe5, 0x9c, 0x0e, 0x00, 0xa4, 0x16, 0x0c, 0xa4, 0x00, 0x0f, 0x10, 0x00, 0x05, 0x01, 0xd0, 
+  0x0b, 0x02, 0xd4, 0x0a, 0x0f, 0x0c, 0x24, 0x0d, 0x00, 0x00, 0x23, 0x0d, 0xfc, 0x00, 0x40, 0x27, 0x23, 0xce, 0x3a, 0xb4, 0x00, 0x03, 0x80, 0x00, 0x01, 0xa8, 0x04, 0x4f, 0x28, 0x21, 0xce, 0xc8, 
+  0x00, 0x23, 0x11, 0x00, 0x94, 0x00, 0x00, 0x2c, 0x24, 0x00, 0xd4, 0x05, 0x09, 0x40, 0x00, 0x3c, 0x20, 0xce, 0xe9, 0x60, 0x03, 0x00, 0x2c, 0x00, 0x00, 0x78, 0x21, 0x0f, 0x10, 0x04, 0x05, 0x08, 
+  0x40, 0x00, 0x00, 0x0c, 0x00, 0x01, 0xc8, 0x01, 0x00, 0xa8, 0x15, 0x00, 0x68, 0x21, 0x30, 0x1f, 0xcd, 0x68, 0x48, 0x12, 0x00, 0x04, 0x00, 0x01, 0xc4, 0x09, 0x00, 0x14, 0x00, 0x31, 0x20, 0xce, 
+  0xad, 0x24, 0x00, 0x02, 0xd4, 0x02, 0x01, 0xb8, 0x00, 0x00, 0x38, 0x00, 0x0f, 0x04, 0x00, 0x02, 0x00, 0xf0, 0x03, 0x0d, 0xf4, 0x02, 0x22, 0x00, 0x00, 0xf4, 0x03, 0x28, 0xcf, 0xea, 0x34, 0x00, 
+  0x00, 0x14, 0x1e, 0x00, 0xb8, 0x21, 0x00, 0xb0, 0x00, 0x0f, 0x04, 0x00, 0x15, 0x00, 0x34, 0x26, 0x08, 0x44, 0x00, 0x02, 0x0c, 0x00, 0x2f, 0xce, 0xdd, 0xf0, 0x1c, 0x01, 0x00, 0x74, 0x00, 0x0f, 
+  0x18, 0x06, 0x05, 0x02, 0x38, 0x00, 0x02, 0x80, 0x02, 0x0f, 0x0c, 0x00, 0x37, 0x2f, 0xce, 0xcd, 0x8c, 0x01, 0x01, 0x00, 0x9c, 0x00, 0x0f, 0xb0, 0x16, 0x01, 0x4f, 0x29, 0x20, 0xcd, 0x5d, 0xf8, 
+  0x00, 0x15, 0x08, 0x28, 0x00, 0x4b, 0x29, 0x21, 0xce, 0x9a, 0xb4, 0x00, 0x09, 0x10, 0x22, 0x08, 0x2c, 0x00, 0x00, 0x78, 0x06, 0x40, 0x29, 0x20, 0xcf, 0x75, 0x6c, 0x01, 0x0b, 0x34, 0x00, 0x0f, 
+  0xc8, 0x01, 0x0b, 0x0f, 0xec, 0x01, 0x11, 0x04, 0x24, 0x00, 0x30, 0x20, 0xce, 0xf2, 0xe0, 0x07, 0x00, 0x6c, 0x00, 0x08, 0x7c, 0x00, 0x08, 0x0c, 0x00, 0x0c, 0x00, 0x29, 0x48, 0x28, 0x21, 0xcf, 
+  0x97, 0x20, 0x00, 0x0f, 0x0c, 0x00, 0x19, 0x00, 0x3c, 0x2a, 0x43, 0x29, 0x20, 0xce, 0xb3, 0xd0, 0x00, 0x0f, 0xfc, 0x00, 0x06, 0x08, 0x54, 0x00, 0x01, 0x30, 0x1c, 0x3c, 0x20, 0xce, 0x8e, 0x40, 
+  0x03, 0x03, 0x44, 0x00, 0x0f, 0x0c, 0x01, 0x22, 0x01, 0x4c, 0x00, 0x3c, 0x20, 0xce, 0x8d, 0xd8, 0x09, 0x08, 0x78, 0x00, 0x08, 0x0c, 0x00, 0x05, 0x04, 0x01, 0x01, 0xc8, 0x0c, 0x28, 0xaa, 0x03, 
+  0x1c, 0x00, 0x0f, 0x0c, 0x00, 0x1d, 0x00, 0x44, 0x2c, 0x00, 0x0c, 0x2a, 0x0f, 0x38, 0x00, 0x1d, 0x02, 0x4c, 0x07, 0x20, 0xcf, 0x6c, 0x78, 0x04, 0x0f, 0x40, 0x10, 0x01, 0x0f, 0x10, 0x01, 0x0f, 
+  0x01, 0x94, 0x1e, 0x50, 0xc7, 0x28, 0x21, 0xcf, 0x6b, 0xbc, 0x0e, 0x0f, 0x80, 0x00, 0x1d, 0x00, 0xb4, 0x00, 0x00, 0xbc, 0x00, 0x0f, 0x38, 0x00, 0x1d, 0x0f, 0x30, 0x00, 0x41, 0x00, 0x88, 0x10, 
+  0x40, 0x29, 0x20, 0xd0, 0x57, 0x44, 0x0d, 0x40, 0x28, 0x21, 0xcf, 0xb7, 0x6c, 0x23, 0x00, 0x68, 0x08, 0x00, 0x5c, 0x17, 0x01, 0x04, 0x00, 0x01, 0x64, 0x19, 0x23, 0xce, 0xd8, 0x1c, 0x00, 0x10, 
+  0x8f, 0x2c, 0x00, 0x00, 0x34, 0x00, 0x0f, 0x8c, 0x00, 0x41, 0x0f, 0x54, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x65, 0x6d, 0x65, 
+  0x72, 0x67, 0x65, 0x6e, 0x63, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x80, 0x42, 0x01, 0x00, 0x00, 0xcf, 0x21, 0x29, 0xff, 0x23, 0x00, 0x84, 
+  0x00, 0x4d, 0x4c, 0x4c, 0x4c, 0x4c, 0x4d, 0x4c, 0x4c, 0x4c, 0x4c, 0x4d, 0x43, 0x43, 0x43, 0x43, 0x4d, 0x43, 0x43, 0x43, 0x43, 0x4d, 0x43, 0x43, 0x4c, 0x43, 0x43, 0x4c, 0x4d, 0x43, 0x43, 0x4c, 
+  0x43, 0x43, 0x5a, 0x4d, 0x00, 0xa8, 0xea, 0x41, 0x00, 0x00, 0x20, 0x42, 0x00, 0xac, 0x0a, 0x42, 0x00, 0x00, 0x20, 0x42, 0x00, 0xac, 0x0a, 0x42, 0x00, 0x54, 0x35, 0x42, 0x00, 0xa8, 0xea, 0x41, 
+  0x00, 0x54, 0x35, 0x42, 0x00, 0xa8, 0xea, 0x41, 0x00, 0x00, 0x20, 0x42, 0x00, 0xa8, 0xea, 0x41, 0x00, 0x58, 0x95, 0x41, 0x00, 0xac, 0x0a, 0x42, 0x00, 0x58, 0x95, 0x41, 0x00, 0xac, 0x0a, 0x42, 
+  0x00, 0xac, 0x0a, 0x42, 0x00, 0xa8, 0xea, 0x41, 0x00, 0xac, 0x0a, 0x42, 0x00, 0xa8, 0xea, 0x41, 0x00, 0x58, 0x95, 0x41, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x41, 0x00, 0xf8, 0x95, 0x41, 
+  0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0xf8, 0x95, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x41, 0x00, 0x04, 0x35, 0x42, 0x00, 0xf8, 0x95, 0x41, 
+  0x00, 0x00, 0x60, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x60, 0x42, 0x00, 0x04, 0x35, 0x42, 0x00, 0x00, 0x60, 0x42, 0x00, 0x00, 0x60, 0x42, 0x00, 0x04, 0x35, 0x42, 0x00, 0x00, 0x60, 0x42, 
+  0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x60, 0x42, 0x00, 0xf8, 0x95, 0x41, 0x00, 0x04, 0x35, 0x42, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x42, 
+  0x00, 0xac, 0x4a, 0x42, 0x00, 0xa8, 0xad, 0x41, 0x00, 0xac, 0x4a, 0x42, 0x00, 0x50, 0x55, 0x41, 0x00, 0x2c, 0x29, 0x42, 0x00, 0x50, 0x55, 0x41, 0x00, 0x00, 0x00, 0x42, 0x00, 0x50, 0x55, 0x41, 
+  0x00, 0xa8, 0xad, 0x41, 0x00, 0xa8, 0xad, 0x41, 0x00, 0x50, 0x55, 0x41, 0x00, 0x00, 0x00, 0x42, 0x00, 0x50, 0x55, 0x41, 0x00, 0x2c, 0x29, 0x42, 0x00, 0x50, 0x55, 0x41, 0x00, 0xac, 0x4a, 0x42, 
+  0x00, 0xa8, 0xad, 0x41, 0x00, 0xac, 0x4a, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0xac, 0x4a, 0x42, 0x00, 0x2c, 0x29, 0x42, 0x00, 0x2c, 0x29, 0x42, 0x00, 0xac, 0x4a, 0x42, 0x00, 0x00, 0x00, 0x42, 
+  0x00, 0xac, 0x4a, 0x42, 0x00, 0xac, 0x5a, 0x42, 0x00, 0xac, 0x5a, 0x42, 0x00, 0xb4, 0x71, 0x42, 0x00, 0x50, 0x43, 0x42, 0x00, 0x00, 0x80, 0x42, 0x00, 0x50, 0x23, 0x42, 0x00, 0x00, 0x80, 0x42, 
+  0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x80, 0x42, 0x00, 0x60, 0xb9, 0x41, 0x00, 0xb4, 0x71, 0x42, 0x00, 0xc0, 0x72, 0x41, 0x00, 0xac, 0x5a, 0x42, 0x00, 0x50, 0x15, 0x41, 0x00, 0x24, 0x4f, 0x42, 
+  0x00, 0x70, 0x43, 0x41, 0x00, 0x68, 0x63, 0x42, 0x00, 0xa8, 0x8a, 0x41, 0x00, 0x00, 0x70, 0x42, 0x00, 0x58, 0xc2, 0x41, 0x00, 0x00, 0x70, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x70, 0x42, 
+  0x00, 0xf0, 0x1e, 0x42, 0x00, 0x68, 0x63, 0x42, 0x00, 0xac, 0x3a, 0x42, 0x00, 0x24, 0x4f, 0x42, 0x00, 0x24, 0x4f, 0x42, 0x00, 0xac, 0x5a, 0x42, 0x00, 0xac, 0x5a, 0x42, 0x00, 0x70, 0x43, 0x41, 
+  0x00, 0x24, 0x4f, 0x42, 0x01, 0xc0, 0xe4, 0x40, 0x00, 0xac, 0x3a, 0x42, 0x00, 0x00, 0x80, 0x40, 0x00, 0xf0, 0x1e, 0x42, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x80, 0x40, 
+  0x00, 0x58, 0xc2, 0x41, 0x01, 0xc0, 0xe4, 0x40, 0x00, 0xa8, 0x8a, 0x41, 0x00, 0x70, 0x43, 0x41, 0x00, 0x70, 0x43, 0x41, 0x00, 0x50, 0x15, 0x41, 0x00, 0x50, 0x15, 0x41, 0x01, 0xc0, 0x64, 0x40, 
+  0x00, 0xc0, 0x72, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xb9, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x23, 0x42, 0x01, 0xc0, 0x64, 0x40, 
+  0x00, 0x50, 0x43, 0x42, 0x00, 0x50, 0x15, 0x41, 0x00, 0xac, 0x5a, 0x42, 0x00, 0x70, 0x43, 0x41, 0x00, 0x24, 0x4f, 0x42, 
 };
 
 const lv_img_dsc_t emergency = {
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .header.cf = LV_IMG_CF_USER_ENCODED_0,
   .header.always_zero = 0,
   .header.reserved = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+  .data_size = 3860,
   .data = emergency_map,
 };
@@ -22,209 +22,81 @@
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_COOLDOWN_IMG uint8_t cooldown_img_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x32, 0x9f, 0xe3, 0x9f, 0x41, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x3b, 0x9f, 0xe3, 0x9f, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x33, 0x9f, 0xed, 0x9f, 0xff, 0x9f, 0xf5, 0x9f, 0x41, 0x9f, 0x3b, 0x9f, 0xf2, 0x9f, 0xff, 0x9f, 0xf0, 0x9f, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x0a, 0x9f, 0xe7, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xf3, 0x9f, 0xf3, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xe7, 0x9f, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x3e, 0x9f, 0xf4, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xf6, 0x9f, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x3e, 0x9f, 0xf4, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xf6, 0x9f, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x44, 0x9f, 0xfa, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xfa, 0x9f, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x04, 0x9f, 0x3a, 0x9f, 0x7f, 0x9f, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xea, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x52, 0x9f, 0x7e, 0x9f, 0x39, 0x9f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x2f, 0x9f, 0xf0, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xea, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xb1, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xf0, 0x9f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x08, 0x9f, 0xf7, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xea, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x04, 0x9f, 0xf0, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xf9, 0x9f, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xbd, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xea, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x3a, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x11, 0x9f, 0xa3, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x0c, 0x9f, 0x85, 0x9f, 0xfb, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xfb, 0x9f, 0x83, 0x9f, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x8a, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xa6, 0x9f, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x6d, 0x9f, 0xc9, 0x9f, 0xfc, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xab, 0x9f, 0x22, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x01, 0x9f, 0x5e, 0x9f, 0xe5, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xe2, 0x9f, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x2c, 0x9f, 0xba, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xfc, 0x9f, 0xcb, 0x9f, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x92, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xf8, 0x9f, 0x8a, 0x9f, 0x43, 0x9f, 0xc8, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xbe, 0x9f, 0x3f, 0x9f, 0x98, 0x9f, 0xfc, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x4d, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x0d, 0x9f, 0xfa, 0x9f, 0xe7, 0x9f, 0xa4, 0x9f, 0x60, 0x9f, 0x2a, 0x9f, 0x8f, 0x9f, 0xfa, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xdf, 0x9f, 0x54, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x54, 0x9f, 0xdf, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xfa, 0x9f, 0x92, 0x9f, 0x2a, 0x9f, 0x5f, 0x9f, 0xa3, 0x9f, 0xe6, 0x9f, 0xfc, 0x9f, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x23, 0x1f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x26, 0x9f, 0xb0, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xf4, 0x9f, 0x7d, 0x9f, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x09, 0x9f, 0x7d, 0x9f, 0xf4, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xb3, 0x9f, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x94, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x41, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x87, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x35, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x87, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x35, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x87, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x35, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x87, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x35, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x92, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x41, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x22, 0x9f, 0xab, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xf4, 0x9f, 0x7d, 0x9f, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x09, 0x9f, 0x7d, 0x9f, 0xf4, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xb3, 0x9f, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x0d, 0x9f, 0xfa, 0x9f, 0xe3, 0x9f, 0x9f, 0x9f, 0x5b, 0x9f, 0x25, 0x9f, 0x8a, 0x9f, 0xf8, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xdf, 0x9f, 0x54, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x54, 0x9f, 0xdf, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xfa, 0x9f, 0x92, 0x9f, 0x2a, 0x9f, 0x5f, 0x9f, 0xa3, 0x9f, 0xe6, 0x9f, 0xfc, 0x9f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x4c, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x90, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xfc, 0x9f, 0x98, 0x9f, 0x3f, 0x9f, 0xbe, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xc5, 0x9f, 0x3e, 0x9f, 0x85, 0x9f, 0xf6, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x70, 0x9f, 0xce, 0x9f, 0xfd, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xba, 0x9f, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x56, 0x9f, 0xe2, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xe4, 0x9f, 0x5b, 0x1f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x1f, 0x9f, 0xa7, 0x9f, 0xfe, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xfc, 0x9f, 0xc9, 0x9f, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x14, 0x9f, 0xa4, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x0a, 0x9f, 0x83, 0x9f, 0xfb, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xfb, 0x9f, 0x84, 0x9f, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x6e, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xa3, 0x9f, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xbc, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xea, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x1f, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x08, 0x9f, 0xf6, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xf2, 0x7b, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xea, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xdb, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xf7, 0x9f, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x2f, 0x9f, 0xf0, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xea, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x97, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xf0, 0x9f, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x04, 0x9f, 0x39, 0x9f, 0x7e, 0x9f, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xea, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x3f, 0x9f, 0x7f, 0x9f, 0x3a, 0x9f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x44, 0x9f, 0xfa, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xfa, 0x9f, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x3e, 0x9f, 0xf4, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xf6, 0x9f, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x3e, 0x9f, 0xf4, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xf5, 0x9f, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x0a, 0x9f, 0xe7, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xf3, 0x9f, 0xf3, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xe4, 0x9f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x32, 0x9f, 0xed, 0x9f, 0xff, 0x9f, 0xf5, 0x9f, 0x41, 0x9f, 0x3b, 0x9f, 0xf2, 0x9f, 0xff, 0x9f, 0xf0, 0x9f, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x32, 0x9f, 0xe2, 0x9f, 0x41, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x3b, 0x9f, 0xe3, 0x9f, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x76, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x76, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x32, 0x1f, 0x87, 0xe3, 0x1f, 0x87, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x3b, 0x1f, 0x87, 0xe3, 0x1f, 0x87, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x33, 0x1f, 0x87, 0xed, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xf5, 0x1f, 0x87, 0x41, 0x1f, 0x87, 0x3b, 0x1f, 0x87, 0xf2, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xf0, 0x1f, 0x7f, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x87, 0x0a, 0x1f, 0x87, 0xe7, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xf3, 0x1f, 0x87, 0xf3, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xe7, 0x3f, 0x87, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x7f, 0x3e, 0x1f, 0x87, 0xf4, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xf6, 0x1f, 0x7f, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x7f, 0x3e, 0x1f, 0x87, 0xf4, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xf6, 0x1f, 0x7f, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x7f, 0x44, 0x1f, 0x87, 0xfa, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xfa, 0x1f, 0x7f, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x87, 0x04, 0x1f, 0x7f, 0x3a, 0x1f, 0x87, 0x7f, 0x1f, 0x87, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0xea, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x52, 0x1f, 0x87, 0x7e, 0x1f, 0x87, 0x39, 0xff, 0x87, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x2f, 0x1f, 0x87, 0xf0, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0xea, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0xb1, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xf0, 0x1f, 0x87, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x08, 0x1f, 0x87, 0xf7, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0xea, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x87, 0x04, 0x1f, 0x87, 0xf0, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xf9, 0x5f, 0x77, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0xbd, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0xff, 0x86, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0xea, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x7f, 0x3a, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x7f, 0x11, 0x1f, 0x87, 0xa3, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x87, 0x0c, 0x1f, 0x87, 0x85, 0x1f, 0x87, 0xfb, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xfb, 0x1f, 0x87, 0x83, 0x3f, 0x87, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x8a, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xa6, 0x3f, 0x87, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x7f, 0x6d, 0x1f, 0x87, 0xc9, 0x1f, 0x87, 0xfc, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xab, 0x1f, 0x87, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0x01, 0x1f, 0x87, 0x5e, 0x1f, 0x87, 0xe5, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xe2, 0x1f, 0x87, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x87, 0x2c, 0x1f, 0x87, 0xba, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xfc, 0x1f, 0x87, 0xcb, 0x1f, 0x87, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x92, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xf8, 0x1f, 0x87, 0x8a, 0x1f, 0x87, 0x43, 0x1f, 0x87, 0xc8, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xbe, 0x1f, 0x87, 0x3f, 0x1f, 0x87, 0x98, 0x1f, 0x87, 0xfc, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x4d, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xbf, 0x1f, 0x87, 0xbf, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x7e, 0x0d, 0x1f, 0x87, 0xfa, 0x1f, 0x87, 0xe7, 0x1f, 0x87, 0xa4, 0x1f, 0x87, 0x60, 0x1f, 0x87, 0x2a, 0x1f, 0x87, 0x8f, 0x1f, 0x87, 0xfa, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xdf, 0x1f, 0x87, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x54, 0x1f, 0x87, 0xdf, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xfa, 0x1f, 0x87, 0x92, 0x1f, 0x87, 0x2a, 0x1f, 0x87, 0x5f, 0x1f, 0x87, 0xa3, 0x1f, 0x87, 0xe6, 0x1f, 0x87, 0xfc, 0x1f, 0x7f, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x7f, 0x23, 0xff, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x86, 0x26, 0x1f, 0x87, 0xb0, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xf4, 0x1f, 0x87, 0x7d, 0x3f, 0x77, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x77, 0x09, 0x1f, 0x87, 0x7d, 0x1f, 0x87, 0xf4, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xb3, 0x1f, 0x87, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x7f, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x94, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x41, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x87, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x3f, 0x87, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x87, 0x35, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x87, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x3f, 0x87, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x87, 0x35, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x87, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x3f, 0x87, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x87, 0x35, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x87, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x3f, 0x87, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x87, 0x35, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x92, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x41, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x86, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x22, 0x1f, 0x87, 0xab, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xf4, 0x1f, 0x87, 0x7d, 0x3f, 0x77, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x77, 0x09, 0x1f, 0x87, 0x7d, 0x1f, 0x87, 0xf4, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xb3, 0x1f, 0x87, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x7f, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x7e, 0x0d, 0x1f, 0x87, 0xfa, 0x1f, 0x87, 0xe3, 0x1f, 0x87, 0x9f, 0x1f, 0x87, 0x5b, 0xff, 0x86, 0x25, 0x1f, 0x87, 0x8a, 0x1f, 0x87, 0xf8, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xdf, 0x1f, 0x87, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x54, 0x1f, 0x87, 0xdf, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xfa, 0x1f, 0x87, 0x92, 0x1f, 0x87, 0x2a, 0x1f, 0x87, 0x5f, 0x1f, 0x87, 0xa3, 0x1f, 0x87, 0xe6, 0x1f, 0x87, 0xfc, 0x1f, 0x87, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x4c, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xbf, 0x1f, 0x87, 0xbf, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x90, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xfc, 0x1f, 0x87, 0x98, 0x1f, 0x87, 0x3f, 0x1f, 0x87, 0xbe, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xc5, 0x1f, 0x7f, 0x3e, 0x1f, 0x87, 0x85, 0x1f, 0x87, 0xf6, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x70, 0x1f, 0x87, 0xce, 0x1f, 0x87, 0xfd, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xba, 0x3f, 0x87, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x56, 0x1f, 0x87, 0xe2, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xe4, 0x1f, 0x87, 0x5b, 0xff, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x7f, 0x1f, 0x1f, 0x87, 0xa7, 0x1f, 0x87, 0xfe, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xfc, 0x1f, 0x87, 0xc9, 0x1f, 0x7f, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x87, 0x14, 0x1f, 0x87, 0xa4, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x87, 0x0a, 0x1f, 0x87, 0x83, 0x1f, 0x87, 0xfb, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xfb, 0x1f, 0x87, 0x84, 0x5f, 0x77, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x6e, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xa3, 0x1f, 0x7f, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0xbc, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0xea, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x7f, 0x1f, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x08, 0x1f, 0x87, 0xf6, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xf2, 0x7f, 0x6e, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0xea, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0xdb, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xf7, 0x3f, 0x77, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x2f, 0x1f, 0x87, 0xf0, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0xea, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x97, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xf0, 0x1f, 0x87, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x87, 0x04, 0x1f, 0x87, 0x39, 0x1f, 0x87, 0x7e, 0x1f, 0x87, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0xea, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x3f, 0x1f, 0x87, 0x7f, 0x1f, 0x7f, 0x3a, 0xff, 0x87, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x7f, 0x44, 0x1f, 0x87, 0xfa, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xfa, 0x1f, 0x87, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x7f, 0x3e, 0x1f, 0x87, 0xf4, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xf6, 0x1f, 0x87, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x7f, 0x3e, 0x1f, 0x87, 0xf4, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xf5, 0x1f, 0x7f, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x87, 0x0a, 0x1f, 0x87, 0xe7, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xf3, 0x1f, 0x87, 0xf3, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xe4, 0x1f, 0x87, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x32, 0x1f, 0x87, 0xed, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xf5, 0x1f, 0x87, 0x41, 0x1f, 0x87, 0x3b, 0x1f, 0x87, 0xf2, 0x1f, 0x87, 0xff, 0x1f, 0x87, 0xf0, 0xff, 0x7e, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x32, 0x1f, 0x87, 0xe2, 0x1f, 0x87, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0x3b, 0x1f, 0x87, 0xe3, 0xff, 0x7e, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x76, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x76, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x32, 0x87, 0x1f, 0xe3, 0x87, 0x1f, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x3b, 0x87, 0x1f, 0xe3, 0x87, 0x1f, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x33, 0x87, 0x1f, 0xed, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xf5, 0x87, 0x1f, 0x41, 0x87, 0x1f, 0x3b, 0x87, 0x1f, 0xf2, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xf0, 0x7f, 0x1f, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x3f, 0x0a, 0x87, 0x1f, 0xe7, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xf3, 0x87, 0x1f, 0xf3, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xe7, 0x87, 0x3f, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x1f, 0x3e, 0x87, 0x1f, 0xf4, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xf6, 0x7f, 0x1f, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x1f, 0x3e, 0x87, 0x1f, 0xf4, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xf6, 0x7f, 0x1f, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x1f, 0x44, 0x87, 0x1f, 0xfa, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xfa, 0x7f, 0x1f, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0x04, 0x7f, 0x1f, 0x3a, 0x87, 0x1f, 0x7f, 0x87, 0x1f, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0xea, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x52, 0x87, 0x1f, 0x7e, 0x87, 0x1f, 0x39, 0x87, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x2f, 0x87, 0x1f, 0xf0, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0xea, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0xb1, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xf0, 0x87, 0x1f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x08, 0x87, 0x1f, 0xf7, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0xea, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0x04, 0x87, 0x1f, 0xf0, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xf9, 0x77, 0x5f, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0xbd, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x86, 0xff, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0xea, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x1f, 0x3a, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x1f, 0x11, 0x87, 0x1f, 0xa3, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x5f, 0x0c, 0x87, 0x1f, 0x85, 0x87, 0x1f, 0xfb, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xfb, 0x87, 0x1f, 0x83, 0x87, 0x3f, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x8a, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xa6, 0x87, 0x3f, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x1f, 0x6d, 0x87, 0x1f, 0xc9, 0x87, 0x1f, 0xfc, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xab, 0x87, 0x1f, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x01, 0x87, 0x1f, 0x5e, 0x87, 0x1f, 0xe5, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xe2, 0x87, 0x1f, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x3f, 0x2c, 0x87, 0x1f, 0xba, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xfc, 0x87, 0x1f, 0xcb, 0x87, 0x1f, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x92, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xf8, 0x87, 0x1f, 0x8a, 0x87, 0x1f, 0x43, 0x87, 0x1f, 0xc8, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xbe, 0x87, 0x1f, 0x3f, 0x87, 0x1f, 0x98, 0x87, 0x1f, 0xfc, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x4d, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xbf, 0x87, 0x1f, 0xbf, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xdf, 0x0d, 0x87, 0x1f, 0xfa, 0x87, 0x1f, 0xe7, 0x87, 0x1f, 0xa4, 0x87, 0x1f, 0x60, 0x87, 0x1f, 0x2a, 0x87, 0x1f, 0x8f, 0x87, 0x1f, 0xfa, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xdf, 0x87, 0x1f, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x54, 0x87, 0x1f, 0xdf, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xfa, 0x87, 0x1f, 0x92, 0x87, 0x1f, 0x2a, 0x87, 0x1f, 0x5f, 0x87, 0x1f, 0xa3, 0x87, 0x1f, 0xe6, 0x87, 0x1f, 0xfc, 0x7f, 0x1f, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x1f, 0x23, 0x07, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xff, 0x26, 0x87, 0x1f, 0xb0, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xf4, 0x87, 0x1f, 0x7d, 0x77, 0x3f, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x3f, 0x09, 0x87, 0x1f, 0x7d, 0x87, 0x1f, 0xf4, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xb3, 0x87, 0x1f, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x1f, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x94, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x41, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x87, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x3f, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x3f, 0x35, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x87, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x3f, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x3f, 0x35, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x87, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x3f, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x3f, 0x35, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x87, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x3f, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x3f, 0x35, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x92, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x41, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xff, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x22, 0x87, 0x1f, 0xab, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xf4, 0x87, 0x1f, 0x7d, 0x77, 0x3f, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x3f, 0x09, 0x87, 0x1f, 0x7d, 0x87, 0x1f, 0xf4, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xb3, 0x87, 0x1f, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x1f, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xdf, 0x0d, 0x87, 0x1f, 0xfa, 0x87, 0x1f, 0xe3, 0x87, 0x1f, 0x9f, 0x87, 0x1f, 0x5b, 0x86, 0xff, 0x25, 0x87, 0x1f, 0x8a, 0x87, 0x1f, 0xf8, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xdf, 0x87, 0x1f, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x54, 0x87, 0x1f, 0xdf, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xfa, 0x87, 0x1f, 0x92, 0x87, 0x1f, 0x2a, 0x87, 0x1f, 0x5f, 0x87, 0x1f, 0xa3, 0x87, 0x1f, 0xe6, 0x87, 0x1f, 0xfc, 0x87, 0x1f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x4c, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xbf, 0x87, 0x1f, 0xbf, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x90, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xfc, 0x87, 0x1f, 0x98, 0x87, 0x1f, 0x3f, 0x87, 0x1f, 0xbe, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xc5, 0x7f, 0x1f, 0x3e, 0x87, 0x1f, 0x85, 0x87, 0x1f, 0xf6, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x70, 0x87, 0x1f, 0xce, 0x87, 0x1f, 0xfd, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xba, 0x87, 0x3f, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x56, 0x87, 0x1f, 0xe2, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xe4, 0x87, 0x1f, 0x5b, 0x07, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x1f, 0x1f, 0x87, 0x1f, 0xa7, 0x87, 0x1f, 0xfe, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xfc, 0x87, 0x1f, 0xc9, 0x7f, 0x1f, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x3f, 0x14, 0x87, 0x1f, 0xa4, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x3f, 0x0a, 0x87, 0x1f, 0x83, 0x87, 0x1f, 0xfb, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xfb, 0x87, 0x1f, 0x84, 0x77, 0x5f, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x6e, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xa3, 0x7f, 0x1f, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0xbc, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0xea, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x1f, 0x1f, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x08, 0x87, 0x1f, 0xf6, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xf2, 0x6e, 0x7f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0xea, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0xdb, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xf7, 0x77, 0x3f, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x2f, 0x87, 0x1f, 0xf0, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0xea, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x97, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xf0, 0x87, 0x1f, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0x04, 0x87, 0x1f, 0x39, 0x87, 0x1f, 0x7e, 0x87, 0x1f, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0xea, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x3f, 0x87, 0x1f, 0x7f, 0x7f, 0x1f, 0x3a, 0x87, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x1f, 0x44, 0x87, 0x1f, 0xfa, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xfa, 0x87, 0x1f, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x1f, 0x3e, 0x87, 0x1f, 0xf4, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xf6, 0x87, 0x1f, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x1f, 0x3e, 0x87, 0x1f, 0xf4, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xf5, 0x7f, 0x1f, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x3f, 0x0a, 0x87, 0x1f, 0xe7, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xf3, 0x87, 0x1f, 0xf3, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xe4, 0x87, 0x1f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x32, 0x87, 0x1f, 0xed, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xf5, 0x87, 0x1f, 0x41, 0x87, 0x1f, 0x3b, 0x87, 0x1f, 0xf2, 0x87, 0x1f, 0xff, 0x87, 0x1f, 0xf0, 0x7e, 0xff, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x32, 0x87, 0x1f, 0xe2, 0x87, 0x1f, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x3b, 0x87, 0x1f, 0xe3, 0x7e, 0xff, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xda, 0x6d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xda, 0x6d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x7f, 0x32, 0xff, 0xdf, 0x7c, 0xe3, 0xff, 0xdf, 0x7d, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x7d, 0x3b, 0xff, 0xdf, 0x7c, 0xe3, 0xff, 0xde, 0x7d, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe1, 0x7d, 0x33, 0xfe, 0xdf, 0x7c, 0xed, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7c, 0xf5, 0xff, 0xdf, 0x7d, 0x41, 0xff, 0xe0, 0x7d, 0x3b, 0xff, 0xe0, 0x7d, 0xf2, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xf0, 0xfe, 0xdf, 0x7a, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe5, 0x7f, 0x0a, 0xff, 0xe0, 0x7c, 0xe7, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7c, 0xf3, 0xff, 0xdf, 0x7c, 0xf3, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7c, 0xe7, 0xff, 0xe5, 0x7f, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xde, 0x7b, 0x3e, 0xff, 0xdf, 0x7d, 0xf4, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xfe, 0xdf, 0x7d, 0xf6, 0xff, 0xe1, 0x7b, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xde, 0x7b, 0x3e, 0xff, 0xdf, 0x7d, 0xf4, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xfe, 0xdf, 0x7d, 0xf6, 0xff, 0xe1, 0x7b, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe1, 0x7b, 0x44, 0xff, 0xe0, 0x7d, 0xfa, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xfa, 0xff, 0xe1, 0x7b, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x04, 0xff, 0xe0, 0x7b, 0x3a, 0xff, 0xe0, 0x7c, 0x7f, 0xff, 0xe1, 0x7d, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x7d, 0xea, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xdf, 0x7c, 0x52, 0xfe, 0xe0, 0x7d, 0x7e, 0xff, 0xdf, 0x7d, 0x39, 0xff, 0xff, 0x7f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xde, 0x7c, 0x2f, 0xff, 0xe0, 0x7d, 0xf0, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7c, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x7d, 0xea, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x7d, 0xb1, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xf0, 0xff, 0xdf, 0x7f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x7f, 0x08, 0xff, 0xe0, 0x7c, 0xf7, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7d, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x7d, 0xea, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x04, 0xff, 0xe0, 0x7d, 0xf0, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7c, 0xf9, 0xff, 0xe7, 0x73, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x7d, 0xbd, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdc, 0x7c, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x7d, 0xea, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x7b, 0x3a, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xfe, 0xe0, 0x7d, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe1, 0x78, 0x11, 0xfe, 0xdf, 0x7d, 0xa3, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7c, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe9, 0x7f, 0x0c, 0xff, 0xe0, 0x7c, 0x85, 0xff, 0xdf, 0x7c, 0xfb, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7c, 0xfb, 0xff, 0xdf, 0x7c, 0x83, 0xff, 0xe5, 0x7f, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x7d, 0x8a, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7c, 0xa6, 0xff, 0xe2, 0x7f, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x7b, 0x6d, 0xff, 0xe0, 0x7d, 0xc9, 0xfe, 0xdf, 0x7d, 0xfc, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7d, 0xab, 0xff, 0xe1, 0x7f, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0xff, 0xe1, 0x7c, 0x5e, 0xfe, 0xdf, 0x7c, 0xe5, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xfe, 0xe0, 0x7d, 0xe2, 0xff, 0xe1, 0x7c, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe2, 0x7f, 0x2c, 0xff, 0xdf, 0x7c, 0xba, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xfe, 0xdf, 0x7d, 0xfc, 0xff, 0xdf, 0x7d, 0xcb, 0xfe, 0xdf, 0x7d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x7d, 0x92, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xf8, 0xff, 0xdf, 0x7d, 0x8a, 0xff, 0xe0, 0x7d, 0x43, 0xff, 0xe0, 0x7c, 0xc8, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7c, 0xbe, 0xfe, 0xde, 0x7d, 0x3f, 0xff, 0xe0, 0x7d, 0x98, 0xfe, 0xdf, 0x7d, 0xfc, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7c, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe1, 0x7d, 0x4d, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xfe, 0xe0, 0x7d, 0xbf, 0xfe, 0xe0, 0x7d, 0xbf, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xfe, 0xdf, 0x7c, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd7, 0x75, 0x0d, 0xff, 0xe0, 0x7d, 0xfa, 0xff, 0xe0, 0x7c, 0xe7, 0xfe, 0xdf, 0x7c, 0xa4, 0xff, 0xdf, 0x7c, 0x60, 0xff, 0xe0, 0x7f, 0x2a, 0xff, 0xe0, 0x7c, 0x8f, 0xff, 0xe0, 0x7d, 0xfa, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xfe, 0xe0, 0x7c, 0xdf, 0xff, 0xe0, 0x7c, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x7c, 0x54, 0xfe, 0xe0, 0x7c, 0xdf, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xfa, 0xff, 0xdf, 0x7d, 0x92, 0xff, 0xe0, 0x7f, 0x2a, 0xff, 0xde, 0x7e, 0x5f, 0xfe, 0xdf, 0x7d, 0xa3, 0xff, 0xdf, 0x7d, 0xe6, 0xfe, 0xdf, 0x7d, 0xfc, 0xff, 0xe1, 0x78, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe1, 0x7b, 0x23, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdd, 0x7f, 0x26, 0xff, 0xe0, 0x7c, 0xb0, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7d, 0xf4, 0xff, 0xe0, 0x7c, 0x7d, 0xff, 0xe2, 0x71, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe2, 0x71, 0x09, 0xff, 0xe0, 0x7c, 0x7d, 0xff, 0xdf, 0x7d, 0xf4, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7d, 0xb3, 0xff, 0xdf, 0x7f, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe1, 0x7b, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x7d, 0x94, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7d, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x7d, 0x41, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7d, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x7c, 0x87, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe2, 0x7d, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe2, 0x7d, 0x35, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x7c, 0x87, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe2, 0x7d, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe2, 0x7d, 0x35, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x7c, 0x87, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe2, 0x7d, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe2, 0x7d, 0x35, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x7c, 0x87, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe2, 0x7d, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe2, 0x7d, 0x35, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x7d, 0x92, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7d, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x7d, 0x41, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7d, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdd, 0x7f, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe1, 0x7f, 0x22, 0xff, 0xdf, 0x7d, 0xab, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7d, 0xf4, 0xff, 0xe0, 0x7c, 0x7d, 0xff, 0xe2, 0x71, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe2, 0x71, 0x09, 0xff, 0xe0, 0x7c, 0x7d, 0xff, 0xdf, 0x7d, 0xf4, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7d, 0xb3, 0xff, 0xdf, 0x7f, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe1, 0x7b, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd7, 0x75, 0x0d, 0xff, 0xe0, 0x7d, 0xfa, 0xff, 0xdf, 0x7c, 0xe3, 0xff, 0xe0, 0x7d, 0x9f, 0xfe, 0xe0, 0x7e, 0x5b, 0xff, 0xdc, 0x7c, 0x25, 0xff, 0xdf, 0x7d, 0x8a, 0xff, 0xe0, 0x7d, 0xf8, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xfe, 0xe0, 0x7c, 0xdf, 0xff, 0xe0, 0x7c, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x7c, 0x54, 0xfe, 0xe0, 0x7c, 0xdf, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xfa, 0xff, 0xdf, 0x7d, 0x92, 0xff, 0xe0, 0x7f, 0x2a, 0xff, 0xde, 0x7e, 0x5f, 0xfe, 0xdf, 0x7d, 0xa3, 0xff, 0xdf, 0x7d, 0xe6, 0xfe, 0xdf, 0x7d, 0xfc, 0xff, 0xdf, 0x7f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x7c, 0x4c, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xfe, 0xe0, 0x7d, 0xbf, 0xfe, 0xe0, 0x7d, 0xbf, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x7d, 0x90, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xfe, 0xdf, 0x7d, 0xfc, 0xff, 0xe0, 0x7d, 0x98, 0xfe, 0xde, 0x7d, 0x3f, 0xff, 0xe0, 0x7c, 0xbe, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xfe, 0xdf, 0x7d, 0xc5, 0xff, 0xde, 0x7b, 0x3e, 0xff, 0xe0, 0x7c, 0x85, 0xfe, 0xdf, 0x7d, 0xf6, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7c, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xdf, 0x7d, 0x70, 0xff, 0xe0, 0x7d, 0xce, 0xff, 0xdf, 0x7c, 0xfd, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7c, 0xba, 0xff, 0xe2, 0x7f, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe1, 0x7c, 0x56, 0xfe, 0xe0, 0x7d, 0xe2, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7d, 0xe4, 0xfe, 0xe0, 0x7e, 0x5b, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xde, 0x7b, 0x1f, 0xff, 0xe0, 0x7d, 0xa7, 0xff, 0xdf, 0x7d, 0xfe, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xfe, 0xdf, 0x7d, 0xfc, 0xff, 0xe0, 0x7d, 0xc9, 0xff, 0xe0, 0x7b, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe5, 0x7f, 0x14, 0xfe, 0xdf, 0x7c, 0xa4, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7d, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe5, 0x7f, 0x0a, 0xff, 0xdf, 0x7c, 0x83, 0xff, 0xdf, 0x7c, 0xfb, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7c, 0xfb, 0xff, 0xe0, 0x7d, 0x84, 0xff, 0xe7, 0x73, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x7d, 0x6e, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xfe, 0xdf, 0x7d, 0xa3, 0xff, 0xe1, 0x78, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x7c, 0xbc, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7d, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x7d, 0xea, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xde, 0x7b, 0x1f, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7c, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x7f, 0x08, 0xfe, 0xdf, 0x7d, 0xf6, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xf2, 0xff, 0xcc, 0x66, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x7d, 0xea, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x7c, 0xdb, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7c, 0xf7, 0xff, 0xe2, 0x71, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xde, 0x7c, 0x2f, 0xff, 0xe0, 0x7d, 0xf0, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7d, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x7d, 0xea, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x7c, 0x97, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xf0, 0xff, 0xde, 0x7c, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x04, 0xff, 0xdf, 0x7d, 0x39, 0xfe, 0xe0, 0x7d, 0x7e, 0xfe, 0xdf, 0x7c, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x7d, 0xea, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xde, 0x7d, 0x3f, 0xff, 0xe0, 0x7c, 0x7f, 0xff, 0xe0, 0x7b, 0x3a, 0xff, 0xff, 0x7f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe1, 0x7b, 0x44, 0xff, 0xe0, 0x7d, 0xfa, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xfa, 0xff, 0xe0, 0x7d, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xde, 0x7b, 0x3e, 0xff, 0xdf, 0x7d, 0xf4, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xfe, 0xdf, 0x7d, 0xf6, 0xff, 0xe0, 0x7d, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xde, 0x7b, 0x3e, 0xff, 0xdf, 0x7d, 0xf4, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7c, 0xf5, 0xff, 0xe0, 0x7b, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe5, 0x7f, 0x0a, 0xff, 0xe0, 0x7c, 0xe7, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7c, 0xf3, 0xff, 0xdf, 0x7c, 0xf3, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7d, 0xe4, 0xff, 0xdf, 0x7f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x7f, 0x32, 0xfe, 0xdf, 0x7c, 0xed, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7c, 0xf5, 0xff, 0xdf, 0x7d, 0x41, 0xff, 0xe0, 0x7d, 0x3b, 0xff, 0xe0, 0x7d, 0xf2, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xe0, 0x7d, 0xf0, 0xff, 0xdd, 0x7a, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x7f, 0x32, 0xfe, 0xe0, 0x7d, 0xe2, 0xff, 0xdf, 0x7d, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x7d, 0x3b, 0xff, 0xdf, 0x7c, 0xe3, 0xff, 0xdd, 0x7a, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xda, 0x6d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xda, 0x6d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
+  /*Packed: ARGB8888 + vector, 8464 bytes LZ4 compressed*/
+  0x47, 0x50, 0x01, 0x01, 0x00, 0x00, 0x00, 0xff, 0xc2, 0x05, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0xff, 0xff, 0x66, 0x4c, 0xfe, 0xda, 0x6d, 0x07, 0x7b, 0x02, 0x0f, 0x14, 0x00, 0x01, 0x0c, 0x24, 
+  0x00, 0x0f, 0x10, 0x00, 0x69, 0xc4, 0xff, 0xe0, 0x7f, 0x32, 0xff, 0xdf, 0x7c, 0xe3, 0xff, 0xdf, 0x7d, 0x41, 0x88, 0x00, 0x41, 0xff, 0xe0, 0x7d, 0x3b, 0x14, 0x00, 0x34, 0xde, 0x7d, 0x37, 0x14, 
+  0x00, 0x0f, 0x08, 0x00, 0x79, 0xf0, 0x01, 0xff, 0xe1, 0x7d, 0x33, 0xfe, 0xdf, 0x7c, 0xed, 0xff, 0xe0, 0x7d, 0xff, 0xff, 0xdf, 0x7c, 0xf5, 0xbc, 0x00, 0x01, 0xb4, 0x00, 0x31, 0xe0, 0x7d, 0xf2, 
+  0x14, 0x00, 0x7f, 0xe0, 0x7d, 0xf0, 0xfe, 0xdf, 0x7a, 0x38, 0xb4, 0x00, 0x7a, 0x73, 0xe5, 0x7f, 0x0a, 0xff, 0xe0, 0x7c, 0xe7, 0xa0, 0x00, 0x11, 0xff, 0x08, 0x00, 0x40, 0xdf, 0x7c, 0xf3, 0xff, 
+  0x04, 0x00, 0x00, 0xc8, 0x00, 0x05, 0x04, 0x00, 0x6f, 0x7c, 0xe7, 0xff, 0xe5, 0x7f, 0x0a, 0xbc, 0x00, 0x7a, 0x71, 0xde, 0x7b, 0x3e, 0xff, 0xdf, 0x7d, 0xf4, 0xb4, 0x00, 0x05, 0xa8, 0x00, 0x12, 
+  0x7d, 0xc4, 0x00, 0xbf, 0xe0, 0x7d, 0xff, 0xfe, 0xdf, 0x7d, 0xf6, 0xff, 0xe1, 0x7b, 0x44, 0xb4, 0x00, 0x79, 0x04, 0x8c, 0x00, 0x1f, 0xff, 0xbc, 0x00, 0x04, 0x0f, 0xb4, 0x00, 0x89, 0x05, 0xbc, 
+  0x00, 0x77, 0xe1, 0x7b, 0x44, 0xff, 0xe0, 0x7d, 0xfa, 0x78, 0x01, 0x1f, 0xfa, 0x68, 0x01, 0x61, 0xf4, 0x01, 0xff, 0xff, 0x7f, 0x04, 0xff, 0xe0, 0x7b, 0x3a, 0xff, 0xe0, 0x7c, 0x7f, 0xff, 0xe1, 
+  0x7d, 0x4d, 0xa0, 0x00, 0x0f, 0x08, 0x00, 0x09, 0x47, 0xff, 0xe0, 0x7d, 0xea, 0xb8, 0x00, 0x1f, 0xea, 0x2c, 0x00, 0x09, 0x04, 0x1c, 0x00, 0xc0, 0xfe, 0xdf, 0x7c, 0x52, 0xfe, 0xe0, 0x7d, 0x7e, 
+  0xff, 0xdf, 0x7d, 0x39, 0x74, 0x00, 0x04, 0x18, 0x00, 0x0f, 0x08, 0x00, 0x21, 0x86, 0xff, 0xde, 0x7c, 0x2f, 0xff, 0xe0, 0x7d, 0xf0, 0x84, 0x00, 0x2f, 0x7c, 0xa6, 0x48, 0x00, 0x11, 0x0f, 0xb8, 
+  0x00, 0x21, 0x46, 0xff, 0xdf, 0x7d, 0xb1, 0x68, 0x00, 0x6f, 0x7d, 0xf0, 0xff, 0xdf, 0x7f, 0x30, 0x6c, 0x00, 0x11, 0x0f, 0x24, 0x00, 0x01, 0x85, 0xff, 0xdf, 0x7f, 0x08, 0xff, 0xe0, 0x7c, 0xf7, 
+  0x50, 0x00, 0x3f, 0xdf, 0x7d, 0xe6, 0x28, 0x00, 0x01, 0x0c, 0x14, 0x00, 0x0f, 0xb8, 0x00, 0x1d, 0x00, 0x60, 0x01, 0x0b, 0x20, 0x01, 0x5c, 0xf9, 0xff, 0xe7, 0x73, 0x0b, 0x58, 0x00, 0x0f, 0x10, 
+  0x00, 0x19, 0x45, 0xff, 0xdf, 0x7d, 0xbd, 0xb8, 0x00, 0x00, 0x28, 0x04, 0x3f, 0xdc, 0x7c, 0x25, 0x40, 0x00, 0x0d, 0x0f, 0xb8, 0x00, 0x1e, 0x01, 0x88, 0x02, 0x07, 0x7c, 0x04, 0x3f, 0xe0, 0x7d, 
+  0xbf, 0x64, 0x00, 0x0d, 0x0f, 0x20, 0x00, 0x09, 0x89, 0xff, 0xe1, 0x78, 0x11, 0xfe, 0xdf, 0x7d, 0xa3, 0xb8, 0x00, 0x3f, 0xdf, 0x7c, 0x73, 0x34, 0x00, 0x05, 0xc5, 0xff, 0xe9, 0x7f, 0x0c, 0xff, 
+  0xe0, 0x7c, 0x85, 0xff, 0xdf, 0x7c, 0xfb, 0x34, 0x00, 0x00, 0x0c, 0x00, 0x3f, 0xdf, 0x7c, 0x83, 0xb8, 0x05, 0x09, 0x45, 0xff, 0xdf, 0x7d, 0x8a, 0x30, 0x00, 0x00, 0x1c, 0x01, 0x7f, 0xe0, 0x7c, 
+  0xa6, 0xff, 0xe2, 0x7f, 0x12, 0x68, 0x00, 0x05, 0x0f, 0x18, 0x00, 0x05, 0xca, 0xff, 0xe0, 0x7b, 0x6d, 0xff, 0xe0, 0x7d, 0xc9, 0xfe, 0xdf, 0x7d, 0xfc, 0x50, 0x00, 0x03, 0x14, 0x01, 0x74, 0xdf, 
+  0x7d, 0xab, 0xff, 0xe1, 0x7f, 0x22, 0x40, 0x00, 0xcf, 0xff, 0xff, 0x00, 0x01, 0xff, 0xe1, 0x7c, 0x5e, 0xfe, 0xdf, 0x7c, 0xe5, 0x30, 0x00, 0x02, 0x00, 0xc0, 0x05, 0x74, 0xe0, 0x7d, 0xe2, 0xff, 
+  0xe1, 0x7c, 0x56, 0x34, 0x00, 0x00, 0x08, 0x00, 0x8f, 0xff, 0xe2, 0x7f, 0x2c, 0xff, 0xdf, 0x7c, 0xba, 0x34, 0x00, 0x01, 0x01, 0x7c, 0x00, 0x70, 0xdf, 0x7d, 0xcb, 0xfe, 0xdf, 0x7d, 0x70, 0x2c, 
+  0x00, 0x0f, 0x04, 0x00, 0x11, 0x4f, 0xff, 0xdf, 0x7d, 0x92, 0x4c, 0x00, 0x01, 0x0b, 0x14, 0x00, 0x13, 0xf8, 0x28, 0x01, 0x5b, 0x43, 0xff, 0xe0, 0x7c, 0xc8, 0x1c, 0x00, 0x05, 0x70, 0x06, 0x0e, 
+  0x18, 0x00, 0xa1, 0x7c, 0xbe, 0xfe, 0xde, 0x7d, 0x3f, 0xff, 0xe0, 0x7d, 0x98, 0x9c, 0x00, 0x01, 0x60, 0x01, 0x03, 0x10, 0x01, 0x0f, 0x0c, 0x00, 0x02, 0x2f, 0x7c, 0x97, 0xb4, 0x00, 0x11, 0x00, 
+  0x24, 0x00, 0x00, 0xf0, 0x04, 0x0e, 0x70, 0x00, 0x0f, 0x5c, 0x00, 0x09, 0x0e, 0x1c, 0x00, 0x40, 0xfe, 0xe0, 0x7d, 0xbf, 0x04, 0x00, 0x0f, 0x48, 0x00, 0x2e, 0x30, 0xdf, 0x7c, 0x52, 0x94, 0x00, 
+  0x0f, 0x04, 0x00, 0x11, 0x42, 0xff, 0xd7, 0x75, 0x0d, 0x3c, 0x06, 0xf2, 0x03, 0x7c, 0xe7, 0xfe, 0xdf, 0x7c, 0xa4, 0xff, 0xdf, 0x7c, 0x60, 0xff, 0xe0, 0x7f, 0x2a, 0xff, 0xe0, 0x7c, 0x8f, 0x18, 
+  0x00, 0x0e, 0xa8, 0x00, 0x04, 0xa0, 0x00, 0x84, 0xfe, 0xe0, 0x7c, 0xdf, 0xff, 0xe0, 0x7c, 0x54, 0x68, 0x00, 0x00, 0x0c, 0x00, 0x02, 0x14, 0x00, 0x0f, 0x34, 0x00, 0x07, 0x01, 0x54, 0x00, 0x01, 
+  0xe4, 0x01, 0x61, 0x7f, 0x2a, 0xff, 0xde, 0x7e, 0x5f, 0x54, 0x03, 0x31, 0xdf, 0x7d, 0xe6, 0x90, 0x01, 0x34, 0xe1, 0x78, 0x11, 0x4c, 0x00, 0x0f, 0x08, 0x00, 0x11, 0x40, 0xff, 0xe1, 0x7b, 0x23, 
+  0xb8, 0x02, 0x0c, 0x2c, 0x00, 0x84, 0xff, 0xdd, 0x7f, 0x26, 0xff, 0xe0, 0x7c, 0xb0, 0xa8, 0x00, 0x05, 0x08, 0x00, 0x01, 0x9c, 0x08, 0x6d, 0x7c, 0x7d, 0xff, 0xe2, 0x71, 0x09, 0x34, 0x00, 0x7f, 
+  0xe2, 0x71, 0x09, 0xff, 0xe0, 0x7c, 0x7d, 0xc0, 0x08, 0x02, 0x7c, 0xdf, 0x7d, 0xb3, 0xff, 0xdf, 0x7f, 0x28, 0x34, 0x00, 0x00, 0x10, 0x00, 0x00, 0x84, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 
+  0x39, 0x45, 0xff, 0xdf, 0x7d, 0x94, 0xb4, 0x00, 0x00, 0x98, 0x02, 0x07, 0x74, 0x0b, 0x0f, 0x68, 0x00, 0x05, 0x03, 0xdc, 0x0a, 0x06, 0xfc, 0x02, 0x3f, 0xdf, 0x7d, 0x99, 0x2c, 0x00, 0x05, 0x0f, 
+  0x18, 0x00, 0x45, 0x49, 0xff, 0xe0, 0x7c, 0x87, 0xb8, 0x00, 0x3f, 0xe2, 0x7d, 0x35, 0x6c, 0x00, 0x0d, 0x49, 0xff, 0xe2, 0x7d, 0x35, 0x34, 0x00, 0x3f, 0xe0, 0x7d, 0x8c, 0x34, 0x00, 0x0d, 0x0f, 
+  0x20, 0x00, 0x3d, 0x0f, 0xb8, 0x00, 0xff, 0xff, 0x18, 0x01, 0xb8, 0x04, 0x07, 0xdc, 0x04, 0x0f, 0x98, 0x03, 0x74, 0x4f, 0xff, 0xdd, 0x7f, 0x1e, 0x14, 0x03, 0x01, 0x00, 0xe0, 0x07, 0x10, 0xff, 
+  0xe8, 0x07, 0x00, 0x44, 0x04, 0x08, 0x04, 0x00, 0x0f, 0x08, 0x05, 0x70, 0x05, 0x78, 0x06, 0x00, 0x54, 0x10, 0xb3, 0xe0, 0x7d, 0x9f, 0xfe, 0xe0, 0x7e, 0x5b, 0xff, 0xdc, 0x7c, 0x25, 0xd8, 0x07, 
+  0x1b, 0xf8, 0x14, 0x04, 0x06, 0xd8, 0x04, 0x01, 0x88, 0x08, 0x0f, 0x78, 0x06, 0x3c, 0x3f, 0xdf, 0x7f, 0x10, 0x40, 0x01, 0x01, 0x0f, 0x14, 0x00, 0x01, 0x4f, 0xff, 0xe0, 0x7c, 0x4c, 0x9c, 0x00, 
+  0x09, 0x0f, 0x1c, 0x00, 0x11, 0x00, 0xe4, 0x07, 0x00, 0x04, 0x00, 0x0f, 0x2c, 0x00, 0x11, 0x0f, 0x24, 0x00, 0x0a, 0x3f, 0xdf, 0x7c, 0x50, 0xa4, 0x00, 0x01, 0x0f, 0x14, 0x00, 0x01, 0x4f, 0xff, 
+  0xdf, 0x7d, 0x90, 0x4c, 0x00, 0x0a, 0x00, 0x58, 0x01, 0x02, 0x2c, 0x0a, 0x12, 0x98, 0x24, 0x09, 0x2f, 0x7c, 0xbe, 0x30, 0x00, 0x0d, 0x04, 0x20, 0x00, 0x41, 0xfe, 0xdf, 0x7d, 0xc5, 0x40, 0x0f, 
+  0x31, 0xe0, 0x7c, 0x85, 0x30, 0x0f, 0x08, 0x6c, 0x02, 0x0f, 0x0c, 0x00, 0x01, 0x3f, 0xdf, 0x7c, 0x93, 0xa4, 0x00, 0x01, 0x0f, 0x14, 0x00, 0x01, 0x00, 0x3c, 0x0a, 0x84, 0xff, 0xe0, 0x7d, 0xce, 
+  0xff, 0xdf, 0x7c, 0xfd, 0x70, 0x00, 0x09, 0x08, 0x00, 0x00, 0x7c, 0x0a, 0x38, 0xe2, 0x7f, 0x2c, 0x3c, 0x00, 0x00, 0xa4, 0x0a, 0x10, 0xfe, 0xac, 0x0a, 0x0f, 0x7c, 0x00, 0x01, 0x00, 0x14, 0x00, 
+  0x31, 0xdf, 0x7d, 0xe4, 0x70, 0x02, 0x34, 0xff, 0x00, 0x01, 0x38, 0x00, 0xc9, 0xff, 0xde, 0x7b, 0x1f, 0xff, 0xe0, 0x7d, 0xa7, 0xff, 0xdf, 0x7d, 0xfe, 0x60, 0x00, 0x06, 0x18, 0x01, 0x10, 0xc9, 
+  0x54, 0x0b, 0x04, 0x30, 0x00, 0x0f, 0x08, 0x00, 0x15, 0x41, 0xff, 0xe5, 0x7f, 0x14, 0x58, 0x09, 0x00, 0x78, 0x00, 0x04, 0x04, 0x00, 0x3f, 0xdf, 0x7d, 0x8a, 0x40, 0x00, 0x05, 0x00, 0x1c, 0x0c, 
+  0x10, 0xff, 0x24, 0x0c, 0x00, 0x2c, 0x0c, 0x05, 0x30, 0x00, 0x01, 0x44, 0x0c, 0x1f, 0x84, 0x78, 0x0d, 0x09, 0x48, 0xff, 0xe0, 0x7d, 0x6e, 0xb8, 0x00, 0x01, 0x58, 0x09, 0x0f, 0x50, 0x09, 0x1c, 
+  0x0c, 0x94, 0x00, 0x48, 0xff, 0xdf, 0x7c, 0xbc, 0x54, 0x00, 0x00, 0x70, 0x0f, 0x0c, 0x24, 0x00, 0x0c, 0x10, 0x00, 0x0f, 0xa8, 0x0d, 0x1e, 0x02, 0x78, 0x01, 0x06, 0xe0, 0x03, 0x3c, 0xdf, 0x7c, 
+  0xbc, 0x54, 0x00, 0x0f, 0x10, 0x00, 0x19, 0x00, 0x18, 0x0f, 0x0b, 0x84, 0x02, 0x5f, 0xf2, 0xff, 0xcc, 0x66, 0x05, 0x44, 0x00, 0x0d, 0x0f, 0xb8, 0x00, 0x1d, 0x00, 0x50, 0x00, 0x46, 0xff, 0xdf, 
+  0x7c, 0xdb, 0x20, 0x01, 0x2f, 0x7c, 0xf7, 0x58, 0x0a, 0x01, 0x00, 0x28, 0x00, 0x0f, 0x04, 0x00, 0x11, 0x0d, 0x88, 0x10, 0x3f, 0xdf, 0x7d, 0xb1, 0x38, 0x00, 0x12, 0x0f, 0x40, 0x11, 0x20, 0x46, 
+  0xff, 0xe0, 0x7c, 0x97, 0xb8, 0x00, 0x20, 0x7d, 0xf0, 0x7c, 0x00, 0x0f, 0x6c, 0x00, 0x11, 0x0f, 0x24, 0x00, 0x05, 0x01, 0x24, 0x10, 0x30, 0xdf, 0x7d, 0x39, 0x94, 0x11, 0x00, 0x9c, 0x11, 0x0f, 
+  0x28, 0x00, 0x05, 0x08, 0x18, 0x00, 0x0f, 0x70, 0x01, 0x21, 0x03, 0x98, 0x04, 0x11, 0x7f, 0x64, 0x12, 0x38, 0xff, 0x7f, 0x04, 0x50, 0x00, 0x0f, 0x0c, 0x00, 0x51, 0x00, 0x54, 0x13, 0x01, 0xc0, 
+  0x0c, 0x04, 0x98, 0x03, 0x02, 0x74, 0x13, 0x1f, 0x43, 0x7c, 0x00, 0x51, 0x0f, 0x64, 0x00, 0x25, 0x01, 0x98, 0x05, 0x01, 0xf0, 0x07, 0x07, 0xb8, 0x08, 0x02, 0xd4, 0x04, 0x4f, 0xf6, 0xff, 0xe0, 
+  0x7d, 0xbc, 0x00, 0x82, 0x0f, 0xb4, 0x00, 0x05, 0x05, 0xb4, 0x02, 0x00, 0xcc, 0x17, 0x3f, 0xe0, 0x7b, 0x42, 0x14, 0x01, 0x25, 0x0f, 0x38, 0x00, 0x41, 0x01, 0xb8, 0x05, 0x0f, 0xb8, 0x17, 0x11, 
+  0x30, 0xdf, 0x7d, 0xe4, 0xa4, 0x04, 0x0f, 0x84, 0x00, 0x41, 0x0f, 0x54, 0x00, 0x25, 0x00, 0xdc, 0x19, 0x0f, 0x28, 0x19, 0x0d, 0x4f, 0xff, 0xdd, 0x7a, 0x36, 0x60, 0x00, 0x25, 0x0f, 0x38, 0x00, 
+  0x49, 0x01, 0xbc, 0x00, 0x00, 0xec, 0x07, 0x07, 0x8c, 0x0b, 0x01, 0xe4, 0x19, 0x00, 0x58, 0x0a, 0x0f, 0xb4, 0x00, 0x84, 0x04, 0x10, 0x01, 0x0f, 0xf4, 0x1b, 0x01, 0x0f, 0x14, 0x00, 0x01, 0x04, 
+  0x30, 0x00, 0x0f, 0x08, 0x00, 0xff, 0xff, 0x4a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x6f, 0x6f, 0x6c, 0x64, 0x6f, 0x77, 0x6e, 0x5f, 0x69, 0x6d, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x80, 0x42, 0x01, 0x00, 0x00, 0x7d, 0xe0, 0xff, 0xff, 0x3f, 0x00, 0x7c, 0x00, 0x4d, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 
+  0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 
+  0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4d, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x5a, 0x4d, 0x00, 0xc4, 0x5d, 0x42, 0x00, 0xcc, 0x14, 0x42, 0x00, 0xe8, 0x44, 
+  0x42, 0x00, 0x68, 0x1b, 0x42, 0x00, 0x94, 0x2f, 0x42, 0x00, 0x5c, 0x0f, 0x42, 0x00, 0x94, 0x2f, 0x42, 0x00, 0x48, 0xe1, 0x41, 0x00, 0xe8, 0x44, 0x42, 0x00, 0x30, 0xc9, 0x41, 0x00, 0xc4, 0x5d, 
+  0x42, 0x00, 0x68, 0xd6, 0x41, 0x00, 0x50, 0x63, 0x42, 0x00, 0x38, 0xad, 0x41, 0x00, 0x6c, 0x50, 0x42, 0x00, 0x30, 0xa3, 0x41, 0x00, 0x54, 0x55, 0x42, 0x01, 0xe0, 0x7a, 0x41, 0x00, 0xc0, 0x40, 
+  0x42, 0x00, 0xb0, 0x64, 0x41, 0x00, 0x24, 0x3a, 0x42, 0x00, 0x10, 0xa4, 0x41, 0x00, 0xcc, 0x24, 0x42, 0x00, 0x28, 0xbc, 0x41, 0x00, 0xac, 0x0a, 0x42, 0x00, 0x70, 0x9d, 0x41, 0x00, 0xac, 0x0a, 
+  0x42, 0x00, 0x70, 0x5a, 0x41, 0x00, 0xe8, 0x1c, 0x42, 0x00, 0x80, 0x11, 0x41, 0x00, 0xc4, 0x0d, 0x42, 0xff, 0x9f, 0xaa, 0x40, 0x00, 0x00, 0x00, 0x42, 0x01, 0x60, 0x0c, 0x41, 0x00, 0x78, 0xe4, 
+  0x41, 0xff, 0x9f, 0xaa, 0x40, 0x00, 0x30, 0xc6, 0x41, 0x00, 0x80, 0x11, 0x41, 0x00, 0xa8, 0xea, 0x41, 0x00, 0x70, 0x5a, 0x41, 0x00, 0xa8, 0xea, 0x41, 0x00, 0x70, 0x9d, 0x41, 0x00, 0x58, 0xb5, 
+  0x41, 0x00, 0x28, 0xbc, 0x41, 0x00, 0xa8, 0x8a, 0x41, 0x00, 0x10, 0xa4, 0x41, 0x00, 0x90, 0x7c, 0x41, 0x00, 0xb0, 0x64, 0x41, 0x00, 0xb0, 0x2a, 0x41, 0x01, 0xe0, 0x7a, 0x41, 0x00, 0xc0, 0x3e, 
+  0x41, 0x00, 0x30, 0xa3, 0x41, 0x01, 0x60, 0xe6, 0x40, 0x00, 0x38, 0xad, 0x41, 0x01, 0x60, 0x09, 0x41, 0x00, 0x68, 0xd6, 0x41, 0x00, 0xd0, 0x6c, 0x41, 0x00, 0x30, 0xc9, 0x41, 0x00, 0x10, 0xa1, 
+  0x41, 0x00, 0x48, 0xe1, 0x41, 0x00, 0x10, 0xa1, 0x41, 0x00, 0x78, 0x0f, 0x42, 0x00, 0xd0, 0x6c, 0x41, 0x00, 0x84, 0x1b, 0x42, 0x01, 0x60, 0x09, 0x41, 0x00, 0xe8, 0x14, 0x42, 0x01, 0x60, 0xe6, 
+  0x40, 0x00, 0x80, 0x29, 0x42, 0x00, 0xc0, 0x3e, 0x41, 0x00, 0x80, 0x2e, 0x42, 0x00, 0xb0, 0x2a, 0x41, 0x00, 0x48, 0x41, 0x42, 0x00, 0x00, 0x7d, 0x41, 0x00, 0xd4, 0x46, 0x42, 0x00, 0xb8, 0x8b, 
+  0x41, 0x00, 0xf8, 0x2d, 0x42, 0x00, 0x68, 0xb6, 0x41, 0x00, 0xec, 0x21, 0x42, 0x00, 0xa8, 0xea, 0x41, 0x00, 0x48, 0x31, 0x42, 0x00, 0xa8, 0xea, 0x41, 0x00, 0x64, 0x49, 0x42, 0x00, 0x30, 0xc6, 
+  0x41, 0x00, 0xa0, 0x5b, 0x42, 0x00, 0x78, 0xe4, 0x41, 0x00, 0xac, 0x6a, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0xe8, 0x5c, 0x42, 0x00, 0xc4, 0x0d, 0x42, 0x00, 0xac, 0x6a, 0x42, 0x00, 0xcc, 0x1c, 
+  0x42, 0x00, 0xa0, 0x5b, 0x42, 0x00, 0xac, 0x0a, 0x42, 0x00, 0x64, 0x49, 0x42, 0x00, 0xac, 0x0a, 0x42, 0x00, 0x48, 0x31, 0x42, 0x00, 0x54, 0x25, 0x42, 0x00, 0xd0, 0x21, 0x42, 0x00, 0xac, 0x3a, 
+  0x42, 0x00, 0xdc, 0x2d, 0x42, 0x00, 0x48, 0x41, 0x42, 0x00, 0xb8, 0x46, 0x42, 0x00, 0x54, 0x55, 0x42, 0x00, 0x48, 0x41, 0x42, 0x00, 0x50, 0x50, 0x42, 0x00, 0x68, 0x2e, 0x42, 0x00, 0x34, 0x63, 
+  0x42, 0x00, 0x64, 0x29, 0x42, 0x00, 0xc4, 0x5d, 0x42, 0x00, 0xcc, 0x14, 0x42, 0x00, 0xa8, 0xca, 0x41, 0x00, 0x48, 0xe1, 0x41, 0x00, 0x00, 0x00, 0x42, 0x00, 0x58, 0xc2, 0x41, 0x00, 0xac, 0x1a, 
+  0x42, 0x00, 0x48, 0xe1, 0x41, 0x00, 0xac, 0x1a, 0x42, 0x00, 0x5c, 0x0f, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0xd4, 0x1e, 0x42, 0x00, 0xa8, 0xca, 0x41, 0x00, 0x5c, 0x0f, 0x42, 0x00, 0xa8, 0xca, 
+  0x41, 0x00, 0x48, 0xe1, 0x41, 
 };
 
 const lv_img_dsc_t cooldown_img = {
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .header.cf = LV_IMG_CF_USER_ENCODED_0,
   .header.always_zero = 0,
   .header.reserved = 0,
   .header.w = 46,
   .header.h = 46,
-  .data_size = 2116 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+  .data_size = 2085,
   .data = cooldown_img_map,
 };
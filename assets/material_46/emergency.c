@@ -22,209 +22,105 @@
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_EMERGENCY uint8_t emergency_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x0e, 0xc5, 0x2e, 0xc5, 0x39, 0xc5, 0x39, 0xc5, 0x2e, 0xc5, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x09, 0xc5, 0x59, 0xc5, 0xa5, 0xc5, 0xe3, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xe2, 0xc5, 0xa4, 0xc5, 0x58, 0xc4, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x1e, 0xc5, 0xe3, 0xc5, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x14, 0xc5, 0x86, 0xc5, 0xf0, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xef, 0xc5, 0x84, 0xc5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x80, 0xc5, 0xe3, 0xe5, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x0b, 0xc5, 0xd4, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x64, 0xc5, 0xed, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xec, 0xe5, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x74, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xd2, 0xc5, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xa0, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf0, 0xc5, 0x2f, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x0c, 0xc5, 0xac, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfe, 0xc5, 0xd6, 0xc5, 0xba, 0xc5, 0xa1, 0xc5, 0xa1, 0xc5, 0xbb, 0xc5, 0xd7, 0xc5, 0xfe, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xa9, 0xe5, 0x0b, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x30, 0xc5, 0xf0, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x50, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfd, 0xc5, 0x46, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x13, 0xc5, 0xca, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xca, 0xc5, 0x68, 0xc5, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x1b, 0xc5, 0x69, 0xc5, 0xca, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xc8, 0xc5, 0x13, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x48, 0xc5, 0xfd, 0xc5, 0xff, 0xc5, 0xff, 0xe5, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xc5, 0x0a, 0xc5, 0xe0, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x85, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x0c, 0xc5, 0xca, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xdb, 0xc5, 0x54, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xc5, 0x55, 0xc5, 0xdb, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xc8, 0xe5, 0x0b, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x87, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xde, 0xc4, 0x09, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xc5, 0x77, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xda, 0xe5, 0x07, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xa6, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xb6, 0xc5, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x0c, 0xc5, 0xaf, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x06, 0xc5, 0xd8, 0xc5, 0xff, 0xc5, 0xff, 0xe5, 0x72, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xc4, 0x08, 0xc5, 0xe7, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x48, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x64, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x92, 0xe0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x8c, 0xc5, 0x99, 0xc5, 0x99, 0xc5, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x02, 0xc5, 0x93, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x4b, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xe6, 0xc4, 0x08, 0x00, 0x00, 
-  0x00, 0x00, 0xc5, 0x5d, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xc9, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x14, 0xc5, 0xed, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xb0, 0xe0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xea, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x02, 0xc5, 0xb2, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xeb, 0xe5, 0x12, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xcb, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x5c, 0x00, 0x00, 
-  0x00, 0x00, 0xc5, 0xba, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x58, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x86, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xdb, 0xe5, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xea, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x0d, 0xc5, 0xdd, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x83, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x5a, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xb8, 0x00, 0x00, 
-  0xe5, 0x11, 0xc5, 0xfc, 0xc5, 0xff, 0xc5, 0xef, 0xc4, 0x08, 0x00, 0x00, 0xc4, 0x09, 0xc5, 0xef, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xea, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x56, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xee, 0xc4, 0x08, 0x00, 0x00, 0xc5, 0x0a, 0xc5, 0xf1, 0xc5, 0xff, 0xc5, 0xfb, 0xc5, 0x0f, 
-  0xc5, 0x50, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xa7, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x59, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xc9, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xea, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xc5, 0xca, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x55, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xaa, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x4e, 
-  0xc5, 0x8c, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x65, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xa5, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xea, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x6a, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xa2, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x68, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x8a, 
-  0xc5, 0xb4, 0xc5, 0xff, 0xc5, 0xff, 0xe5, 0x32, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe3, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfe, 0xc5, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xea, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x1c, 0xc5, 0xfe, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xe1, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x34, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xb3, 
-  0xc5, 0xda, 0xc5, 0xff, 0xc5, 0xfe, 0xe5, 0x0c, 0x00, 0x00, 0xc5, 0x0e, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xea, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xd8, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfe, 0xe5, 0x0d, 0x00, 0x00, 0xc5, 0x0e, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xd8, 
-  0xc5, 0xec, 0xc5, 0xff, 0xc5, 0xf2, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x2c, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xea, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xbc, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x2b, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf4, 0xc5, 0xff, 0xc5, 0xeb, 
-  0xc5, 0xf9, 0xc5, 0xff, 0xc5, 0xe5, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x3a, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xea, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xa1, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x39, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe6, 0xc5, 0xff, 0xc5, 0xf8, 
-  0xc5, 0xf9, 0xc5, 0xff, 0xc5, 0xe5, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x3a, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xea, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xa2, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x39, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe6, 0xc5, 0xff, 0xc5, 0xf8, 
-  0xc5, 0xec, 0xc5, 0xff, 0xc5, 0xf2, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x2c, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xda, 0xc5, 0xee, 0xc5, 0xee, 0xc5, 0xda, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xbc, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x2b, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf4, 0xc5, 0xff, 0xc5, 0xeb, 
-  0xc5, 0xda, 0xc5, 0xff, 0xc5, 0xfe, 0xe5, 0x0c, 0x00, 0x00, 0xc5, 0x0e, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xd8, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfe, 0xe5, 0x0c, 0x00, 0x00, 0xc5, 0x0e, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xd8, 
-  0xc5, 0xb4, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x33, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe2, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfe, 0xc5, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x1d, 0xc5, 0xfe, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x35, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xb2, 
-  0xc5, 0x8c, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x66, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xa4, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x6b, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xa1, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x68, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x8a, 
-  0xc5, 0x50, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xa7, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x58, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xca, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x3e, 0xc5, 0x44, 0xc5, 0x44, 0xc5, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xc5, 0xcb, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x54, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xaa, 0xc5, 0xff, 0xc5, 0xff, 0xe5, 0x4d, 
-  0xe5, 0x11, 0xc5, 0xfc, 0xc5, 0xff, 0xc5, 0xef, 0xc4, 0x08, 0x00, 0x00, 0xc4, 0x09, 0xc5, 0xef, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xea, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x57, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xee, 0xc4, 0x08, 0x00, 0x00, 0xc5, 0x0a, 0xc5, 0xf1, 0xc5, 0xff, 0xc5, 0xfb, 0xc5, 0x0f, 
-  0x00, 0x00, 0xc5, 0xba, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x58, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x84, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xdc, 0xe5, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xea, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x0e, 0xc5, 0xdd, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x81, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x5a, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xb7, 0x00, 0x00, 
-  0x00, 0x00, 0xc5, 0x5d, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xc9, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x13, 0xc5, 0xec, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xb2, 0xe0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xea, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x02, 0xc5, 0xb3, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xea, 0xe5, 0x11, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xcc, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x5b, 0x00, 0x00, 
-  0x00, 0x00, 0xc4, 0x08, 0xc5, 0xe7, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x49, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x62, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x93, 0xe0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x8c, 0xc5, 0x99, 0xc5, 0x99, 0xc5, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x02, 0xc5, 0x94, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x5f, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x4d, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xe5, 0xc4, 0x08, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xc5, 0x75, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xd9, 0xe5, 0x07, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xa9, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xb2, 0xe5, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x0e, 0xc5, 0xb3, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xa6, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x08, 0xc5, 0xdb, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x71, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xc4, 0x09, 0xc5, 0xdf, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x86, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x0b, 0xc5, 0xc9, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xdd, 0xc5, 0x56, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xe5, 0x57, 0xc5, 0xdd, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xc7, 0xc5, 0x0a, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x88, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xdc, 0xc4, 0x08, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x4e, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfd, 0xc5, 0x48, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x13, 0xc5, 0xc8, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xcb, 0xc5, 0x6a, 0xe5, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x1d, 0xc5, 0x6b, 0xc5, 0xcb, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xc7, 0xe5, 0x12, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x49, 0xc5, 0xfd, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x9e, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xf0, 0xc5, 0x30, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x0b, 0xc5, 0xa8, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xfe, 0xc5, 0xd8, 0xc5, 0xbc, 0xc5, 0xa2, 0xc5, 0xa2, 0xc5, 0xbc, 0xc5, 0xd8, 0xc5, 0xfe, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xa6, 0xc5, 0x0a, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x30, 0xc5, 0xf1, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x0b, 0xc5, 0xd3, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x61, 0xc5, 0xeb, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xea, 0xc5, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x74, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xd1, 0xc5, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x1d, 0xc5, 0xe3, 0xc5, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x12, 0xc5, 0x83, 0xc5, 0xee, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xee, 0xc5, 0x81, 0xe5, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x80, 0xc5, 0xe2, 0xe5, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x08, 0xc5, 0x55, 0xc5, 0xa2, 0xc5, 0xe1, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xc5, 0xe0, 0xc5, 0xa1, 0xc5, 0x54, 0xc4, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x0c, 0xe5, 0x2c, 0xc5, 0x38, 0xc5, 0x38, 0xe5, 0x2c, 0xe5, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xc9, 0x0e, 0x05, 0xd1, 0x2e, 0x05, 0xd1, 0x39, 0x05, 0xd1, 0x39, 0x05, 0xd1, 0x2e, 0x25, 0xc9, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xc8, 0x09, 0x25, 0xd1, 0x59, 0x05, 0xd1, 0xa5, 0x05, 0xd1, 0xe3, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xe2, 0x05, 0xd1, 0xa4, 0x05, 0xd1, 0x58, 0xe4, 0xc8, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x1e, 0x05, 0xd1, 0xe3, 0x05, 0xd1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xd1, 0x14, 0x05, 0xd1, 0x86, 0x05, 0xd1, 0xf0, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xef, 0x05, 0xd1, 0x84, 0xe5, 0xc8, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x80, 0x05, 0xd1, 0xe3, 0x25, 0xd1, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xd0, 0x0b, 0x05, 0xd1, 0xd4, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x64, 0x05, 0xd1, 0xed, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xec, 0x05, 0xd1, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x74, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xd2, 0xc6, 0xd0, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xa0, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf0, 0x05, 0xd1, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xd9, 0x0c, 0x05, 0xd1, 0xac, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfe, 0x05, 0xd1, 0xd6, 0x05, 0xd1, 0xba, 0x05, 0xd1, 0xa1, 0x05, 0xd1, 0xa1, 0x05, 0xd1, 0xbb, 0x05, 0xd1, 0xd7, 0x05, 0xd1, 0xfe, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xa9, 0xc6, 0xd0, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x30, 0x05, 0xd1, 0xf0, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x50, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfd, 0x05, 0xd1, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xc8, 0x13, 0x05, 0xd1, 0xca, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xca, 0x05, 0xd1, 0x68, 0xe5, 0xd0, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xd0, 0x1b, 0x25, 0xd1, 0x69, 0x05, 0xd1, 0xca, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xc8, 0xe5, 0xc8, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x48, 0x05, 0xd1, 0xfd, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xd0, 0x0a, 0x05, 0xd1, 0xe0, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xd9, 0x0c, 0x05, 0xd1, 0xca, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xdb, 0x05, 0xd1, 0x54, 0x00, 0xf8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x05, 0xd1, 0x55, 0x05, 0xd1, 0xdb, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xc8, 0xc6, 0xd0, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x87, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xde, 0xe4, 0xc8, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x77, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xda, 0x25, 0xd9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xa6, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xb6, 0x24, 0xd1, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xd9, 0x0c, 0x05, 0xd1, 0xaf, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xd9, 0x06, 0x05, 0xd1, 0xd8, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0xc1, 0x08, 0x05, 0xd1, 0xe7, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x64, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x92, 0x00, 0xf8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x8c, 0x05, 0xd1, 0x99, 0x05, 0xd1, 0x99, 0x05, 0xd1, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x02, 0x05, 0xd1, 0x93, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x25, 0xd1, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x4b, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xe6, 0x04, 0xc1, 0x08, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0xd1, 0x5d, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xd1, 0x14, 0x05, 0xd1, 0xed, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xb0, 0x00, 0xf8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xea, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x02, 0x05, 0xd1, 0xb2, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xeb, 0xe5, 0xd8, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xcb, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x5c, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0xd1, 0xba, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x86, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xdb, 0x45, 0xd9, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xea, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xd9, 0x0d, 0x05, 0xd1, 0xdd, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x5a, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xb8, 0x00, 0x00, 0x00, 
-  0x06, 0xd1, 0x11, 0x05, 0xd1, 0xfc, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xef, 0x04, 0xc1, 0x08, 0x00, 0x00, 0x00, 0xe4, 0xc8, 0x09, 0x05, 0xd1, 0xef, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xea, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x56, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xee, 0x04, 0xc1, 0x08, 0x00, 0x00, 0x00, 0xc6, 0xd0, 0x0a, 0x05, 0xd1, 0xf1, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfb, 0x24, 0xd1, 0x0f, 
-  0x05, 0xd1, 0x50, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x59, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xc9, 0x00, 0xf8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xea, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x05, 0xd1, 0xca, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x4e, 
-  0x05, 0xd1, 0x8c, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xa5, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x25, 0xd1, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xea, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x6a, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x68, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x8a, 
-  0x05, 0xd1, 0xb4, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xe3, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfe, 0xe5, 0xd0, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xea, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x1c, 0x05, 0xd1, 0xfe, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x34, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xb3, 
-  0x05, 0xd1, 0xda, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfe, 0x65, 0xd9, 0x0c, 0x00, 0x00, 0x00, 0x25, 0xc9, 0x0e, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xea, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xd8, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfe, 0x45, 0xd9, 0x0d, 0x00, 0x00, 0x00, 0x25, 0xc9, 0x0e, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xd8, 
-  0x05, 0xd1, 0xec, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x2c, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xea, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xbc, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x25, 0xd1, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xf4, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xeb, 
-  0x05, 0xd1, 0xf9, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x3a, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xea, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xa1, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xe6, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf8, 
-  0x05, 0xd1, 0xf9, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x3a, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xea, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xa2, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xe6, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf8, 
-  0x05, 0xd1, 0xec, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x2c, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xda, 0x05, 0xd1, 0xee, 0x05, 0xd1, 0xee, 0x05, 0xd1, 0xda, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xbc, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x25, 0xd1, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xf4, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xeb, 
-  0x05, 0xd1, 0xda, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfe, 0x65, 0xd9, 0x0c, 0x00, 0x00, 0x00, 0x25, 0xc9, 0x0e, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xd8, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfe, 0x65, 0xd9, 0x0c, 0x00, 0x00, 0x00, 0x25, 0xc9, 0x0e, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xd8, 
-  0x05, 0xd1, 0xb4, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x25, 0xd1, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xe2, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfe, 0xe5, 0xd0, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x1d, 0x05, 0xd1, 0xfe, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x35, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xb2, 
-  0x05, 0xd1, 0x8c, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xa4, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x6b, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x68, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x8a, 
-  0x05, 0xd1, 0x50, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x58, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xca, 0x00, 0xf8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x3e, 0x05, 0xd1, 0x44, 0x05, 0xd1, 0x44, 0x05, 0xd1, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x05, 0xd1, 0xcb, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xaa, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x4d, 
-  0x06, 0xd1, 0x11, 0x05, 0xd1, 0xfc, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xef, 0x04, 0xc1, 0x08, 0x00, 0x00, 0x00, 0xe4, 0xc8, 0x09, 0x05, 0xd1, 0xef, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xea, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x57, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xee, 0x04, 0xc1, 0x08, 0x00, 0x00, 0x00, 0xc6, 0xd0, 0x0a, 0x05, 0xd1, 0xf1, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfb, 0x24, 0xd1, 0x0f, 
-  0x00, 0x00, 0x00, 0x05, 0xd1, 0xba, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x84, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xdc, 0x45, 0xd9, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xea, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xc9, 0x0e, 0x05, 0xd1, 0xdd, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x5a, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xb7, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0xd1, 0x5d, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xc8, 0x13, 0x05, 0xd1, 0xec, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xb2, 0x00, 0xf8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xea, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x02, 0x05, 0xd1, 0xb3, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xea, 0x06, 0xd1, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xcc, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x5b, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0xc1, 0x08, 0x05, 0xd1, 0xe7, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x62, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x93, 0x00, 0xf8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x8c, 0x05, 0xd1, 0x99, 0x05, 0xd1, 0x99, 0x05, 0xd1, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x02, 0x05, 0xd1, 0x94, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x4d, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xe5, 0x04, 0xc1, 0x08, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x75, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xd9, 0x25, 0xd9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0xa9, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xb2, 0x45, 0xd9, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xc9, 0x0e, 0x05, 0xd1, 0xb3, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xc1, 0x08, 0x05, 0xd1, 0xdb, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xc8, 0x09, 0x05, 0xd1, 0xdf, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xd0, 0x0b, 0x05, 0xd1, 0xc9, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xdd, 0x05, 0xd1, 0x56, 0x00, 0xf8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x05, 0xd1, 0x57, 0x05, 0xd1, 0xdd, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xc7, 0xc6, 0xd0, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x88, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xdc, 0x04, 0xc1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x4e, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfd, 0x05, 0xd1, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xc8, 0x13, 0x05, 0xd1, 0xc8, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xcb, 0x05, 0xd1, 0x6a, 0x25, 0xd1, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x1d, 0x05, 0xd1, 0x6b, 0x05, 0xd1, 0xcb, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xc7, 0xe5, 0xd8, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x49, 0x05, 0xd1, 0xfd, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x25, 0xd1, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x9e, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xf0, 0x05, 0xd1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xd0, 0x0b, 0x05, 0xd1, 0xa8, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xfe, 0x05, 0xd1, 0xd8, 0x05, 0xd1, 0xbc, 0x05, 0xd1, 0xa2, 0x05, 0xd1, 0xa2, 0x05, 0xd1, 0xbc, 0x05, 0xd1, 0xd8, 0x05, 0xd1, 0xfe, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xa6, 0xc6, 0xd0, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x30, 0x05, 0xd1, 0xf1, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xd0, 0x0b, 0x05, 0xd1, 0xd3, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x61, 0x05, 0xd1, 0xeb, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xea, 0x05, 0xd1, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x74, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xd1, 0xc6, 0xd0, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x1d, 0x05, 0xd1, 0xe3, 0x05, 0xd1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xd8, 0x12, 0x05, 0xd1, 0x83, 0x05, 0xd1, 0xee, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xee, 0x05, 0xd1, 0x81, 0x06, 0xd1, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd1, 0x80, 0x05, 0xd1, 0xe2, 0x25, 0xd1, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd1, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xc1, 0x08, 0x05, 0xd1, 0x55, 0x05, 0xd1, 0xa2, 0x05, 0xd1, 0xe1, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xff, 0x05, 0xd1, 0xe0, 0x05, 0xd1, 0xa1, 0x05, 0xd1, 0x54, 0x04, 0xc1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xd1, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xd9, 0x0c, 0x25, 0xd1, 0x2c, 0x05, 0xd1, 0x38, 0x05, 0xd1, 0x38, 0x25, 0xd1, 0x2c, 0x65, 0xd9, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x25, 0x0e, 0xd1, 0x05, 0x2e, 0xd1, 0x05, 0x39, 0xd1, 0x05, 0x39, 0xd1, 0x05, 0x2e, 0xc9, 0x25, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xe4, 0x09, 0xd1, 0x25, 0x59, 0xd1, 0x05, 0xa5, 0xd1, 0x05, 0xe3, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xe2, 0xd1, 0x05, 0xa4, 0xd1, 0x05, 0x58, 0xc8, 0xe4, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x1e, 0xd1, 0x05, 0xe3, 0xd1, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x45, 0x14, 0xd1, 0x05, 0x86, 0xd1, 0x05, 0xf0, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xef, 0xd1, 0x05, 0x84, 0xc8, 0xe5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x80, 0xd1, 0x05, 0xe3, 0xd1, 0x25, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xc6, 0x0b, 0xd1, 0x05, 0xd4, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x64, 0xd1, 0x05, 0xed, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xec, 0xd1, 0x05, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x74, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xd2, 0xd0, 0xc6, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xa0, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf0, 0xd1, 0x05, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x65, 0x0c, 0xd1, 0x05, 0xac, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfe, 0xd1, 0x05, 0xd6, 0xd1, 0x05, 0xba, 0xd1, 0x05, 0xa1, 0xd1, 0x05, 0xa1, 0xd1, 0x05, 0xbb, 0xd1, 0x05, 0xd7, 0xd1, 0x05, 0xfe, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xa9, 0xd0, 0xc6, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x30, 0xd1, 0x05, 0xf0, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x50, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfd, 0xd1, 0x05, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xe5, 0x13, 0xd1, 0x05, 0xca, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xca, 0xd1, 0x05, 0x68, 0xd0, 0xe5, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xe5, 0x1b, 0xd1, 0x25, 0x69, 0xd1, 0x05, 0xca, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xc8, 0xc8, 0xe5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x48, 0xd1, 0x05, 0xfd, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xc6, 0x0a, 0xd1, 0x05, 0xe0, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x65, 0x0c, 0xd1, 0x05, 0xca, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xdb, 0xd1, 0x05, 0x54, 0xf8, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x01, 0xd1, 0x05, 0x55, 0xd1, 0x05, 0xdb, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xc8, 0xd0, 0xc6, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x87, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xde, 0xc8, 0xe4, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x77, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xda, 0xd9, 0x25, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xa6, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xb6, 0xd1, 0x24, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x65, 0x0c, 0xd1, 0x05, 0xaf, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x65, 0x06, 0xd1, 0x05, 0xd8, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xc1, 0x04, 0x08, 0xd1, 0x05, 0xe7, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x64, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x92, 0xf8, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x8c, 0xd1, 0x05, 0x99, 0xd1, 0x05, 0x99, 0xd1, 0x05, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0xd1, 0x05, 0x93, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x25, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x4b, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xe6, 0xc1, 0x04, 0x08, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd1, 0x05, 0x5d, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x45, 0x14, 0xd1, 0x05, 0xed, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xb0, 0xf8, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xea, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0xd1, 0x05, 0xb2, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xeb, 0xd8, 0xe5, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xcb, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x5c, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd1, 0x05, 0xba, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x86, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xdb, 0xd9, 0x45, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xea, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x45, 0x0d, 0xd1, 0x05, 0xdd, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x5a, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xb8, 0x00, 0x00, 0x00, 
-  0xd1, 0x06, 0x11, 0xd1, 0x05, 0xfc, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xef, 0xc1, 0x04, 0x08, 0x00, 0x00, 0x00, 0xc8, 0xe4, 0x09, 0xd1, 0x05, 0xef, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xea, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x56, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xee, 0xc1, 0x04, 0x08, 0x00, 0x00, 0x00, 0xd0, 0xc6, 0x0a, 0xd1, 0x05, 0xf1, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfb, 0xd1, 0x24, 0x0f, 
-  0xd1, 0x05, 0x50, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x59, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xc9, 0xf8, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xea, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x01, 0xd1, 0x05, 0xca, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x4e, 
-  0xd1, 0x05, 0x8c, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xa5, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x25, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xea, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x6a, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x68, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x8a, 
-  0xd1, 0x05, 0xb4, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xe3, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfe, 0xd0, 0xe5, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xea, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x1c, 0xd1, 0x05, 0xfe, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x34, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xb3, 
-  0xd1, 0x05, 0xda, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfe, 0xd9, 0x65, 0x0c, 0x00, 0x00, 0x00, 0xc9, 0x25, 0x0e, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xea, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xd8, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfe, 0xd9, 0x45, 0x0d, 0x00, 0x00, 0x00, 0xc9, 0x25, 0x0e, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xd8, 
-  0xd1, 0x05, 0xec, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x2c, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xea, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xbc, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x25, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xf4, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xeb, 
-  0xd1, 0x05, 0xf9, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x3a, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xea, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xa1, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xe6, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf8, 
-  0xd1, 0x05, 0xf9, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x3a, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xea, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xa2, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xe6, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf8, 
-  0xd1, 0x05, 0xec, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x2c, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xda, 0xd1, 0x05, 0xee, 0xd1, 0x05, 0xee, 0xd1, 0x05, 0xda, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xbc, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x25, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xf4, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xeb, 
-  0xd1, 0x05, 0xda, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfe, 0xd9, 0x65, 0x0c, 0x00, 0x00, 0x00, 0xc9, 0x25, 0x0e, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xd8, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfe, 0xd9, 0x65, 0x0c, 0x00, 0x00, 0x00, 0xc9, 0x25, 0x0e, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xd8, 
-  0xd1, 0x05, 0xb4, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x25, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xe2, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfe, 0xd0, 0xe5, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x1d, 0xd1, 0x05, 0xfe, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x35, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xb2, 
-  0xd1, 0x05, 0x8c, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xa4, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x6b, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x68, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x8a, 
-  0xd1, 0x05, 0x50, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x58, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xca, 0xf8, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x3e, 0xd1, 0x05, 0x44, 0xd1, 0x05, 0x44, 0xd1, 0x05, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x01, 0xd1, 0x05, 0xcb, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xaa, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x4d, 
-  0xd1, 0x06, 0x11, 0xd1, 0x05, 0xfc, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xef, 0xc1, 0x04, 0x08, 0x00, 0x00, 0x00, 0xc8, 0xe4, 0x09, 0xd1, 0x05, 0xef, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xea, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x57, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xee, 0xc1, 0x04, 0x08, 0x00, 0x00, 0x00, 0xd0, 0xc6, 0x0a, 0xd1, 0x05, 0xf1, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfb, 0xd1, 0x24, 0x0f, 
-  0x00, 0x00, 0x00, 0xd1, 0x05, 0xba, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x84, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xdc, 0xd9, 0x45, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xea, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x25, 0x0e, 0xd1, 0x05, 0xdd, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x5a, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xb7, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd1, 0x05, 0x5d, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xe5, 0x13, 0xd1, 0x05, 0xec, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xb2, 0xf8, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xea, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0xd1, 0x05, 0xb3, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xea, 0xd1, 0x06, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xcc, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x5b, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xc1, 0x04, 0x08, 0xd1, 0x05, 0xe7, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x62, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x93, 0xf8, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x8c, 0xd1, 0x05, 0x99, 0xd1, 0x05, 0x99, 0xd1, 0x05, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0xd1, 0x05, 0x94, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x4d, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xe5, 0xc1, 0x04, 0x08, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x75, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xd9, 0xd9, 0x25, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0xa9, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xb2, 0xd9, 0x45, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x25, 0x0e, 0xd1, 0x05, 0xb3, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0x04, 0x08, 0xd1, 0x05, 0xdb, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xe4, 0x09, 0xd1, 0x05, 0xdf, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xc6, 0x0b, 0xd1, 0x05, 0xc9, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xdd, 0xd1, 0x05, 0x56, 0xf8, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x01, 0xd1, 0x05, 0x57, 0xd1, 0x05, 0xdd, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xc7, 0xd0, 0xc6, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x88, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xdc, 0xc1, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x4e, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfd, 0xd1, 0x05, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xe5, 0x13, 0xd1, 0x05, 0xc8, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xcb, 0xd1, 0x05, 0x6a, 0xd1, 0x25, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x1d, 0xd1, 0x05, 0x6b, 0xd1, 0x05, 0xcb, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xc7, 0xd8, 0xe5, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x49, 0xd1, 0x05, 0xfd, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x25, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x9e, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xf0, 0xd1, 0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xc6, 0x0b, 0xd1, 0x05, 0xa8, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xfe, 0xd1, 0x05, 0xd8, 0xd1, 0x05, 0xbc, 0xd1, 0x05, 0xa2, 0xd1, 0x05, 0xa2, 0xd1, 0x05, 0xbc, 0xd1, 0x05, 0xd8, 0xd1, 0x05, 0xfe, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xa6, 0xd0, 0xc6, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x30, 0xd1, 0x05, 0xf1, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xc6, 0x0b, 0xd1, 0x05, 0xd3, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x61, 0xd1, 0x05, 0xeb, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xea, 0xd1, 0x05, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x74, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xd1, 0xd0, 0xc6, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x1d, 0xd1, 0x05, 0xe3, 0xd1, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xe5, 0x12, 0xd1, 0x05, 0x83, 0xd1, 0x05, 0xee, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xee, 0xd1, 0x05, 0x81, 0xd1, 0x06, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x80, 0xd1, 0x05, 0xe2, 0xd1, 0x25, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x25, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0x04, 0x08, 0xd1, 0x05, 0x55, 0xd1, 0x05, 0xa2, 0xd1, 0x05, 0xe1, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xff, 0xd1, 0x05, 0xe0, 0xd1, 0x05, 0xa1, 0xd1, 0x05, 0x54, 0xc1, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x45, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x65, 0x0c, 0xd1, 0x25, 0x2c, 0xd1, 0x05, 0x38, 0xd1, 0x05, 0x38, 0xd1, 0x25, 0x2c, 0xd9, 0x65, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xc8, 0x0e, 0x26, 0x21, 0xcd, 0x2e, 0x28, 0x1f, 0xcd, 0x39, 0x28, 0x1f, 0xcd, 0x39, 0x26, 0x21, 0xcd, 0x2e, 0x24, 0x24, 0xc8, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xce, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0xc6, 0x09, 0x28, 0x22, 0xce, 0x59, 0x29, 0x20, 0xcf, 0xa5, 0x28, 0x20, 0xce, 0xe3, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xce, 0xe2, 0x28, 0x20, 0xce, 0xa4, 0x28, 0x1f, 0xcd, 0x58, 0x1c, 0x1c, 0xc6, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xce, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x22, 0xcc, 0x1e, 0x28, 0x20, 0xce, 0xe3, 0x29, 0x21, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x26, 0xcc, 0x14, 0x29, 0x20, 0xcf, 0x86, 0x29, 0x20, 0xcf, 0xf0, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xef, 0x28, 0x20, 0xce, 0x84, 0x28, 0x1a, 0xc9, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xcf, 0x80, 0x28, 0x20, 0xce, 0xe3, 0x2b, 0x23, 0xd3, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x17, 0xd0, 0x0b, 0x28, 0x20, 0xce, 0xd4, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xce, 0x64, 0x28, 0x21, 0xce, 0xed, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xec, 0x29, 0x21, 0xd0, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xce, 0x74, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0xd2, 0x33, 0x19, 0xcc, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xcf, 0xa0, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xf0, 0x2b, 0x20, 0xce, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x2a, 0xd4, 0x0c, 0x29, 0x20, 0xcf, 0xac, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xfe, 0x28, 0x21, 0xcf, 0xd6, 0x29, 0x20, 0xcf, 0xba, 0x29, 0x21, 0xcf, 0xa1, 0x29, 0x21, 0xcf, 0xa1, 0x28, 0x20, 0xcf, 0xbb, 0x29, 0x21, 0xcf, 0xd7, 0x29, 0x21, 0xce, 0xfe, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xa9, 0x2e, 0x17, 0xd0, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x1f, 0xcf, 0x30, 0x29, 0x20, 0xcf, 0xf0, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xce, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x1f, 0xcf, 0x50, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xfd, 0x28, 0x20, 0xcf, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1a, 0xc9, 0x13, 0x28, 0x20, 0xcf, 0xca, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0xca, 0x29, 0x1f, 0xcd, 0x68, 0x25, 0x1c, 0xcf, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x1c, 0xcf, 0x1b, 0x29, 0x22, 0xce, 0x69, 0x28, 0x20, 0xcf, 0xca, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xc8, 0x28, 0x1a, 0xc9, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x1f, 0xcd, 0x48, 0x29, 0x21, 0xce, 0xfd, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x27, 0x21, 0xd0, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x19, 0xcc, 0x0a, 0x28, 0x21, 0xcf, 0xe0, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x2a, 0xd4, 0x0c, 0x28, 0x20, 0xcf, 0xca, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0xdb, 0x2a, 0x21, 0xce, 0x54, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x2a, 0x21, 0xcf, 0x55, 0x28, 0x20, 0xcf, 0xdb, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xc8, 0x2e, 0x17, 0xd0, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0x87, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xde, 0x1c, 0x1c, 0xc6, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xcf, 0x77, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0xda, 0x24, 0x24, 0xda, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0xa6, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xb6, 0x22, 0x22, 0xcc, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x2a, 0xd4, 0x0c, 0x28, 0x21, 0xce, 0xaf, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x2a, 0xd4, 0x06, 0x29, 0x21, 0xce, 0xd8, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xd0, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0xbf, 0x08, 0x28, 0x21, 0xcf, 0xe7, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x2a, 0x1f, 0xcd, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xce, 0x64, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0x92, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0x8c, 0x29, 0x21, 0xce, 0x99, 0x29, 0x21, 0xce, 0x99, 0x29, 0x20, 0xcf, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x29, 0x20, 0xce, 0x93, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x2a, 0x22, 0xcf, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x22, 0xcf, 0x4b, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xe6, 0x1f, 0x1f, 0xbf, 0x08, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcd, 0x5d, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xce, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x26, 0xcc, 0x14, 0x28, 0x21, 0xce, 0xed, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xb0, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0xea, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x29, 0x20, 0xce, 0xb2, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xeb, 0x2a, 0x1c, 0xd4, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0xcb, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0x5c, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0xba, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x1f, 0xcd, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0x86, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0xdb, 0x27, 0x27, 0xd7, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0xea, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x27, 0xd7, 0x0d, 0x29, 0x21, 0xce, 0xdd, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x22, 0xce, 0x5a, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xb8, 0x00, 0x00, 0x00, 0x00, 
-  0x2d, 0x1e, 0xd2, 0x11, 0x29, 0x21, 0xcf, 0xfc, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xef, 0x1f, 0x1f, 0xbf, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0xc6, 0x09, 0x28, 0x21, 0xce, 0xef, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x2a, 0x21, 0xce, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0xea, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0x56, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xee, 0x1f, 0x1f, 0xbf, 0x08, 0x00, 0x00, 0x00, 0x00, 0x33, 0x19, 0xcc, 0x0a, 0x29, 0x20, 0xcf, 0xf1, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0xfb, 0x22, 0x22, 0xcc, 0x0f, 
-  0x29, 0x1f, 0xcf, 0x50, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x22, 0xce, 0x59, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xce, 0xc9, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0xea, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x28, 0x20, 0xcf, 0xca, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x2a, 0x21, 0xcf, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0xaa, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x2a, 0x20, 0xcd, 0x4e, 
-  0x29, 0x20, 0xcf, 0x8c, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0xa5, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x22, 0xce, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0xea, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xce, 0x6a, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x1f, 0xcd, 0x68, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0x8a, 
-  0x29, 0x20, 0xce, 0xb4, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x1e, 0xd1, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xce, 0xe3, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xfe, 0x25, 0x1c, 0xcf, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0xea, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xd1, 0x1c, 0x29, 0x21, 0xce, 0xfe, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x22, 0xcd, 0x34, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0xb3, 
-  0x28, 0x20, 0xcf, 0xda, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xfe, 0x2a, 0x2a, 0xd4, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xc8, 0x0e, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0xea, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xce, 0xd8, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xfe, 0x27, 0x27, 0xd7, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xc8, 0x0e, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xd8, 
-  0x29, 0x21, 0xcf, 0xec, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x22, 0xd0, 0x2c, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0xea, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xcf, 0xbc, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x23, 0xcf, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xce, 0xf4, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xeb, 
-  0x28, 0x20, 0xce, 0xf9, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x23, 0xce, 0x3a, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0xea, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xcf, 0xa1, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x1f, 0xcd, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xcf, 0xe6, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0xf8, 
-  0x28, 0x20, 0xce, 0xf9, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x23, 0xce, 0x3a, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0xea, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0xa2, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x1f, 0xcd, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xcf, 0xe6, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0xf8, 
-  0x29, 0x21, 0xcf, 0xec, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x22, 0xd0, 0x2c, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xcf, 0xda, 0x28, 0x21, 0xce, 0xee, 0x28, 0x21, 0xce, 0xee, 0x28, 0x20, 0xcf, 0xda, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xcf, 0xbc, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x23, 0xcf, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xce, 0xf4, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xeb, 
-  0x28, 0x20, 0xcf, 0xda, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xfe, 0x2a, 0x2a, 0xd4, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xc8, 0x0e, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xce, 0xd8, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xfe, 0x2a, 0x2a, 0xd4, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xc8, 0x0e, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xd8, 
-  0x29, 0x20, 0xce, 0xb4, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x23, 0xcd, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xce, 0xe2, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xfe, 0x25, 0x1c, 0xcf, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x23, 0xd3, 0x1d, 0x29, 0x21, 0xce, 0xfe, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x21, 0xce, 0x35, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0xb2, 
-  0x29, 0x20, 0xcf, 0x8c, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xce, 0xa4, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0x6b, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x1f, 0xcd, 0x68, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0x8a, 
-  0x29, 0x1f, 0xcf, 0x50, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1f, 0xcd, 0x58, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0xca, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcd, 0x3e, 0x29, 0x21, 0xce, 0x44, 0x29, 0x21, 0xce, 0x44, 0x29, 0x20, 0xcd, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x29, 0x20, 0xcf, 0xcb, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x2a, 0x21, 0xce, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xcf, 0xaa, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x27, 0x21, 0xd0, 0x4d, 
-  0x2d, 0x1e, 0xd2, 0x11, 0x29, 0x21, 0xcf, 0xfc, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xef, 0x1f, 0x1f, 0xbf, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0xc6, 0x09, 0x28, 0x21, 0xce, 0xef, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x2a, 0x21, 0xcf, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0xea, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xd0, 0x57, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xee, 0x1f, 0x1f, 0xbf, 0x08, 0x00, 0x00, 0x00, 0x00, 0x33, 0x19, 0xcc, 0x0a, 0x29, 0x20, 0xcf, 0xf1, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0xfb, 0x22, 0x22, 0xcc, 0x0f, 
-  0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0xba, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x1f, 0xcd, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xce, 0x84, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0xdc, 0x27, 0x27, 0xd7, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0xea, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xc8, 0x0e, 0x29, 0x21, 0xce, 0xdd, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x22, 0xce, 0x5a, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xb7, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcd, 0x5d, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xce, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1a, 0xc9, 0x13, 0x29, 0x21, 0xcf, 0xec, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0xb2, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0xea, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x29, 0x20, 0xce, 0xb3, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xea, 0x2d, 0x1e, 0xd2, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0xcc, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x2a, 0x21, 0xcf, 0x5b, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0xbf, 0x08, 0x28, 0x21, 0xcf, 0xe7, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x1f, 0xce, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xd0, 0x62, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0x93, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0x8c, 0x29, 0x21, 0xce, 0x99, 0x29, 0x21, 0xce, 0x99, 0x29, 0x20, 0xcf, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x29, 0x20, 0xce, 0x94, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xce, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x21, 0xd0, 0x4d, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xe5, 0x1f, 0x1f, 0xbf, 0x08, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xcf, 0x75, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0xd9, 0x24, 0x24, 0xda, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0xce, 0xa9, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0xb2, 0x27, 0x27, 0xd7, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xc8, 0x0e, 0x29, 0x20, 0xce, 0xb3, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0xbf, 0x08, 0x28, 0x20, 0xcf, 0xdb, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0xc6, 0x09, 0x29, 0x21, 0xce, 0xdf, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x17, 0xd0, 0x0b, 0x28, 0x20, 0xce, 0xc9, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xdd, 0x29, 0x20, 0xcf, 0x56, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x29, 0x20, 0xd0, 0x57, 0x29, 0x21, 0xce, 0xdd, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xc7, 0x33, 0x19, 0xcc, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xce, 0x88, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x20, 0xcf, 0xdc, 0x1f, 0x1f, 0xbf, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x20, 0xcd, 0x4e, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xfd, 0x2a, 0x1f, 0xcd, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1a, 0xc9, 0x13, 0x28, 0x21, 0xce, 0xc8, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xcb, 0x28, 0x21, 0xce, 0x6a, 0x24, 0x24, 0xd1, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x23, 0xd3, 0x1d, 0x28, 0x21, 0xcf, 0x6b, 0x29, 0x20, 0xcf, 0xcb, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xc7, 0x2a, 0x1c, 0xd4, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x1f, 0xce, 0x49, 0x29, 0x21, 0xce, 0xfd, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x22, 0xcf, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0xce, 0x9e, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xf0, 0x2a, 0x1f, 0xcf, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x17, 0xd0, 0x0b, 0x28, 0x21, 0xce, 0xa8, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xce, 0xfe, 0x29, 0x21, 0xce, 0xd8, 0x28, 0x20, 0xcf, 0xbc, 0x28, 0x21, 0xcf, 0xa2, 0x28, 0x21, 0xcf, 0xa2, 0x28, 0x20, 0xcf, 0xbc, 0x29, 0x21, 0xce, 0xd8, 0x29, 0x21, 0xce, 0xfe, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xa6, 0x33, 0x19, 0xcc, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x1f, 0xcf, 0x30, 0x29, 0x20, 0xcf, 0xf1, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x17, 0xd0, 0x0b, 0x29, 0x20, 0xce, 0xd3, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xce, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x22, 0xcf, 0x61, 0x29, 0x20, 0xcf, 0xeb, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xea, 0x28, 0x20, 0xce, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0xce, 0x74, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x20, 0xcf, 0xd1, 0x33, 0x19, 0xcc, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x23, 0xd3, 0x1d, 0x28, 0x20, 0xce, 0xe3, 0x29, 0x21, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x1c, 0xd4, 0x12, 0x28, 0x21, 0xce, 0x83, 0x28, 0x21, 0xce, 0xee, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xee, 0x29, 0x21, 0xcf, 0x81, 0x2d, 0x1e, 0xd2, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x21, 0xcf, 0x80, 0x28, 0x20, 0xce, 0xe2, 0x24, 0x24, 0xd1, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xce, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0xbf, 0x08, 0x2a, 0x21, 0xcf, 0x55, 0x28, 0x21, 0xcf, 0xa2, 0x28, 0x20, 0xcf, 0xe1, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x29, 0x21, 0xcf, 0xff, 0x28, 0x21, 0xcf, 0xe0, 0x29, 0x21, 0xcf, 0xa1, 0x2a, 0x21, 0xce, 0x54, 0x1f, 0x1f, 0xbf, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x26, 0xcc, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x2a, 0xd4, 0x0c, 0x28, 0x22, 0xd0, 0x2c, 0x28, 0x1f, 0xcc, 0x38, 0x28, 0x1f, 0xcc, 0x38, 0x28, 0x22, 0xd0, 0x2c, 0x2a, 0x2a, 0xd4, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
+  /*Packed: ARGB8888 + vector, 8464 bytes LZ4 compressed*/
+  0x47, 0x50, 0x01, 0x01, 0x00, 0x00, 0x00, 0xff, 0xc2, 0x08, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xd7, 0xc0, 0x24, 0x24, 0xc8, 0x0e, 0x26, 0x21, 0xcd, 0x2e, 0x28, 0x1f, 0xcd, 
+  0x39, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x14, 0x00, 0x0f, 0xff, 0x03, 0x55, 0x4f, 0x24, 0x24, 0xce, 0x15, 0x6c, 0x00, 0x11, 0xff, 0x05, 0x1c, 0x1c, 0xc6, 0x09, 0x28, 0x22, 0xce, 0x59, 0x29, 
+  0x20, 0xcf, 0xa5, 0x28, 0x20, 0xce, 0xe3, 0x29, 0x21, 0xcf, 0xff, 0x04, 0x00, 0x01, 0xc0, 0x28, 0x20, 0xce, 0xe2, 0x28, 0x20, 0xce, 0xa4, 0x28, 0x1f, 0xcd, 0x58, 0x34, 0x00, 0x0f, 0x5c, 0x00, 
+  0x11, 0x0f, 0x84, 0x00, 0x15, 0x04, 0x4c, 0x00, 0x43, 0x2a, 0x22, 0xcc, 0x1e, 0x84, 0x00, 0x14, 0x80, 0x14, 0x00, 0x0c, 0x08, 0x00, 0xcf, 0x26, 0x26, 0xcc, 0x14, 0x29, 0x20, 0xcf, 0x86, 0x29, 
+  0x20, 0xcf, 0xf0, 0xa8, 0x00, 0x01, 0x0f, 0x14, 0x00, 0x09, 0xcc, 0x28, 0x21, 0xce, 0xef, 0x28, 0x20, 0xce, 0x84, 0x28, 0x1a, 0xc9, 0x13, 0x58, 0x00, 0x04, 0x10, 0x00, 0x40, 0x29, 0x21, 0xcf, 
+  0x80, 0x84, 0x00, 0x44, 0x2b, 0x23, 0xd3, 0x1d, 0x14, 0x00, 0x0f, 0x08, 0x00, 0x09, 0x85, 0x2e, 0x17, 0xd0, 0x0b, 0x28, 0x20, 0xce, 0xd4, 0x78, 0x00, 0x3c, 0x20, 0xce, 0x74, 0x30, 0x00, 0x85, 
+  0x28, 0x21, 0xce, 0x64, 0x28, 0x21, 0xce, 0xed, 0x24, 0x00, 0x0f, 0x64, 0x01, 0x04, 0x0f, 0x20, 0x00, 0x10, 0x5c, 0xec, 0x29, 0x21, 0xd0, 0x62, 0x60, 0x00, 0x45, 0x29, 0x20, 0xce, 0x74, 0x3c, 
+  0x00, 0x7c, 0x20, 0xce, 0xd2, 0x33, 0x19, 0xcc, 0x0a, 0x24, 0x00, 0x0c, 0x10, 0x00, 0x46, 0x29, 0x21, 0xcf, 0xa0, 0x34, 0x00, 0x64, 0xcf, 0xf0, 0x2b, 0x20, 0xce, 0x2f, 0x24, 0x00, 0x85, 0x2a, 
+  0x2a, 0xd4, 0x0c, 0x29, 0x20, 0xcf, 0xac, 0x20, 0x00, 0x0d, 0xb0, 0x00, 0xe0, 0xce, 0xfe, 0x28, 0x21, 0xcf, 0xd6, 0x29, 0x20, 0xcf, 0xba, 0x29, 0x21, 0xcf, 0xa1, 0x04, 0x00, 0xcf, 0x28, 0x20, 
+  0xcf, 0xbb, 0x29, 0x21, 0xcf, 0xd7, 0x29, 0x21, 0xce, 0xfe, 0x38, 0x00, 0x05, 0x40, 0x28, 0x21, 0xce, 0xa9, 0x30, 0x01, 0x05, 0x68, 0x00, 0x38, 0x1f, 0xcf, 0x30, 0xc8, 0x01, 0x44, 0x28, 0x20, 
+  0xce, 0x9d, 0x1c, 0x00, 0x0f, 0x08, 0x00, 0x01, 0x46, 0x29, 0x1f, 0xcf, 0x50, 0x5c, 0x00, 0x64, 0xce, 0xfd, 0x28, 0x20, 0xcf, 0x46, 0x28, 0x00, 0x00, 0xd4, 0x01, 0x46, 0x28, 0x20, 0xcf, 0xca, 
+  0x20, 0x00, 0x06, 0xc8, 0x02, 0x01, 0x18, 0x00, 0x74, 0x1f, 0xcd, 0x68, 0x25, 0x1c, 0xcf, 0x1b, 0x30, 0x00, 0x0c, 0x08, 0x00, 0x00, 0x1c, 0x00, 0x41, 0x29, 0x22, 0xce, 0x69, 0x2c, 0x00, 0x0d, 
+  0xf0, 0x00, 0x60, 0xcf, 0xff, 0x28, 0x21, 0xce, 0xc8, 0x64, 0x00, 0x04, 0x38, 0x00, 0x84, 0x2a, 0x1f, 0xcd, 0x48, 0x29, 0x21, 0xce, 0xfd, 0x70, 0x00, 0x44, 0x27, 0x21, 0xd0, 0x4d, 0x1c, 0x00, 
+  0x08, 0x08, 0x00, 0x00, 0x8c, 0x01, 0x44, 0x28, 0x21, 0xcf, 0xe0, 0x28, 0x00, 0x44, 0x28, 0x20, 0xcf, 0x85, 0x20, 0x00, 0x00, 0x68, 0x01, 0x0f, 0x70, 0x00, 0x01, 0xc4, 0x28, 0x20, 0xcf, 0xdb, 
+  0x2a, 0x21, 0xce, 0x54, 0x00, 0x00, 0xff, 0x01, 0x2c, 0x00, 0x0f, 0x08, 0x00, 0x0f, 0x60, 0xff, 0x01, 0x2a, 0x21, 0xcf, 0x55, 0x3c, 0x00, 0x04, 0x6c, 0x00, 0x04, 0x08, 0x00, 0x00, 0xbc, 0x00, 
+  0x08, 0x78, 0x01, 0x44, 0x29, 0x20, 0xcf, 0x87, 0x1c, 0x00, 0x4f, 0x29, 0x21, 0xce, 0xde, 0xd0, 0x03, 0x01, 0x44, 0x28, 0x20, 0xcf, 0x77, 0x24, 0x00, 0x84, 0x28, 0x20, 0xcf, 0xda, 0x24, 0x24, 
+  0xda, 0x07, 0x84, 0x00, 0x44, 0x29, 0x20, 0xcf, 0xa6, 0x1c, 0x00, 0x04, 0x08, 0x00, 0x84, 0x28, 0x21, 0xcf, 0xb6, 0x22, 0x22, 0xcc, 0x0f, 0x24, 0x00, 0x0f, 0x08, 0x00, 0x1d, 0x01, 0x0c, 0x01, 
+  0x34, 0x21, 0xce, 0xaf, 0x50, 0x00, 0x04, 0x08, 0x00, 0x44, 0x28, 0x21, 0xcf, 0xaa, 0x4c, 0x00, 0x86, 0x2a, 0x2a, 0xd4, 0x06, 0x29, 0x21, 0xce, 0xd8, 0x1c, 0x00, 0x24, 0xd0, 0x72, 0x1c, 0x00, 
+  0x00, 0x08, 0x00, 0x84, 0x1f, 0x1f, 0xbf, 0x08, 0x28, 0x21, 0xcf, 0xe7, 0x20, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x18, 0x00, 0x00, 0x04, 0x00, 0x00, 0x84, 0x03, 0x04, 0x18, 0x00, 0x04, 0x08, 0x00, 
+  0x80, 0x28, 0x21, 0xcf, 0x92, 0x00, 0x00, 0xff, 0x02, 0x20, 0x00, 0x0f, 0x04, 0x00, 0x01, 0x81, 0x29, 0x20, 0xcf, 0x8c, 0x29, 0x21, 0xce, 0x99, 0x04, 0x00, 0x3f, 0x20, 0xcf, 0x8c, 0x24, 0x00, 
+  0x01, 0x02, 0x14, 0x00, 0x64, 0xff, 0x02, 0x29, 0x20, 0xce, 0x93, 0x58, 0x00, 0x04, 0x08, 0x00, 0x42, 0x2a, 0x22, 0xcf, 0x61, 0x20, 0x00, 0x64, 0x00, 0x00, 0x28, 0x22, 0xcf, 0x4b, 0x18, 0x00, 
+  0x40, 0x29, 0x21, 0xcf, 0xe6, 0xac, 0x00, 0x04, 0x1c, 0x00, 0x44, 0x29, 0x20, 0xcd, 0x5d, 0x1c, 0x00, 0x44, 0x28, 0x20, 0xce, 0xc9, 0x18, 0x00, 0x00, 0xec, 0x04, 0x0c, 0x38, 0x04, 0x4f, 0x28, 
+  0x21, 0xcf, 0xb0, 0xb4, 0x00, 0x09, 0x00, 0x3c, 0x00, 0x44, 0x29, 0x20, 0xcf, 0xea, 0x50, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x14, 0x00, 0x0f, 0x04, 0x00, 0x07, 0x01, 0xbc, 0x00, 0x15, 0xb2, 0x30, 
+  0x00, 0x00, 0xfc, 0x02, 0x74, 0x20, 0xcf, 0xeb, 0x2a, 0x1c, 0xd4, 0x12, 0x34, 0x00, 0x47, 0x29, 0x20, 0xcf, 0xcb, 0x20, 0x00, 0x17, 0x5c, 0x18, 0x00, 0x00, 0x00, 0x04, 0x01, 0x30, 0x06, 0x00, 
+  0x18, 0x06, 0x07, 0x18, 0x00, 0x17, 0x86, 0x30, 0x00, 0x10, 0xff, 0x94, 0x02, 0x44, 0x27, 0x27, 0xd7, 0x0d, 0x20, 0x00, 0x0f, 0x08, 0x00, 0x05, 0x00, 0xac, 0x00, 0x05, 0x38, 0x00, 0x3f, 0x20, 
+  0xcf, 0xea, 0x28, 0x00, 0x05, 0x04, 0x18, 0x00, 0x00, 0x54, 0x00, 0x45, 0x29, 0x21, 0xce, 0xdd, 0x34, 0x00, 0x11, 0x21, 0xa8, 0x03, 0x15, 0x83, 0x20, 0x00, 0x36, 0x22, 0xce, 0x5a, 0x1c, 0x00, 
+  0x20, 0xce, 0xb8, 0x18, 0x00, 0x80, 0x2d, 0x1e, 0xd2, 0x11, 0x29, 0x21, 0xcf, 0xfc, 0x18, 0x00, 0x00, 0x10, 0x06, 0x04, 0x88, 0x01, 0x00, 0x04, 0x03, 0x00, 0x10, 0x00, 0x00, 0x18, 0x00, 0x04, 
+  0x04, 0x00, 0x02, 0x84, 0x03, 0x00, 0x36, 0x00, 0x0f, 0x04, 0x00, 0x0b, 0x0f, 0xb8, 0x00, 0x1d, 0x00, 0x4e, 0x00, 0x44, 0x29, 0x20, 0xcf, 0x56, 0x68, 0x00, 0x00, 0x08, 0x00, 0x44, 0x28, 0x21, 
+  0xce, 0xee, 0x8c, 0x00, 0x00, 0x34, 0x04, 0x41, 0x29, 0x20, 0xcf, 0xf1, 0x18, 0x00, 0x30, 0x20, 0xcf, 0xfb, 0x58, 0x03, 0x0a, 0xfc, 0x04, 0x20, 0xcf, 0xa7, 0x44, 0x00, 0x00, 0x04, 0x00, 0x01, 
+  0xbc, 0x07, 0x00, 0xb4, 0x01, 0x03, 0x04, 0x00, 0x02, 0x40, 0x02, 0x0f, 0x38, 0x04, 0x13, 0x0f, 0xb8, 0x00, 0x21, 0x00, 0x94, 0x04, 0x0c, 0xb4, 0x04, 0x00, 0x78, 0x04, 0x00, 0x8c, 0x00, 0x00, 
+  0x04, 0x00, 0x00, 0xb0, 0x03, 0x00, 0xb8, 0x00, 0x00, 0x04, 0x00, 0x42, 0x2a, 0x20, 0xcd, 0x4e, 0x44, 0x03, 0x02, 0x8c, 0x05, 0x40, 0x28, 0x20, 0xcf, 0x65, 0x24, 0x00, 0x00, 0x04, 0x00, 0x00, 
+  0x70, 0x08, 0x00, 0x24, 0x00, 0x05, 0x04, 0x00, 0x30, 0x22, 0xce, 0x69, 0x18, 0x00, 0x0f, 0x04, 0x00, 0x11, 0x0f, 0xb8, 0x00, 0x23, 0x65, 0x00, 0x00, 0x28, 0x21, 0xce, 0x6a, 0x70, 0x00, 0x01, 
+  0x2c, 0x02, 0x24, 0xcf, 0xa2, 0x70, 0x00, 0x44, 0x29, 0x1f, 0xcd, 0x68, 0x1c, 0x00, 0x85, 0x28, 0x21, 0xce, 0x8a, 0x29, 0x20, 0xce, 0xb4, 0x10, 0x00, 0x34, 0x1e, 0xd1, 0x32, 0x28, 0x00, 0x00, 
+  0x1c, 0x08, 0x04, 0x18, 0x00, 0x00, 0xec, 0x06, 0x00, 0x38, 0x06, 0x04, 0x1c, 0x00, 0x0f, 0x08, 0x00, 0x0d, 0x0f, 0xb8, 0x00, 0x25, 0x40, 0x24, 0x24, 0xd1, 0x1c, 0x6c, 0x00, 0x04, 0x78, 0x00, 
+  0x44, 0x28, 0x20, 0xcf, 0xe1, 0x6c, 0x00, 0x44, 0x27, 0x22, 0xcd, 0x34, 0x18, 0x00, 0x40, 0x29, 0x20, 0xce, 0xb3, 0xac, 0x05, 0x02, 0x10, 0x00, 0x20, 0xce, 0xfe, 0x54, 0x05, 0x00, 0x28, 0x00, 
+  0x00, 0x78, 0x0a, 0x02, 0x14, 0x00, 0x03, 0x88, 0x01, 0x30, 0x21, 0xcf, 0xd6, 0x18, 0x00, 0x0f, 0x04, 0x00, 0x15, 0x0f, 0xb8, 0x00, 0x25, 0x00, 0x60, 0x00, 0x08, 0xb0, 0x05, 0x00, 0xc4, 0x00, 
+  0x00, 0xb4, 0x03, 0x00, 0x18, 0x00, 0x0a, 0x94, 0x00, 0x01, 0xd4, 0x05, 0x11, 0xec, 0xa4, 0x00, 0x30, 0x20, 0xce, 0xf2, 0x20, 0x00, 0x00, 0x04, 0x00, 0x41, 0x28, 0x22, 0xd0, 0x2c, 0x14, 0x00, 
+  0x03, 0xdc, 0x02, 0x00, 0x70, 0x08, 0x00, 0x18, 0x00, 0x0f, 0x04, 0x00, 0x15, 0x0f, 0xb8, 0x00, 0x29, 0x49, 0x28, 0x20, 0xcf, 0xbc, 0x7c, 0x00, 0x34, 0x23, 0xcf, 0x2b, 0x78, 0x00, 0x41, 0x28, 
+  0x21, 0xce, 0xf4, 0x1c, 0x00, 0x71, 0x20, 0xcf, 0xeb, 0x28, 0x20, 0xce, 0xf9, 0x0c, 0x00, 0x34, 0x21, 0xcf, 0xe5, 0x20, 0x00, 0x43, 0x27, 0x23, 0xce, 0x3a, 0x14, 0x00, 0x01, 0x1c, 0x05, 0x00, 
+  0x6c, 0x09, 0x04, 0x1c, 0x00, 0x0f, 0x08, 0x00, 0x11, 0x0f, 0xb8, 0x00, 0x29, 0x00, 0x8c, 0x09, 0x08, 0x7c, 0x00, 0x00, 0x7c, 0x0c, 0x04, 0x74, 0x00, 0x00, 0x78, 0x06, 0x01, 0x1c, 0x00, 0x3f, 
+  0x20, 0xce, 0xf8, 0xb8, 0x00, 0x14, 0x14, 0xa1, 0x3c, 0x00, 0x0f, 0x08, 0x00, 0x11, 0x0f, 0xb8, 0x00, 0x29, 0x41, 0x28, 0x21, 0xcf, 0xa2, 0x9c, 0x00, 0x03, 0xec, 0x01, 0x0f, 0xb8, 0x00, 0x05, 
+  0x3f, 0x29, 0x21, 0xcf, 0x28, 0x02, 0x0e, 0x00, 0x8c, 0x0a, 0x0f, 0xb0, 0x00, 0x11, 0x04, 0x24, 0x00, 0x00, 0x34, 0x03, 0x00, 0x80, 0x05, 0x01, 0x04, 0x00, 0x34, 0x20, 0xcf, 0xda, 0x18, 0x00, 
+  0x0f, 0x08, 0x00, 0x11, 0x0f, 0x28, 0x02, 0x17, 0x22, 0xcf, 0xda, 0xe0, 0x00, 0x0f, 0x98, 0x03, 0x07, 0x00, 0x40, 0x0b, 0x0f, 0x74, 0x00, 0x11, 0x0f, 0x24, 0x00, 0x31, 0x0c, 0x98, 0x03, 0x0f, 
+  0x2c, 0x04, 0x03, 0x29, 0xce, 0xd8, 0x08, 0x05, 0x34, 0x23, 0xcd, 0x33, 0x7c, 0x00, 0x00, 0x10, 0x0e, 0x02, 0xd0, 0x00, 0x00, 0x54, 0x04, 0x2f, 0xce, 0xfe, 0x08, 0x05, 0x19, 0x04, 0x44, 0x00, 
+  0x0f, 0x08, 0x00, 0x1d, 0x00, 0x94, 0x0d, 0x00, 0x44, 0x04, 0x04, 0x78, 0x00, 0x00, 0x58, 0x0b, 0x04, 0x44, 0x00, 0x44, 0x2b, 0x21, 0xce, 0x35, 0x18, 0x00, 0x4b, 0x29, 0x20, 0xce, 0xb2, 0x78, 
+  0x06, 0x14, 0x66, 0x28, 0x00, 0x00, 0xc4, 0x0e, 0x05, 0x28, 0x00, 0x01, 0x04, 0x06, 0x24, 0xce, 0x6a, 0x1c, 0x00, 0x0f, 0x08, 0x00, 0x45, 0x48, 0x28, 0x21, 0xcf, 0x6b, 0x74, 0x00, 0x00, 0xa4, 
+  0x03, 0x04, 0x6c, 0x00, 0x0d, 0x78, 0x06, 0x09, 0xe4, 0x0c, 0x07, 0xe8, 0x07, 0x38, 0x1f, 0xcd, 0x58, 0x44, 0x00, 0x00, 0x84, 0x07, 0x00, 0x8c, 0x07, 0x04, 0x48, 0x00, 0x0f, 0x08, 0x00, 0x09, 
+  0x81, 0x29, 0x20, 0xcd, 0x3e, 0x29, 0x21, 0xce, 0x44, 0x04, 0x00, 0x3f, 0x20, 0xcd, 0x3e, 0x2c, 0x00, 0x09, 0x06, 0x1c, 0x00, 0x2b, 0xff, 0x01, 0xf8, 0x09, 0x18, 0xff, 0x10, 0x09, 0x08, 0xe8, 
+  0x07, 0x00, 0xfc, 0x0c, 0x0f, 0x58, 0x09, 0x1b, 0x26, 0xcf, 0x55, 0x68, 0x00, 0x0f, 0x0a, 0x00, 0x07, 0x0f, 0x50, 0x04, 0x21, 0x49, 0x29, 0x20, 0xd0, 0x57, 0x28, 0x01, 0x0f, 0x58, 0x09, 0x0c, 
+  0x00, 0x7e, 0x00, 0x00, 0x58, 0x06, 0x04, 0x34, 0x00, 0x08, 0xc8, 0x0a, 0x00, 0x2c, 0x10, 0x04, 0x18, 0x00, 0x00, 0x08, 0x00, 0x44, 0x28, 0x20, 0xcf, 0xdc, 0xc0, 0x06, 0x00, 0x38, 0x00, 0x0f, 
+  0x04, 0x00, 0x05, 0x0f, 0xb8, 0x00, 0x1d, 0x02, 0x0c, 0x07, 0x0a, 0xc8, 0x0a, 0x44, 0x29, 0x21, 0xcf, 0x81, 0x60, 0x00, 0x17, 0x27, 0xc8, 0x0a, 0x44, 0x28, 0x21, 0xcf, 0xb7, 0x18, 0x00, 0x0f, 
+  0x38, 0x0c, 0x05, 0x00, 0xa8, 0x0e, 0x05, 0x28, 0x05, 0x03, 0x50, 0x05, 0x00, 0x14, 0x03, 0x0f, 0x38, 0x0c, 0x40, 0x10, 0xb3, 0x18, 0x01, 0x05, 0x04, 0x00, 0x30, 0x20, 0xcf, 0xea, 0x08, 0x02, 
+  0x06, 0xa0, 0x00, 0x24, 0xcf, 0xcc, 0x1c, 0x00, 0x44, 0x2a, 0x21, 0xcf, 0x5b, 0x18, 0x00, 0x00, 0xe8, 0x0a, 0x08, 0xa8, 0x0d, 0x44, 0x29, 0x1f, 0xce, 0x49, 0x1c, 0x00, 0x00, 0xe0, 0x10, 0x04, 
+  0x34, 0x00, 0x05, 0x08, 0x00, 0x3f, 0x20, 0xce, 0x93, 0xbc, 0x00, 0x09, 0x02, 0xec, 0x03, 0x0f, 0xa8, 0x0d, 0x16, 0x15, 0x94, 0x58, 0x00, 0x03, 0x1c, 0x01, 0x44, 0x28, 0x20, 0xce, 0x5f, 0x80, 
+  0x00, 0x00, 0xcc, 0x02, 0x07, 0x20, 0x00, 0x10, 0xe5, 0xac, 0x00, 0x04, 0x1c, 0x00, 0x00, 0x08, 0x00, 0x45, 0x29, 0x20, 0xcf, 0x75, 0x20, 0x00, 0x38, 0x20, 0xce, 0xd9, 0x18, 0x0f, 0x00, 0xe0, 
+  0x10, 0x05, 0x1c, 0x00, 0x03, 0x5c, 0x00, 0x00, 0x78, 0x01, 0x0f, 0x34, 0x02, 0x11, 0x00, 0x5c, 0x00, 0x0f, 0x04, 0x00, 0x01, 0x01, 0x1c, 0x02, 0x2a, 0x20, 0xce, 0x68, 0x01, 0x00, 0x5c, 0x00, 
+  0x34, 0x20, 0xcf, 0xa6, 0x30, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x64, 0x0d, 0x04, 0x7c, 0x00, 0x44, 0x28, 0x21, 0xcf, 0x71, 0x1c, 0x00, 0x04, 0x08, 0x00, 0x00, 0xe0, 0x0c, 0x44, 0x29, 0x21, 0xce, 
+  0xdf, 0x24, 0x00, 0x00, 0x44, 0x13, 0x04, 0x1c, 0x00, 0x00, 0x1c, 0x10, 0x00, 0x38, 0x0c, 0x05, 0x1c, 0x00, 0x00, 0x60, 0x00, 0x01, 0x04, 0x00, 0x20, 0xce, 0xdd, 0xa8, 0x0c, 0x0f, 0x68, 0x04, 
+  0x15, 0x02, 0x50, 0x00, 0x00, 0x38, 0x04, 0x00, 0x84, 0x03, 0x0d, 0xd0, 0x02, 0x00, 0x0c, 0x09, 0x10, 0xc7, 0xdc, 0x0c, 0x02, 0x28, 0x00, 0x64, 0x00, 0x00, 0x29, 0x21, 0xce, 0x88, 0x74, 0x00, 
+  0x00, 0x5c, 0x03, 0x00, 0xc8, 0x00, 0x04, 0x1c, 0x00, 0x08, 0x08, 0x00, 0x01, 0x48, 0x0c, 0x01, 0x90, 0x00, 0x01, 0x6c, 0x06, 0x19, 0xfd, 0xd8, 0x0f, 0x30, 0x1a, 0xc9, 0x13, 0xe0, 0x10, 0x04, 
+  0x48, 0x00, 0x09, 0x08, 0x00, 0x30, 0x20, 0xcf, 0xcb, 0xf4, 0x0b, 0x00, 0x40, 0x0b, 0x08, 0x50, 0x00, 0x08, 0x0c, 0x00, 0x00, 0x54, 0x06, 0x01, 0xa0, 0x05, 0x0a, 0xe4, 0x0e, 0x00, 0xac, 0x00, 
+  0x04, 0x04, 0x00, 0x19, 0xc7, 0x0c, 0x0f, 0x38, 0x1f, 0xce, 0x49, 0xf8, 0x11, 0x00, 0xd8, 0x0f, 0x08, 0x50, 0x00, 0x0c, 0x0c, 0x00, 0x45, 0x28, 0x20, 0xce, 0x9e, 0x94, 0x00, 0x74, 0x20, 0xcf, 
+  0xf0, 0x2a, 0x1f, 0xcf, 0x30, 0x24, 0x00, 0x01, 0x78, 0x01, 0x35, 0x21, 0xce, 0xa8, 0x20, 0x00, 0x05, 0xe4, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x04, 0x00, 0x00, 0x4c, 0x13, 0x20, 0xce, 0xd8, 0x64, 
+  0x08, 0x00, 0x20, 0x09, 0x01, 0x04, 0x00, 0x01, 0x98, 0x0a, 0x00, 0x30, 0x0b, 0x00, 0x1c, 0x00, 0x00, 0x24, 0x00, 0x0f, 0x04, 0x00, 0x00, 0x38, 0x20, 0xcf, 0xa6, 0x68, 0x01, 0x00, 0x74, 0x00, 
+  0x04, 0x50, 0x0e, 0x01, 0x6c, 0x00, 0x34, 0x20, 0xcf, 0x9b, 0x84, 0x00, 0x0f, 0x08, 0x00, 0x05, 0x00, 0x9c, 0x00, 0x41, 0x29, 0x20, 0xce, 0xd3, 0x30, 0x00, 0x00, 0x98, 0x00, 0x0f, 0xd8, 0x14, 
+  0x00, 0x00, 0xe0, 0x10, 0x45, 0x29, 0x20, 0xcf, 0xeb, 0x24, 0x00, 0x00, 0x28, 0x00, 0x0f, 0x04, 0x00, 0x21, 0x38, 0x20, 0xcf, 0xea, 0x84, 0x03, 0x04, 0x94, 0x00, 0x0a, 0xd8, 0x14, 0x28, 0xcf, 
+  0xd1, 0xd4, 0x00, 0x04, 0x24, 0x00, 0x0f, 0x08, 0x00, 0x01, 0x01, 0xd4, 0x01, 0x02, 0xcc, 0x16, 0x0f, 0x48, 0x16, 0x06, 0x00, 0xd4, 0x01, 0x40, 0x28, 0x21, 0xce, 0x83, 0xf4, 0x09, 0x0f, 0xc0, 
+  0x00, 0x1d, 0x03, 0x34, 0x00, 0x18, 0x81, 0xec, 0x04, 0x0c, 0x88, 0x00, 0x03, 0x48, 0x16, 0x1f, 0xe2, 0x7c, 0x02, 0x09, 0x0c, 0x34, 0x00, 0x00, 0x10, 0x00, 0x0f, 0x34, 0x17, 0x15, 0x00, 0x2c, 
+  0x03, 0x00, 0x78, 0x0f, 0x03, 0x14, 0x02, 0x1f, 0xe1, 0xc4, 0x00, 0x05, 0x00, 0x24, 0x09, 0x00, 0x70, 0x08, 0x00, 0xbc, 0x07, 0x00, 0x34, 0x00, 0x00, 0x64, 0x00, 0x0f, 0x04, 0x00, 0x0d, 0x00, 
+  0x78, 0x12, 0x0f, 0x24, 0x00, 0x0d, 0x0f, 0x20, 0x00, 0x35, 0x00, 0x78, 0x0a, 0x00, 0xe8, 0x0d, 0x41, 0x28, 0x1f, 0xcc, 0x38, 0x04, 0x00, 0x30, 0x22, 0xd0, 0x2c, 0x14, 0x00, 0x0f, 0x60, 0x00, 
+  0x35, 0x0f, 0x48, 0x00, 0xff, 0xff, 0xff, 0x8b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x65, 0x6d, 0x65, 0x72, 0x67, 0x65, 0x6e, 0x63, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x80, 0x42, 0x01, 0x00, 0x00, 0xcf, 0x21, 0x29, 0xff, 0x23, 0x00, 0x84, 0x00, 0x4d, 0x4c, 0x4c, 0x4c, 0x4c, 0x4d, 0x4c, 0x4c, 0x4c, 0x4c, 0x4d, 0x43, 0x43, 
+  0x43, 0x43, 0x4d, 0x43, 0x43, 0x43, 0x43, 0x4d, 0x43, 0x43, 0x4c, 0x43, 0x43, 0x4c, 0x4d, 0x43, 0x43, 0x4c, 0x43, 0x43, 0x5a, 0x4d, 0x00, 0xa8, 0xea, 0x41, 0x00, 0x00, 0x20, 0x42, 0x00, 0xac, 
+  0x0a, 0x42, 0x00, 0x00, 0x20, 0x42, 0x00, 0xac, 0x0a, 0x42, 0x00, 0x54, 0x35, 0x42, 0x00, 0xa8, 0xea, 0x41, 0x00, 0x54, 0x35, 0x42, 0x00, 0xa8, 0xea, 0x41, 0x00, 0x00, 0x20, 0x42, 0x00, 0xa8, 
+  0xea, 0x41, 0x00, 0x58, 0x95, 0x41, 0x00, 0xac, 0x0a, 0x42, 0x00, 0x58, 0x95, 0x41, 0x00, 0xac, 0x0a, 0x42, 0x00, 0xac, 0x0a, 0x42, 0x00, 0xa8, 0xea, 0x41, 0x00, 0xac, 0x0a, 0x42, 0x00, 0xa8, 
+  0xea, 0x41, 0x00, 0x58, 0x95, 0x41, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x41, 0x00, 0xf8, 0x95, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0xf8, 0x95, 0x41, 0x00, 0x00, 
+  0x00, 0x41, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x41, 0x00, 0x04, 0x35, 0x42, 0x00, 0xf8, 0x95, 0x41, 0x00, 0x00, 0x60, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x60, 0x42, 0x00, 0x04, 
+  0x35, 0x42, 0x00, 0x00, 0x60, 0x42, 0x00, 0x00, 0x60, 0x42, 0x00, 0x04, 0x35, 0x42, 0x00, 0x00, 0x60, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x60, 0x42, 0x00, 0xf8, 0x95, 0x41, 0x00, 0x04, 
+  0x35, 0x42, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x42, 0x00, 0xac, 0x4a, 0x42, 0x00, 0xa8, 0xad, 0x41, 0x00, 0xac, 0x4a, 0x42, 0x00, 0x50, 
+  0x55, 0x41, 0x00, 0x2c, 0x29, 0x42, 0x00, 0x50, 0x55, 0x41, 0x00, 0x00, 0x00, 0x42, 0x00, 0x50, 0x55, 0x41, 0x00, 0xa8, 0xad, 0x41, 0x00, 0xa8, 0xad, 0x41, 0x00, 0x50, 0x55, 0x41, 0x00, 0x00, 
+  0x00, 0x42, 0x00, 0x50, 0x55, 0x41, 0x00, 0x2c, 0x29, 0x42, 0x00, 0x50, 0x55, 0x41, 0x00, 0xac, 0x4a, 0x42, 0x00, 0xa8, 0xad, 0x41, 0x00, 0xac, 0x4a, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0xac, 
+  0x4a, 0x42, 0x00, 0x2c, 0x29, 0x42, 0x00, 0x2c, 0x29, 0x42, 0x00, 0xac, 0x4a, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0xac, 0x4a, 0x42, 0x00, 0xac, 0x5a, 0x42, 0x00, 0xac, 0x5a, 0x42, 0x00, 0xb4, 
+  0x71, 0x42, 0x00, 0x50, 0x43, 0x42, 0x00, 0x00, 0x80, 0x42, 0x00, 0x50, 0x23, 0x42, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x80, 0x42, 0x00, 0x60, 0xb9, 0x41, 0x00, 0xb4, 
+  0x71, 0x42, 0x00, 0xc0, 0x72, 0x41, 0x00, 0xac, 0x5a, 0x42, 0x00, 0x50, 0x15, 0x41, 0x00, 0x24, 0x4f, 0x42, 0x00, 0x70, 0x43, 0x41, 0x00, 0x68, 0x63, 0x42, 0x00, 0xa8, 0x8a, 0x41, 0x00, 0x00, 
+  0x70, 0x42, 0x00, 0x58, 0xc2, 0x41, 0x00, 0x00, 0x70, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x70, 0x42, 0x00, 0xf0, 0x1e, 0x42, 0x00, 0x68, 0x63, 0x42, 0x00, 0xac, 0x3a, 0x42, 0x00, 0x24, 
+  0x4f, 0x42, 0x00, 0x24, 0x4f, 0x42, 0x00, 0xac, 0x5a, 0x42, 0x00, 0xac, 0x5a, 0x42, 0x00, 0x70, 0x43, 0x41, 0x00, 0x24, 0x4f, 0x42, 0x01, 0xc0, 0xe4, 0x40, 0x00, 0xac, 0x3a, 0x42, 0x00, 0x00, 
+  0x80, 0x40, 0x00, 0xf0, 0x1e, 0x42, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x80, 0x40, 0x00, 0x58, 0xc2, 0x41, 0x01, 0xc0, 0xe4, 0x40, 0x00, 0xa8, 0x8a, 0x41, 0x00, 0x70, 
+  0x43, 0x41, 0x00, 0x70, 0x43, 0x41, 0x00, 0x50, 0x15, 0x41, 0x00, 0x50, 0x15, 0x41, 0x01, 0xc0, 0x64, 0x40, 0x00, 0xc0, 0x72, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xb9, 0x41, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x23, 0x42, 0x01, 0xc0, 0x64, 0x40, 0x00, 0x50, 0x43, 0x42, 0x00, 0x50, 0x15, 0x41, 0x00, 0xac, 0x5a, 0x42, 0x00, 0x70, 
+  0x43, 0x41, 0x00, 0x24, 0x4f, 0x42, 
 };
 
 const lv_img_dsc_t emergency = {
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .header.cf = LV_IMG_CF_USER_ENCODED_0,
   .header.always_zero = 0,
   .header.reserved = 0,
   .header.w = 46,
   .header.h = 46,
-  .data_size = 2116 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+  .data_size = 2854,
   .data = emergency_map,
 };
@@ -0,0 +1,370 @@
+#include "asset_store.h"
+#include "image_bin.h"
+#include "image_cache.h"
+#include "vector_icon.h"
+#include "spdlog/spdlog.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <sys/stat.h>
+
+// payload layout written by assets/img-pack.py
+#define PACK_HEADER_SIZE 8
+#define PACK_FORMAT_A8 0
+#define PACK_FORMAT_ARGB 1
+#define PACK_FLAG_VECTOR 1
+
+// screen the compiled icons are sized for
+#ifdef GUPPY_SMALL_SCREEN
+#define ASSET_SCREEN_W 480
+#define ASSET_SCREEN_H 320
+#else
+#define ASSET_SCREEN_W 800
+#define ASSET_SCREEN_H 480
+#endif
+
+AssetStore *AssetStore::instance = NULL;
+
+// LZ4 block format, false on anything that doesn't decode to exactly dst_len
+static bool lz4_decode(const uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len) {
+  const uint8_t *ip = src;
+  const uint8_t *iend = src + src_len;
+  uint8_t *op = dst;
+  uint8_t *oend = dst + dst_len;
+
+  while (ip < iend) {
+    uint8_t token = *ip++;
+
+    size_t lit = token >> 4;
+    if (lit == 15) {
+      uint8_t b;
+      do {
+	if (ip >= iend) {
+	  return false;
+	}
+	b = *ip++;
+	lit += b;
+      } while (b == 255);
+    }
+    if (lit > (size_t)(iend - ip) || lit > (size_t)(oend - op)) {
+      return false;
+    }
+    memcpy(op, ip, lit);
+    ip += lit;
+    op += lit;
+
+    // the last sequence has literals only
+    if (ip == iend) {
+      break;
+    }
+
+    if (iend - ip < 2) {
+      return false;
+    }
+    size_t offset = ip[0] | (ip[1] << 8);
+    ip += 2;
+    if (offset == 0 || offset > (size_t)(op - dst)) {
+      return false;
+    }
+
+    size_t match = token & 15;
+    if (match == 15) {
+      uint8_t b;
+      do {
+	if (ip >= iend) {
+	  return false;
+	}
+	b = *ip++;
+	match += b;
+      } while (b == 255);
+    }
+    match += 4;
+    if (match > (size_t)(oend - op)) {
+      return false;
+    }
+
+    // may overlap, byte by byte
+    const uint8_t *m = op - offset;
+    for (size_t i = 0; i < match; i++) {
+      op[i] = m[i];
+    }
+    op += match;
+  }
+
+  return op == oend;
+}
+
+// splits a packed payload into its parts, false if it isn't one
+bool AssetStore::parse(const lv_img_dsc_t *img, Packed &p) {
+  const uint8_t *d = img->data;
+  const uint8_t *end = d + img->data_size;
+  if (img->header.cf != LV_IMG_CF_USER_ENCODED_0
+      || img->data_size <= PACK_HEADER_SIZE
+      || d[0] != 'G' || d[1] != 'P') {
+    return false;
+  }
+
+  p.format = d[2];
+  p.color = d + 4;
+  p.vector = NULL;
+  p.vector_len = 0;
+
+  const uint8_t *cur = d + PACK_HEADER_SIZE;
+  if (!(d[3] & PACK_FLAG_VECTOR)) {
+    p.raster = cur;
+    p.raster_len = end - cur;
+    return true;
+  }
+
+  // all targets are little endian
+  uint32_t n;
+  if (end - cur < (ptrdiff_t)sizeof(n)) {
+    return false;
+  }
+  memcpy(&n, cur, sizeof(n));
+  cur += sizeof(n);
+  if ((size_t)(end - cur) < (size_t)n + 1) {
+    return false;
+  }
+  p.raster = cur;
+  p.raster_len = n;
+  cur += n;
+
+  uint8_t name_len = *cur++;
+  if (end - cur < name_len) {
+    return false;
+  }
+  p.name.assign((const char *)cur, name_len);
+  cur += name_len;
+
+  p.vector = cur;
+  p.vector_len = end - cur;
+  return true;
+}
+
+// unpacks the raster into w * h LV_IMG_CF_TRUE_COLOR_ALPHA pixels
+static bool unpack(const lv_img_dsc_t *img, const uint8_t *body, size_t body_len, uint8_t *out) {
+  const uint8_t *p = img->data;
+  uint8_t format = p[2];
+  size_t px = (size_t)img->header.w * img->header.h;
+
+  std::vector<uint8_t> raw(px * (format == PACK_FORMAT_A8 ? 1 : 4));
+  if ((format != PACK_FORMAT_A8 && format != PACK_FORMAT_ARGB)
+      || !lz4_decode(body, body_len, raw.data(), raw.size())) {
+    return false;
+  }
+
+  lv_color_t mono = lv_color_make(p[6], p[5], p[4]);
+  for (size_t i = 0; i < px; i++) {
+    lv_color_t c;
+    lv_opa_t a;
+    if (format == PACK_FORMAT_A8) {
+      c = mono;
+      a = raw[i];
+    } else {
+      const uint8_t *s = &raw[i * 4];
+      c = lv_color_make(s[2], s[1], s[0]);
+      a = s[3];
+    }
+
+    uint8_t *d = out + i * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    memcpy(d, &c, sizeof(lv_color_t));
+    d[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = a;
+  }
+
+  return true;
+}
+
+AssetStore::AssetStore()
+  : icon_size(0)
+{
+}
+
+AssetStore::~AssetStore() {
+}
+
+AssetStore *AssetStore::get_instance() {
+  if (instance == NULL) {
+    instance = new AssetStore();
+  }
+  return instance;
+}
+
+void AssetStore::init() {
+  lv_img_decoder_t *dec = lv_img_decoder_create();
+  lv_img_decoder_set_info_cb(dec, info_cb);
+  lv_img_decoder_set_open_cb(dec, open_cb);
+  lv_img_decoder_set_close_cb(dec, close_cb);
+}
+
+void AssetStore::set_icon_size(uint32_t size, const std::string &dir) {
+  icon_size = std::min<uint32_t>(size, IMAGE_BIN_MAX_SIZE);
+  cache_dir = dir;
+
+  if (icon_size != 0 && icon_size != ASSET_ICON_SIZE) {
+    spdlog::info("rendering icons at {}px, cached in {}", icon_size, cache_dir);
+  }
+}
+
+uint32_t AssetStore::auto_icon_size() {
+  double scale = std::min((double)lv_disp_get_physical_hor_res(NULL) / ASSET_SCREEN_W,
+			  (double)lv_disp_get_physical_ver_res(NULL) / ASSET_SCREEN_H);
+  return (uint32_t)std::lround(ASSET_ICON_SIZE * scale);
+}
+
+double AssetStore::icon_scale(const void *src) const {
+  const lv_img_dsc_t *img = (const lv_img_dsc_t *)src;
+  Packed p;
+  uint32_t w, h;
+  if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE
+      || !parse(img, p)
+      || !scaled(img, p, w, h)) {
+    return 1.0;
+  }
+  return (double)w / img->header.w;
+}
+
+// true if the icon is drawn from its paths, at w x h instead of its own size
+bool AssetStore::scaled(const lv_img_dsc_t *img, const Packed &p, uint32_t &w, uint32_t &h) const {
+  w = img->header.w;
+  h = img->header.h;
+  if (icon_size == 0 || icon_size == ASSET_ICON_SIZE || p.vector == NULL
+      || !VectorIcon::valid(p.vector, p.vector_len)) {
+    return false;
+  }
+
+  uint32_t sw = std::max<uint32_t>(1, (img->header.w * icon_size + ASSET_ICON_SIZE / 2) / ASSET_ICON_SIZE);
+  uint32_t sh = std::max<uint32_t>(1, (img->header.h * icon_size + ASSET_ICON_SIZE / 2) / ASSET_ICON_SIZE);
+  if (sw > IMAGE_BIN_MAX_SIZE || sh > IMAGE_BIN_MAX_SIZE) {
+    return false;
+  }
+
+  w = sw;
+  h = sh;
+  return true;
+}
+
+// one file per icon, size and color format, in LVGL's .bin layout. the
+// hash of the paths keeps an icon whose SVG changed from loading its old
+// raster
+std::string AssetStore::cache_path(const Packed &p, uint32_t w, uint32_t h) const {
+  char key[64];
+  snprintf(key, sizeof(key), "_%ux%u_%d%s_%08x.bin", w, h, LV_COLOR_DEPTH,
+	   LV_COLOR_16_SWAP ? "s" : "", ImageBin::hash(p.vector, p.vector_len));
+  return cache_dir + "/" + p.name + key;
+}
+
+static bool load_raster(const std::string &path, uint32_t w, uint32_t h, uint8_t *out, size_t size) {
+  FILE *f = fopen(path.c_str(), "rb");
+  if (f == NULL) {
+    return false;
+  }
+
+  lv_img_header_t header;
+  bool ok = fread(&header, sizeof(header), 1, f) == 1
+    && header.cf == LV_IMG_CF_TRUE_COLOR_ALPHA
+    && header.w == w && header.h == h
+    && fread(out, 1, size, f) == size;
+  fclose(f);
+  return ok;
+}
+
+static void save_raster(const std::string &dir, const std::string &path,
+			uint32_t w, uint32_t h, const uint8_t *data, size_t size) {
+  mkdir(dir.c_str(), 0755);
+
+  lv_img_header_t header;
+  memset(&header, 0, sizeof(header));
+  header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+  header.w = w;
+  header.h = h;
+
+  if (!ImageBin::save(path, header, data, size)) {
+    spdlog::debug("asset: can't write {}", path);
+  }
+}
+
+// compiled icons live as long as the program, their address names them
+std::string AssetStore::cache_key(const lv_img_dsc_t *img) {
+  return fmt::format("icon:{}", (const void *)img);
+}
+
+const uint8_t *AssetStore::acquire(const lv_img_dsc_t *img) {
+  ImageCache *cache = ImageCache::get_instance();
+  const uint8_t *cached = cache->acquire(cache_key(img));
+  if (cached != NULL) {
+    return cached;
+  }
+
+  Packed p;
+  if (!parse(img, p)) {
+    return NULL;
+  }
+
+  uint32_t w, h;
+  bool vector = scaled(img, p, w, h);
+  size_t size = (size_t)w * h * LV_IMG_PX_SIZE_ALPHA_BYTE;
+  uint8_t *data = (uint8_t *)lv_mem_alloc(size);
+  if (data == NULL) {
+    return NULL;
+  }
+
+  if (vector) {
+    std::string path = cache_path(p, w, h);
+    if (!load_raster(path, w, h, data, size)) {
+      if (!VectorIcon::render(p.vector, p.vector_len, w, h, data)) {
+	spdlog::warn("asset: failed to render {}", p.name);
+	lv_mem_free(data);
+	return NULL;
+      }
+      spdlog::debug("asset: rendered {} at {}x{}", p.name, w, h);
+      save_raster(cache_dir, path, w, h, data, size);
+    }
+  } else if (!unpack(img, p.raster, p.raster_len, data)) {
+    spdlog::warn("asset: failed to unpack {}x{} image", img->header.w, img->header.h);
+    lv_mem_free(data);
+    return NULL;
+  }
+
+  return cache->insert(cache_key(img), data, size);
+}
+
+lv_res_t AssetStore::info_cb(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header) {
+  LV_UNUSED(decoder);
+  Packed p;
+  if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE
+      || !parse((const lv_img_dsc_t *)src, p)) {
+    return LV_RES_INV;
+  }
+
+  uint32_t w, h;
+  instance->scaled((const lv_img_dsc_t *)src, p, w, h);
+  header->w = w;
+  header->h = h;
+  header->always_zero = 0;
+  header->cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+  return LV_RES_OK;
+}
+
+lv_res_t AssetStore::open_cb(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {
+  LV_UNUSED(decoder);
+  Packed p;
+  if (dsc->src_type != LV_IMG_SRC_VARIABLE
+      || !parse((const lv_img_dsc_t *)dsc->src, p)) {
+    return LV_RES_INV;
+  }
+
+  dsc->img_data = instance->acquire((const lv_img_dsc_t *)dsc->src);
+  return dsc->img_data != NULL ? LV_RES_OK : LV_RES_INV;
+}
+
+void AssetStore::close_cb(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {
+  LV_UNUSED(decoder);
+  if (dsc->img_data != NULL) {
+    ImageCache::get_instance()->release(cache_key((const lv_img_dsc_t *)dsc->src));
+    dsc->img_data = NULL;
+  }
+}
@@ -0,0 +1,85 @@
+#ifndef __ASSET_STORE_H__
+#define __ASSET_STORE_H__
+
+#include "lvgl/lvgl.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// size of the compiled icons
+#ifdef GUPPY_SMALL_SCREEN
+#define ASSET_ICON_SIZE 46
+#else
+#define ASSET_ICON_SIZE 64
+#endif
+
+// Image decoder for the packed icons in assets/ (see assets/img-pack.py):
+// LV_IMG_CF_USER_ENCODED_0 images holding an LZ4 compressed A8 mask (single
+// color icons) or ARGB8888 image. An icon is decoded the first time it is
+// drawn, into LV_IMG_CF_TRUE_COLOR_ALPHA at the build's color depth, so the
+// draw path and theme recolors see what they saw before.
+//
+// Icons that carry their SVG paths (material, material_46) can instead be
+// rasterized at another size, icon_size being what a compiled 64px (46px on
+// small screen builds) icon becomes. Rasters are rendered once per device and
+// kept as LVGL .bin files in cache_dir, keyed by icon, size and color format.
+//
+// Decoded icons are kept in the ImageCache. LVGL's own image cache only
+// keeps a handful of images open, so without it every redraw of a panel
+// would decompress its icons again.
+class AssetStore {
+ private:
+  static AssetStore *instance;
+  AssetStore();
+
+ public:
+  AssetStore(AssetStore &o) = delete;
+  void operator=(const AssetStore &) = delete;
+  ~AssetStore();
+
+  static AssetStore *get_instance();
+
+  // registers the decoder
+  void init();
+
+  // 0 or ASSET_ICON_SIZE draws the compiled rasters
+  void set_icon_size(uint32_t size, const std::string &cache_dir);
+
+  // ASSET_ICON_SIZE scaled by how the screen compares to the one the
+  // compiled icons are sized for
+  static uint32_t auto_icon_size();
+
+  // how much larger than compiled src is drawn, 1 unless it is one of the
+  // packed icons rasterized at icon_size. widgets that zoom icons with the
+  // screen divide this out so they aren't scaled twice
+  double icon_scale(const void *src) const;
+
+ private:
+  // a packed payload, see assets/img-pack.py
+  struct Packed {
+    uint8_t format;
+    const uint8_t *color;  // b g r
+    const uint8_t *raster;
+    size_t raster_len;
+    std::string name;
+    const uint8_t *vector;  // path program, NULL if none
+    size_t vector_len;
+  };
+
+  static bool parse(const lv_img_dsc_t *img, Packed &p);
+  bool scaled(const lv_img_dsc_t *img, const Packed &p, uint32_t &w, uint32_t &h) const;
+  std::string cache_path(const Packed &p, uint32_t w, uint32_t h) const;
+
+  static std::string cache_key(const lv_img_dsc_t *img);
+  const uint8_t *acquire(const lv_img_dsc_t *img);
+
+  static lv_res_t info_cb(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header);
+  static lv_res_t open_cb(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc);
+  static void close_cb(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc);
+
+  uint32_t icon_size;
+  std::string cache_dir;
+};
+
+#endif // __ASSET_STORE_H__
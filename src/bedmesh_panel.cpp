@@ -324,7 +324,11 @@ BedMeshPanel::BedMeshPanel(KWebSocketClient &c, std::mutex &l)
 
   lv_obj_move_background(prompt);
 
-  ws.register_notify_update(this);
+  ws.register_status_update(this, "bed_mesh", "", [this](const json &v) {
+    json bm = v;
+    spdlog::trace("bedmesh panel consume {}", bm["/profiles"_json_pointer].dump());
+    refresh_views(bm);
+  });
 }
 
 BedMeshPanel::~BedMeshPanel() {
@@ -350,14 +354,8 @@ BedMeshPanel::~BedMeshPanel() {
     lv_obj_del(prompt);
     prompt = NULL;
   }
-}
 
-void BedMeshPanel::consume(json &j) {
-  auto bm = j["/params/0/bed_mesh"_json_pointer];
-  if (!bm.is_null()) {
-    spdlog::trace("bedmesh panel consume {}", bm["/profiles"_json_pointer].dump());
-    refresh_views_with_lock(bm);
-  }
+  ws.unregister_status_update(this);
 }
 
 void BedMeshPanel::refresh_views_with_lock(json &bm) {
@@ -15,7 +15,6 @@ class BedMeshPanel : public NotifyConsumer {
   BedMeshPanel(KWebSocketClient &c, std::mutex &l);
   ~BedMeshPanel();
 
-  void consume(json &j);
   void foreground();
   void refresh_views_with_lock(json &);
   void refresh_views(json &);
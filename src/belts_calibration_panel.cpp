@@ -35,7 +35,7 @@ BeltsCalibrationPanel::BeltsCalibrationPanel(KWebSocketClient &c, std::mutex &l)
     "Do you want to emergency stop?",
     [&c]() {
       spdlog::debug("emergency stop pressed");
-      c.send_jsonrpc("printer.emergency_stop");
+      c.send_priority("printer.emergency_stop", KUtils::input_age_ms());
     })
   , back_btn(button_cont, &back, "Back", &BeltsCalibrationPanel::_handle_callback, this)
   , image_fullsized(false)
@@ -158,7 +158,7 @@ void BeltsCalibrationPanel::handle_callback(lv_event_t *event) {
   } else if (btn == back_btn.get_container()) {
     lv_obj_move_background(cont);
   } else if (btn == emergency_btn.get_container()) {
-    ws.send_jsonrpc("printer.emergency_stop");
+    ws.send_priority("printer.emergency_stop", KUtils::input_age_ms());
   }
 }
 
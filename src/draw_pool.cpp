@@ -0,0 +1,124 @@
+#ifdef GUPPY_PARALLEL_DRAW
+
+#include "draw_pool.h"
+#include "spdlog/spdlog.h"
+
+#include <algorithm>
+
+// below this a draw call is cheaper than waking the workers
+#define DRAW_POOL_MIN_PIXELS (16 * 1024)
+#define DRAW_POOL_MIN_ROWS 8
+
+DrawPool *DrawPool::instance = NULL;
+
+DrawPool::DrawPool()
+  : stopping(false)
+  , generation(0)
+  , pending(0)
+  , job_fn(NULL)
+  , job_ctx(NULL)
+  , job_rows(0)
+  , job_band(0)
+  , job_bands(0)
+{
+}
+
+DrawPool::~DrawPool() {
+  {
+    std::lock_guard<std::mutex> l(lock);
+    stopping = true;
+  }
+  wake.notify_all();
+
+  for (auto &w : workers) {
+    w.join();
+  }
+}
+
+DrawPool *DrawPool::get_instance() {
+  if (instance == NULL) {
+    instance = new DrawPool();
+  }
+  return instance;
+}
+
+void DrawPool::start(uint32_t threads) {
+  if (!workers.empty()) {
+    return;
+  }
+
+  if (threads == 0) {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  for (uint32_t i = 0; i + 1 < threads; i++) {
+    workers.emplace_back(&DrawPool::work, this, i);
+  }
+  spdlog::info("drawing on {} threads", workers.size() + 1);
+}
+
+uint32_t DrawPool::get_threads() const {
+  return workers.size() + 1;
+}
+
+void DrawPool::run(band_fn fn, void *ctx, int32_t rows, int32_t pixels) {
+  uint32_t bands = std::min<uint32_t>(workers.size() + 1, rows / DRAW_POOL_MIN_ROWS);
+  if (bands < 2 || pixels < DRAW_POOL_MIN_PIXELS) {
+    fn(ctx, 0, rows);
+    return;
+  }
+
+  int32_t band = (rows + bands - 1) / bands;
+  {
+    std::lock_guard<std::mutex> l(lock);
+    job_fn = fn;
+    job_ctx = ctx;
+    job_rows = rows;
+    job_band = band;
+    job_bands = bands;
+    pending = bands - 1;
+    generation++;
+  }
+  wake.notify_all();
+
+  fn(ctx, 0, band);
+
+  std::unique_lock<std::mutex> l(lock);
+  done.wait(l, [this] { return pending == 0; });
+}
+
+// worker idx fills band idx + 1 of every job that has one
+void DrawPool::work(uint32_t idx) {
+  uint64_t seen = 0;
+  std::unique_lock<std::mutex> l(lock);
+
+  while (true) {
+    wake.wait(l, [this, seen] { return stopping || generation != seen; });
+    if (stopping) {
+      return;
+    }
+
+    seen = generation;
+    uint32_t b = idx + 1;
+    if (b >= job_bands) {
+      continue;
+    }
+
+    band_fn fn = job_fn;
+    void *ctx = job_ctx;
+    int32_t y1 = std::min(job_rows, (int32_t)b * job_band);
+    int32_t y2 = std::min(job_rows, y1 + job_band);
+
+    l.unlock();
+    if (y1 < y2) {
+      fn(ctx, y1, y2);
+    }
+    l.lock();
+
+    if (--pending == 0) {
+      done.notify_one();
+    }
+  }
+}
+
+#endif // GUPPY_PARALLEL_DRAW
@@ -0,0 +1,64 @@
+#ifndef __DRAW_POOL_H__
+#define __DRAW_POOL_H__
+
+#ifdef GUPPY_PARALLEL_DRAW
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Worker threads for the pixel work of a refresh. LVGL still walks the
+// widget tree and issues draw calls from the lv_timer_handler thread (none of
+// that is thread safe), but a large blend or image blit is cut into bands of
+// rows that are filled in parallel: the caller takes the first band, each
+// worker one of the others, and run() returns once all of them are done, so
+// to LVGL the draw call is as synchronous as before.
+//
+// Built with GUPPY_PARALLEL_DRAW only, single core boards (K1) don't carry it.
+class DrawPool {
+ private:
+  static DrawPool *instance;
+  DrawPool();
+
+ public:
+  DrawPool(DrawPool &o) = delete;
+  void operator=(const DrawPool &) = delete;
+  ~DrawPool();
+
+  static DrawPool *get_instance();
+
+  // fills rows [y1, y2) of the job in ctx
+  typedef void (*band_fn)(void *ctx, int32_t y1, int32_t y2);
+
+  // threads is the total including the caller, 0 picks the number of cores
+  void start(uint32_t threads);
+  uint32_t get_threads() const;
+
+  // runs fn over rows [0, rows), split between the threads when the job is
+  // worth it (pixels total), inline otherwise
+  void run(band_fn fn, void *ctx, int32_t rows, int32_t pixels);
+
+ private:
+  void work(uint32_t idx);
+
+  std::vector<std::thread> workers;
+  std::mutex lock;
+  std::condition_variable wake;
+  std::condition_variable done;
+  bool stopping;
+
+  // current job, guarded by lock
+  uint64_t generation;
+  uint32_t pending;
+  band_fn job_fn;
+  void *job_ctx;
+  int32_t job_rows;
+  int32_t job_band;
+  uint32_t job_bands;
+};
+
+#endif // GUPPY_PARALLEL_DRAW
+
+#endif // __DRAW_POOL_H__
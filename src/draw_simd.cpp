@@ -0,0 +1,492 @@
+#include "draw_simd.h"
+#include "draw_pool.h"
+
+#include <cstring>
+
+#if LV_COLOR_DEPTH == 32 && defined(__ARM_NEON) && !defined(GUPPY_NO_SIMD)
+#include <arm_neon.h>
+#define DRAW_SIMD_NEON 1
+#elif LV_COLOR_DEPTH == 32 && defined(__mips_msa) && !defined(GUPPY_NO_SIMD)
+#include <msa.h>
+#define DRAW_SIMD_MSA 1
+#endif
+
+#if LV_COLOR_DEPTH == 32
+
+// where the mix factor of a pixel comes from
+enum {
+  ALPHA_CONST,  // the overall opa
+  ALPHA_MASK,   // a separate mask buffer (anti-aliasing, glyphs, clipping)
+  ALPHA_SRC     // the image's own alpha byte
+};
+
+// how a mask value m becomes the mix factor, the way lv_draw_sw_blend_basic
+// does it for each case:
+//   a = m >= thr ? full : (scale ? (m * opa) >> 8 : m)
+// m == 0 leaves the pixel alone
+struct AlphaRule {
+  uint8_t thr;
+  uint8_t full;
+  uint8_t opa;
+  bool scale;
+};
+
+// lv_color_premult/lv_color_mix_premult applied by lv_draw_sw_img_decoded
+struct Recolor {
+  uint16_t premult[3];  // b, g, r
+  uint8_t inv;
+};
+
+static inline uint32_t div255(uint32_t x) {
+  // LV_UDIV255
+  return (x * 0x8081U) >> 23;
+}
+
+// lv_color_mix(fg, bg, a)
+static inline uint32_t mix_px(uint32_t fg, uint32_t bg, uint32_t a) {
+  uint32_t ia = 255 - a;
+  uint32_t b = div255((fg & 0xff) * a + (bg & 0xff) * ia);
+  uint32_t g = div255(((fg >> 8) & 0xff) * a + ((bg >> 8) & 0xff) * ia);
+  uint32_t r = div255(((fg >> 16) & 0xff) * a + ((bg >> 16) & 0xff) * ia);
+  return 0xff000000 | (r << 16) | (g << 8) | b;
+}
+
+static inline uint32_t recolor_px(uint32_t c, const Recolor &rc) {
+  uint32_t b = div255(rc.premult[0] + (c & 0xff) * rc.inv);
+  uint32_t g = div255(rc.premult[1] + ((c >> 8) & 0xff) * rc.inv);
+  uint32_t r = div255(rc.premult[2] + ((c >> 16) & 0xff) * rc.inv);
+  return 0xff000000 | (r << 16) | (g << 8) | b;
+}
+
+static inline uint8_t rule_alpha(const AlphaRule &rule, uint8_t m) {
+  if (m >= rule.thr) {
+    return rule.full;
+  }
+  return rule.scale ? (uint8_t)((m * rule.opa) >> 8) : m;
+}
+
+template <bool SRC, int ALPHA, bool RECOLOR>
+static inline void span_px(uint32_t *dst, const uint32_t *src, uint32_t color,
+			   const uint8_t *mask, const AlphaRule &rule, const Recolor &rc,
+			   int32_t i) {
+  uint32_t fg = SRC ? src[i] : color;
+  uint8_t m = ALPHA == ALPHA_MASK ? mask[i] : (uint8_t)(fg >> 24);
+  if (ALPHA != ALPHA_CONST && m == 0) {
+    return;
+  }
+
+  if (RECOLOR) {
+    fg = recolor_px(fg, rc);
+  }
+
+  uint8_t a = ALPHA == ALPHA_CONST ? rule.opa : rule_alpha(rule, m);
+  dst[i] = mix_px(fg, dst[i], a);
+}
+
+#ifdef DRAW_SIMD_NEON
+static inline uint8x8_t div255_u16(uint16x8_t x) {
+  // (x + (x >> 8) + 1) >> 8, same as LV_UDIV255 for x <= 255 * 255
+  return vshrn_n_u16(vaddq_u16(vsraq_n_u16(x, x, 8), vdupq_n_u16(1)), 8);
+}
+
+static inline uint8x8_t mix_u8(uint8x8_t fg, uint8x8_t bg, uint8x8_t a) {
+  return div255_u16(vmlal_u8(vmull_u8(fg, a), bg, vmvn_u8(a)));
+}
+
+// 8 pixels at a time, channels split into planes by vld4
+template <bool SRC, int ALPHA, bool RECOLOR>
+static void span(uint32_t *dst, const uint32_t *src, uint32_t color,
+		 const uint8_t *mask, const AlphaRule &rule, const Recolor &rc, int32_t w) {
+  uint8x8x4_t cf;
+  for (int c = 0; c < 4; c++) {
+    cf.val[c] = vdup_n_u8((color >> (8 * c)) & 0xff);
+  }
+  const uint8x8_t opa = vdup_n_u8(rule.opa);
+  const uint8x8_t thr = vdup_n_u8(rule.thr);
+  const uint8x8_t full = vdup_n_u8(rule.full);
+  const uint8x8_t opaque = vdup_n_u8(0xff);
+  const uint8x8_t rc_inv = vdup_n_u8(rc.inv);
+
+  int32_t i = 0;
+  for (; i + 8 <= w; i += 8) {
+    uint8x8x4_t f = SRC ? vld4_u8((const uint8_t *)(src + i)) : cf;
+
+    uint8x8_t a;
+    if (ALPHA == ALPHA_CONST) {
+      a = opa;
+    } else {
+      uint8x8_t m = ALPHA == ALPHA_MASK ? vld1_u8(mask + i) : f.val[3];
+      if (vget_lane_u64(vreinterpret_u64_u8(m), 0) == 0) {
+	continue;
+      }
+
+      uint8x8_t scaled = rule.scale ? vshrn_n_u16(vmull_u8(m, opa), 8) : m;
+      a = vbsl_u8(vcge_u8(m, thr), full, scaled);
+      // m == 0 mixes to the unchanged color
+    }
+
+    if (RECOLOR) {
+      for (int c = 0; c < 3; c++) {
+	f.val[c] = div255_u16(vmlal_u8(vdupq_n_u16(rc.premult[c]), f.val[c], rc_inv));
+      }
+    }
+
+    uint8x8x4_t d;
+    if (vget_lane_u64(vreinterpret_u64_u8(a), 0) == ~0ULL) {
+      d = f;
+    } else {
+      d = vld4_u8((const uint8_t *)(dst + i));
+      for (int c = 0; c < 3; c++) {
+	d.val[c] = mix_u8(f.val[c], d.val[c], a);
+      }
+    }
+    d.val[3] = opaque;
+    vst4_u8((uint8_t *)(dst + i), d);
+  }
+
+  for (; i < w; i++) {
+    span_px<SRC, ALPHA, RECOLOR>(dst, src, color, mask, rule, rc, i);
+  }
+}
+
+static void fill_span(uint32_t *dst, uint32_t color, int32_t w) {
+  const uint32x4_t c = vdupq_n_u32(color);
+  int32_t i = 0;
+  for (; i + 4 <= w; i += 4) {
+    vst1q_u32(dst + i, c);
+  }
+  for (; i < w; i++) {
+    dst[i] = color;
+  }
+}
+
+#elif defined(DRAW_SIMD_MSA)
+static inline v8u16 div255_u16(v8u16 x) {
+  // (x + (x >> 8) + 1) >> 8, same as LV_UDIV255 for x <= 255 * 255
+  v8u16 t = (v8u16)__msa_addv_h((v8i16)x, __msa_srli_h((v8i16)x, 8));
+  t = (v8u16)__msa_addvi_h((v8i16)t, 1);
+  return (v8u16)__msa_srli_h((v8i16)t, 8);
+}
+
+// fg * a + bg * (255 - a) / 255 on 16 bytes
+static inline v16u8 mix_u8(v16u8 fg, v16u8 bg, v16u8 a) {
+  const v16i8 zero = __msa_ldi_b(0);
+  v16u8 ia = __msa_nori_b(a, 0);
+
+  v8i16 lo = __msa_mulv_h((v8i16)__msa_ilvr_b(zero, (v16i8)fg), (v8i16)__msa_ilvr_b(zero, (v16i8)a));
+  lo = __msa_addv_h(lo, __msa_mulv_h((v8i16)__msa_ilvr_b(zero, (v16i8)bg), (v8i16)__msa_ilvr_b(zero, (v16i8)ia)));
+  v8i16 hi = __msa_mulv_h((v8i16)__msa_ilvl_b(zero, (v16i8)fg), (v8i16)__msa_ilvl_b(zero, (v16i8)a));
+  hi = __msa_addv_h(hi, __msa_mulv_h((v8i16)__msa_ilvl_b(zero, (v16i8)bg), (v8i16)__msa_ilvl_b(zero, (v16i8)ia)));
+
+  return (v16u8)__msa_pckev_b((v16i8)div255_u16((v8u16)hi), (v16i8)div255_u16((v8u16)lo));
+}
+
+// 4 pixels at a time, bytes stay interleaved and the per pixel factor is
+// spread over its 4 bytes
+template <bool SRC, int ALPHA, bool RECOLOR>
+static void span(uint32_t *dst, const uint32_t *src, uint32_t color,
+		 const uint8_t *mask, const AlphaRule &rule, const Recolor &rc, int32_t w) {
+  const v16i8 zero = __msa_ldi_b(0);
+  const v16u8 cf = (v16u8)__msa_fill_w((int)color);
+  const v16u8 opa = (v16u8)__msa_fill_b(rule.opa);
+  const v16u8 thr = (v16u8)__msa_fill_b(rule.thr);
+  const v16u8 full = (v16u8)__msa_fill_b(rule.full);
+  const v16u8 opaque = (v16u8)__msa_fill_w((int)0xff000000);
+  const v8i16 rc_premult = {(short)rc.premult[0], (short)rc.premult[1], (short)rc.premult[2], 0,
+			    (short)rc.premult[0], (short)rc.premult[1], (short)rc.premult[2], 0};
+  const v8i16 rc_inv = __msa_fill_h(rc.inv);
+  // byte n of the result is byte spread[n] of the source
+  const v16i8 spread_mask = {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3};
+  const v16i8 spread_alpha = {3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15};
+
+  int32_t i = 0;
+  for (; i + 4 <= w; i += 4) {
+    v16u8 f = SRC ? (v16u8)__msa_ld_b((void *)(src + i), 0) : cf;
+
+    v16u8 a;
+    if (ALPHA == ALPHA_CONST) {
+      a = opa;
+    } else {
+      v16u8 m;
+      if (ALPHA == ALPHA_MASK) {
+	uint32_t m4;
+	memcpy(&m4, mask + i, sizeof(m4));
+	v16i8 mv = (v16i8)__msa_fill_w((int)m4);
+	m = (v16u8)__msa_vshf_b(spread_mask, mv, mv);
+      } else {
+	m = (v16u8)__msa_vshf_b(spread_alpha, (v16i8)f, (v16i8)f);
+      }
+
+      if (__msa_test_bz_v(m)) {
+	continue;
+      }
+
+      v16u8 scaled = m;
+      if (rule.scale) {
+	v8i16 lo = __msa_mulv_h((v8i16)__msa_ilvr_b(zero, (v16i8)m), (v8i16)__msa_ilvr_b(zero, (v16i8)opa));
+	v8i16 hi = __msa_mulv_h((v8i16)__msa_ilvl_b(zero, (v16i8)m), (v8i16)__msa_ilvl_b(zero, (v16i8)opa));
+	scaled = (v16u8)__msa_pckev_b((v16i8)__msa_srli_h(hi, 8), (v16i8)__msa_srli_h(lo, 8));
+      }
+      // m >= thr selects full
+      a = __msa_bsel_v((v16u8)__msa_cle_u_b(thr, m), scaled, full);
+    }
+
+    if (RECOLOR) {
+      v8i16 lo = __msa_addv_h(rc_premult, __msa_mulv_h((v8i16)__msa_ilvr_b(zero, (v16i8)f), rc_inv));
+      v8i16 hi = __msa_addv_h(rc_premult, __msa_mulv_h((v8i16)__msa_ilvl_b(zero, (v16i8)f), rc_inv));
+      f = (v16u8)__msa_pckev_b((v16i8)div255_u16((v8u16)hi), (v16i8)div255_u16((v8u16)lo));
+    }
+
+    v16u8 d;
+    if (__msa_test_bz_v(__msa_xori_b(a, 0xff))) {
+      d = f;
+    } else {
+      d = mix_u8(f, (v16u8)__msa_ld_b((void *)(dst + i), 0), a);
+    }
+    __msa_st_b((v16i8)__msa_or_v(d, opaque), (void *)(dst + i), 0);
+  }
+
+  for (; i < w; i++) {
+    span_px<SRC, ALPHA, RECOLOR>(dst, src, color, mask, rule, rc, i);
+  }
+}
+
+static void fill_span(uint32_t *dst, uint32_t color, int32_t w) {
+  const v4i32 c = __msa_fill_w((int)color);
+  int32_t i = 0;
+  for (; i + 4 <= w; i += 4) {
+    __msa_st_w(c, (void *)(dst + i), 0);
+  }
+  for (; i < w; i++) {
+    dst[i] = color;
+  }
+}
+
+#else
+template <bool SRC, int ALPHA, bool RECOLOR>
+static void span(uint32_t *dst, const uint32_t *src, uint32_t color,
+		 const uint8_t *mask, const AlphaRule &rule, const Recolor &rc, int32_t w) {
+  for (int32_t i = 0; i < w; i++) {
+    span_px<SRC, ALPHA, RECOLOR>(dst, src, color, mask, rule, rc, i);
+  }
+}
+
+static void fill_span(uint32_t *dst, uint32_t color, int32_t w) {
+  for (int32_t i = 0; i < w; i++) {
+    dst[i] = color;
+  }
+}
+#endif
+
+static bool plain_target() {
+  lv_disp_t *disp = _lv_refr_get_disp_refreshing();
+  return disp->driver->set_px_cb == NULL && !disp->driver->screen_transp;
+}
+
+// map (src) rules follow lv_draw_sw_blend_basic's map_normal, fill rules its
+// fill_normal, they differ in where a mask value counts as fully covered
+static AlphaRule map_rule(lv_opa_t opa) {
+  if (opa >= LV_OPA_MAX) {
+    return AlphaRule{LV_OPA_MAX + 1, 255, opa, false};
+  }
+  return AlphaRule{LV_OPA_MAX, opa, opa, true};
+}
+
+static AlphaRule fill_rule(lv_opa_t opa) {
+  if (opa >= LV_OPA_MAX) {
+    return AlphaRule{LV_OPA_COVER, 255, opa, false};
+  }
+  return AlphaRule{LV_OPA_COVER, opa, opa, true};
+}
+
+// one blend call, cut into rows so it can be split between threads
+struct BlendJob {
+  uint32_t *dest;
+  int32_t dest_stride;
+  const uint32_t *src;
+  int32_t src_stride;
+  const lv_opa_t *mask;
+  int32_t mask_stride;
+  int32_t w;
+  uint32_t color;
+  lv_opa_t opa;
+  Recolor rc;
+};
+
+static void blend_rows(void *ctx, int32_t y1, int32_t y2) {
+  const BlendJob &job = *(const BlendJob *)ctx;
+  uint32_t *dest = job.dest + job.dest_stride * y1;
+  const uint32_t *src = job.src + job.src_stride * y1;
+  const lv_opa_t *mask = job.mask + job.mask_stride * y1;
+  int32_t w = job.w;
+  lv_opa_t opa = job.opa;
+  uint32_t color = job.color;
+
+  for (int32_t y = y1; y < y2; y++) {
+    if (job.src == NULL) {
+      if (job.mask != NULL) {
+	span<false, ALPHA_MASK, false>(dest, NULL, color, mask, fill_rule(opa), job.rc, w);
+      } else if (opa >= LV_OPA_MAX) {
+	fill_span(dest, color, w);
+      } else {
+	span<false, ALPHA_CONST, false>(dest, NULL, color, NULL, fill_rule(opa), job.rc, w);
+      }
+    } else {
+      if (job.mask != NULL) {
+	span<true, ALPHA_MASK, false>(dest, src, 0, mask, map_rule(opa), job.rc, w);
+      } else if (opa >= LV_OPA_MAX) {
+	memcpy(dest, src, w * sizeof(uint32_t));
+      } else {
+	span<true, ALPHA_CONST, false>(dest, src, 0, NULL, map_rule(opa), job.rc, w);
+      }
+    }
+
+    dest += job.dest_stride;
+    src += job.src_stride;
+    mask += job.mask_stride;
+  }
+}
+
+template <bool RECOLOR>
+static void img_rows(void *ctx, int32_t y1, int32_t y2) {
+  const BlendJob &job = *(const BlendJob *)ctx;
+  uint32_t *dest = job.dest + job.dest_stride * y1;
+  const uint32_t *src = job.src + job.src_stride * y1;
+  const AlphaRule rule = map_rule(job.opa);
+
+  for (int32_t y = y1; y < y2; y++) {
+    span<true, ALPHA_SRC, RECOLOR>(dest, src, 0, NULL, rule, job.rc, job.w);
+    src += job.src_stride;
+    dest += job.dest_stride;
+  }
+}
+
+static void run_rows(void (*fn)(void *, int32_t, int32_t), BlendJob *job, int32_t w, int32_t h) {
+#ifdef GUPPY_PARALLEL_DRAW
+  DrawPool::get_instance()->run(fn, job, h, w * h);
+#else
+  LV_UNUSED(w);
+  fn(job, 0, h);
+#endif
+}
+
+// lv_draw_sw_ctx_t::blend
+static void blend(lv_draw_ctx_t *draw_ctx, const lv_draw_sw_blend_dsc_t *dsc) {
+  if (dsc->blend_mode != LV_BLEND_MODE_NORMAL || !plain_target()) {
+    lv_draw_sw_blend_basic(draw_ctx, dsc);
+    return;
+  }
+
+  const lv_opa_t *mask = dsc->mask_buf;
+  if (mask != NULL && dsc->mask_res == LV_DRAW_MASK_RES_TRANSP) {
+    return;
+  }
+  if (dsc->mask_res == LV_DRAW_MASK_RES_FULL_COVER) {
+    mask = NULL;
+  }
+
+  lv_area_t area;
+  if (!_lv_area_intersect(&area, dsc->blend_area, draw_ctx->clip_area)) {
+    return;
+  }
+
+  if (draw_ctx->wait_for_finish) {
+    draw_ctx->wait_for_finish(draw_ctx);
+  }
+
+  int32_t w = lv_area_get_width(&area);
+  int32_t h = lv_area_get_height(&area);
+
+  int32_t dest_stride = lv_area_get_width(draw_ctx->buf_area);
+  uint32_t *dest = (uint32_t *)draw_ctx->buf
+    + dest_stride * (area.y1 - draw_ctx->buf_area->y1) + (area.x1 - draw_ctx->buf_area->x1);
+
+  const uint32_t *src = NULL;
+  int32_t src_stride = 0;
+  if (dsc->src_buf != NULL) {
+    src_stride = lv_area_get_width(dsc->blend_area);
+    src = (const uint32_t *)dsc->src_buf
+      + src_stride * (area.y1 - dsc->blend_area->y1) + (area.x1 - dsc->blend_area->x1);
+  }
+
+  int32_t mask_stride = 0;
+  if (mask != NULL) {
+    mask_stride = lv_area_get_width(dsc->mask_area);
+    mask += mask_stride * (area.y1 - dsc->mask_area->y1) + (area.x1 - dsc->mask_area->x1);
+  }
+
+  BlendJob job = {dest, dest_stride, src, src_stride, mask, mask_stride,
+		  w, dsc->color.full, dsc->opa, {}};
+  run_rows(blend_rows, &job, w, h);
+}
+
+// lv_draw_ctx_t::draw_img_decoded. untransformed ARGB images (all the icons)
+// are recolored and blended in one pass, straight from the image data,
+// instead of being split into a color and a mask buffer first.
+static void draw_img_decoded(lv_draw_ctx_t *draw_ctx, const lv_draw_img_dsc_t *dsc,
+			     const lv_area_t *coords, const uint8_t *src_buf, lv_img_cf_t cf) {
+  lv_area_t area;
+  if (cf != LV_IMG_CF_TRUE_COLOR_ALPHA
+      || dsc->angle != 0
+      || dsc->zoom != LV_IMG_ZOOM_NONE
+      || dsc->blend_mode != LV_BLEND_MODE_NORMAL
+      || !plain_target()
+      || !_lv_area_intersect(&area, coords, draw_ctx->clip_area)
+      || lv_draw_mask_is_any(&area)) {
+    lv_draw_sw_img_decoded(draw_ctx, dsc, coords, src_buf, cf);
+    return;
+  }
+
+  if (dsc->opa <= LV_OPA_MIN) {
+    return;
+  }
+
+  if (draw_ctx->wait_for_finish) {
+    draw_ctx->wait_for_finish(draw_ctx);
+  }
+
+  int32_t w = lv_area_get_width(&area);
+  int32_t h = lv_area_get_height(&area);
+
+  int32_t dest_stride = lv_area_get_width(draw_ctx->buf_area);
+  uint32_t *dest = (uint32_t *)draw_ctx->buf
+    + dest_stride * (area.y1 - draw_ctx->buf_area->y1) + (area.x1 - draw_ctx->buf_area->x1);
+
+  int32_t src_stride = lv_area_get_width(coords);
+  const uint32_t *src = (const uint32_t *)src_buf
+    + src_stride * (area.y1 - coords->y1) + (area.x1 - coords->x1);
+
+  BlendJob job = {dest, dest_stride, src, src_stride, NULL, 0,
+		  w, 0, dsc->opa, {}};
+  bool recolor = dsc->recolor_opa > LV_OPA_MIN;
+  if (recolor) {
+    job.rc.premult[0] = dsc->recolor.ch.blue * dsc->recolor_opa;
+    job.rc.premult[1] = dsc->recolor.ch.green * dsc->recolor_opa;
+    job.rc.premult[2] = dsc->recolor.ch.red * dsc->recolor_opa;
+    job.rc.inv = 255 - dsc->recolor_opa;
+  }
+
+  run_rows(recolor ? img_rows<true> : img_rows<false>, &job, w, h);
+}
+
+#endif  // LV_COLOR_DEPTH == 32
+
+void DrawSimd::init_ctx(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx) {
+  lv_draw_sw_init_ctx(drv, draw_ctx);
+#if LV_COLOR_DEPTH == 32
+  ((lv_draw_sw_ctx_t *)draw_ctx)->blend = blend;
+  draw_ctx->draw_img_decoded = draw_img_decoded;
+#endif
+}
+
+const char *DrawSimd::kernel_name() {
+#if defined(DRAW_SIMD_NEON)
+  return "neon";
+#elif defined(DRAW_SIMD_MSA)
+  return "msa";
+#elif LV_COLOR_DEPTH == 32
+  return "scalar";
+#else
+  return "lvgl";
+#endif
+}
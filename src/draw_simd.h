@@ -0,0 +1,24 @@
+#ifndef __DRAW_SIMD_H__
+#define __DRAW_SIMD_H__
+
+#include "lvgl/lvgl.h"
+
+// LVGL's software renderer with the hot loops replaced: rect fills, masked
+// fills (text, rounded corners), image blends with their alpha mask, and
+// untransformed ARGB images with recolor (style_imgbtn_pressed/disabled)
+// fused into a single pass. Kernels are NEON on ARM, MSA on MIPS and scalar
+// elsewhere; anything else (other blend modes, transforms, masks on images,
+// non 32 bpp builds) goes to LVGL's own code.
+//
+// Results match LVGL's color math (lv_color_mix, LV_UDIV255) channel for
+// channel. The alpha byte of blended pixels is always 0xFF, which nothing
+// reads with screen_transp off.
+namespace DrawSimd {
+  // lv_disp_drv_t::draw_ctx_init, draw_ctx_size stays sizeof(lv_draw_sw_ctx_t)
+  void init_ctx(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx);
+
+  // name of the kernels compiled in, for the log
+  const char *kernel_name();
+}
+
+#endif // __DRAW_SIMD_H__
@@ -0,0 +1,458 @@
+#ifdef GUPPY_DRM
+
+#include "drm_display.h"
+#include "spdlog/spdlog.h"
+
+#include <drm_fourcc.h>
+
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+// how long wait() gives a flip before assuming the event got lost
+#define DRM_FLIP_TIMEOUT_MS 100
+
+DrmDisplay *DrmDisplay::instance = NULL;
+
+DrmDisplay::DrmDisplay()
+  : fd(-1)
+  , conn_id(0)
+  , crtc_id(0)
+  , plane_id(0)
+  , mode({})
+  , mode_blob(0)
+  , conn_crtc_id(0)
+  , crtc_mode_id(0)
+  , crtc_active(0)
+  , plane_fb_id(0)
+  , plane_crtc_id(0)
+  , plane_src_x(0)
+  , plane_src_y(0)
+  , plane_src_w(0)
+  , plane_src_h(0)
+  , plane_crtc_x(0)
+  , plane_crtc_y(0)
+  , plane_crtc_w(0)
+  , plane_crtc_h(0)
+  , bufs{}
+  , front(0)
+  , flushing(NULL)
+  , enabled(false)
+{
+}
+
+DrmDisplay::~DrmDisplay() {
+  destroy_buffer(bufs[0]);
+  destroy_buffer(bufs[1]);
+
+  if (mode_blob != 0) {
+    drmModeDestroyPropertyBlob(fd, mode_blob);
+  }
+
+  if (fd >= 0) {
+    close(fd);
+  }
+}
+
+DrmDisplay *DrmDisplay::get_instance() {
+  if (instance == NULL) {
+    instance = new DrmDisplay();
+  }
+  return instance;
+}
+
+bool DrmDisplay::init(const char *device) {
+  fd = open(device, O_RDWR | O_CLOEXEC | O_NONBLOCK);
+  if (fd < 0) {
+    spdlog::warn("drm: failed to open {}", device);
+    return false;
+  }
+
+  if (drmSetClientCap(fd, DRM_CLIENT_CAP_UNIVERSAL_PLANES, 1) != 0
+      || drmSetClientCap(fd, DRM_CLIENT_CAP_ATOMIC, 1) != 0) {
+    spdlog::warn("drm: {} has no atomic modesetting", device);
+    close(fd);
+    fd = -1;
+    return false;
+  }
+
+  if (!find_output()) {
+    close(fd);
+    fd = -1;
+    return false;
+  }
+
+  conn_crtc_id = property_id(conn_id, DRM_MODE_OBJECT_CONNECTOR, "CRTC_ID");
+  crtc_mode_id = property_id(crtc_id, DRM_MODE_OBJECT_CRTC, "MODE_ID");
+  crtc_active = property_id(crtc_id, DRM_MODE_OBJECT_CRTC, "ACTIVE");
+  plane_fb_id = property_id(plane_id, DRM_MODE_OBJECT_PLANE, "FB_ID");
+  plane_crtc_id = property_id(plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_ID");
+  plane_src_x = property_id(plane_id, DRM_MODE_OBJECT_PLANE, "SRC_X");
+  plane_src_y = property_id(plane_id, DRM_MODE_OBJECT_PLANE, "SRC_Y");
+  plane_src_w = property_id(plane_id, DRM_MODE_OBJECT_PLANE, "SRC_W");
+  plane_src_h = property_id(plane_id, DRM_MODE_OBJECT_PLANE, "SRC_H");
+  plane_crtc_x = property_id(plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_X");
+  plane_crtc_y = property_id(plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_Y");
+  plane_crtc_w = property_id(plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_W");
+  plane_crtc_h = property_id(plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_H");
+
+  if (drmModeCreatePropertyBlob(fd, &mode, sizeof(mode), &mode_blob) != 0) {
+    spdlog::warn("drm: failed to create mode blob");
+    close(fd);
+    fd = -1;
+    return false;
+  }
+
+  if (!create_buffer(bufs[0]) || !create_buffer(bufs[1])) {
+    destroy_buffer(bufs[0]);
+    destroy_buffer(bufs[1]);
+    close(fd);
+    fd = -1;
+    return false;
+  }
+
+  front = 0;
+  if (!commit(bufs[front].fb_id, DRM_MODE_ATOMIC_ALLOW_MODESET)) {
+    spdlog::warn("drm: initial modeset failed");
+    destroy_buffer(bufs[0]);
+    destroy_buffer(bufs[1]);
+    close(fd);
+    fd = -1;
+    return false;
+  }
+
+  enabled = true;
+  spdlog::info("drm: {} {}x{}@{}, connector {}, crtc {}, plane {}", device,
+	       mode.hdisplay, mode.vdisplay, mode.vrefresh, conn_id, crtc_id, plane_id);
+  return true;
+}
+
+bool DrmDisplay::is_enabled() const {
+  return enabled;
+}
+
+int DrmDisplay::get_fd() const {
+  return fd;
+}
+
+lv_color_t *DrmDisplay::page(int idx) {
+  return (lv_color_t *)bufs[idx].map;
+}
+
+uint32_t DrmDisplay::get_width() const {
+  return mode.hdisplay;
+}
+
+uint32_t DrmDisplay::get_height() const {
+  return mode.vdisplay;
+}
+
+void DrmDisplay::blank() {
+  if (enabled && !commit(0, DRM_MODE_ATOMIC_ALLOW_MODESET, false)) {
+    spdlog::warn("drm: failed to blank");
+  }
+}
+
+void DrmDisplay::unblank() {
+  if (enabled && !commit(bufs[front].fb_id, DRM_MODE_ATOMIC_ALLOW_MODESET)) {
+    spdlog::warn("drm: failed to unblank");
+  }
+}
+
+void DrmDisplay::handle_events() {
+  drmEventContext ev = {};
+  ev.version = 2;
+  ev.page_flip_handler = &DrmDisplay::page_flip_handler;
+  drmHandleEvent(fd, &ev);
+}
+
+void DrmDisplay::flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p) {
+  // direct mode: the buffer is already drawn, flush is called for every
+  // redrawn area and the frame is complete with the last one
+  if (!lv_disp_flush_is_last(drv)) {
+    lv_disp_flush_ready(drv);
+    return;
+  }
+
+  DrmDisplay *d = instance;
+  uint32_t idx = color_p == d->page(0) ? 0 : 1;
+  d->flushing = drv;
+  if (!d->commit(d->bufs[idx].fb_id, DRM_MODE_PAGE_FLIP_EVENT | DRM_MODE_ATOMIC_NONBLOCK)) {
+    spdlog::warn("drm: page flip to buffer {} failed", idx);
+    d->flushing = NULL;
+    lv_disp_flush_ready(drv);
+    return;
+  }
+
+  // finished by page_flip_handler once the buffer is on screen
+  d->front = idx;
+}
+
+void DrmDisplay::wait(lv_disp_drv_t *drv) {
+  // lvgl is waiting for the flip before it draws the next frame, the event
+  // can't come through the main loop while we're inside lv_timer_handler
+  DrmDisplay *d = instance;
+  struct pollfd pfd = {d->fd, POLLIN, 0};
+  if (poll(&pfd, 1, DRM_FLIP_TIMEOUT_MS) > 0) {
+    d->handle_events();
+  } else if (d->flushing != NULL) {
+    spdlog::warn("drm: no flip event after {}ms", DRM_FLIP_TIMEOUT_MS);
+    d->flushing = NULL;
+    lv_disp_flush_ready(drv);
+  }
+}
+
+void DrmDisplay::page_flip_handler(int fd, unsigned int seq,
+				   unsigned int tv_sec, unsigned int tv_usec, void *data) {
+  DrmDisplay *d = (DrmDisplay *)data;
+  if (d->flushing != NULL) {
+    lv_disp_drv_t *drv = d->flushing;
+    d->flushing = NULL;
+    lv_disp_flush_ready(drv);
+  }
+}
+
+bool DrmDisplay::find_output() {
+  drmModeRes *res = drmModeGetResources(fd);
+  if (res == NULL) {
+    spdlog::warn("drm: not a modesetting device");
+    return false;
+  }
+
+  drmModeConnector *conn = NULL;
+  for (int i = 0; i < res->count_connectors && conn == NULL; i++) {
+    conn = drmModeGetConnector(fd, res->connectors[i]);
+    if (conn != NULL
+	&& (conn->connection != DRM_MODE_CONNECTED || conn->count_modes == 0)) {
+      drmModeFreeConnector(conn);
+      conn = NULL;
+    }
+  }
+
+  if (conn == NULL) {
+    spdlog::warn("drm: no connected display");
+    drmModeFreeResources(res);
+    return false;
+  }
+
+  conn_id = conn->connector_id;
+  mode = conn->modes[0];
+  for (int i = 0; i < conn->count_modes; i++) {
+    if (conn->modes[i].type & DRM_MODE_TYPE_PREFERRED) {
+      mode = conn->modes[i];
+      break;
+    }
+  }
+
+  // keep the crtc the connector is already on, else take the first one any
+  // of its encoders can drive
+  crtc_id = 0;
+  if (conn->encoder_id != 0) {
+    drmModeEncoder *enc = drmModeGetEncoder(fd, conn->encoder_id);
+    if (enc != NULL) {
+      crtc_id = enc->crtc_id;
+      drmModeFreeEncoder(enc);
+    }
+  }
+
+  for (int i = 0; i < conn->count_encoders && crtc_id == 0; i++) {
+    drmModeEncoder *enc = drmModeGetEncoder(fd, conn->encoders[i]);
+    if (enc == NULL) {
+      continue;
+    }
+
+    for (int j = 0; j < res->count_crtcs; j++) {
+      if (enc->possible_crtcs & (1 << j)) {
+	crtc_id = res->crtcs[j];
+	break;
+      }
+    }
+    drmModeFreeEncoder(enc);
+  }
+
+  int crtc_idx = -1;
+  for (int i = 0; i < res->count_crtcs; i++) {
+    if (res->crtcs[i] == crtc_id) {
+      crtc_idx = i;
+      break;
+    }
+  }
+
+  drmModeFreeConnector(conn);
+  drmModeFreeResources(res);
+
+  if (crtc_idx < 0) {
+    spdlog::warn("drm: no crtc for connector {}", conn_id);
+    return false;
+  }
+
+  return find_plane(crtc_idx);
+}
+
+bool DrmDisplay::find_plane(uint32_t crtc_idx) {
+  drmModePlaneRes *planes = drmModeGetPlaneResources(fd);
+  if (planes == NULL) {
+    spdlog::warn("drm: failed to list planes");
+    return false;
+  }
+
+  plane_id = 0;
+  for (uint32_t i = 0; i < planes->count_planes && plane_id == 0; i++) {
+    drmModePlane *plane = drmModeGetPlane(fd, planes->planes[i]);
+    if (plane == NULL) {
+      continue;
+    }
+
+    if (plane->possible_crtcs & (1 << crtc_idx)) {
+      drmModeObjectProperties *props =
+	drmModeObjectGetProperties(fd, plane->plane_id, DRM_MODE_OBJECT_PLANE);
+      for (uint32_t p = 0; props != NULL && p < props->count_props; p++) {
+	drmModePropertyRes *prop = drmModeGetProperty(fd, props->props[p]);
+	if (prop != NULL && strcmp(prop->name, "type") == 0
+	    && props->prop_values[p] == DRM_PLANE_TYPE_PRIMARY) {
+	  plane_id = plane->plane_id;
+	}
+	drmModeFreeProperty(prop);
+      }
+      drmModeFreeObjectProperties(props);
+    }
+    drmModeFreePlane(plane);
+  }
+  drmModeFreePlaneResources(planes);
+
+  if (plane_id == 0) {
+    spdlog::warn("drm: no primary plane for crtc {}", crtc_id);
+    return false;
+  }
+
+  return true;
+}
+
+bool DrmDisplay::create_buffer(DumbBuffer &b) {
+  struct drm_mode_create_dumb create = {};
+  create.width = mode.hdisplay;
+  create.height = mode.vdisplay;
+  create.bpp = LV_COLOR_DEPTH;
+  if (drmIoctl(fd, DRM_IOCTL_MODE_CREATE_DUMB, &create) != 0) {
+    spdlog::warn("drm: failed to create dumb buffer");
+    return false;
+  }
+
+  b.handle = create.handle;
+  b.pitch = create.pitch;
+  b.size = create.size;
+
+  // lvgl renders straight into the buffer, so it has to look exactly like
+  // an lvgl buffer
+  if ((LV_COLOR_DEPTH != 32 && LV_COLOR_DEPTH != 16)
+      || b.pitch != mode.hdisplay * sizeof(lv_color_t)) {
+    spdlog::info("drm: {} bytes per line doesn't match lvgl's layout", b.pitch);
+    destroy_buffer(b);
+    return false;
+  }
+
+  uint32_t handles[4] = {b.handle};
+  uint32_t pitches[4] = {b.pitch};
+  uint32_t offsets[4] = {0};
+  uint32_t format = LV_COLOR_DEPTH == 16 ? DRM_FORMAT_RGB565 : DRM_FORMAT_XRGB8888;
+  if (drmModeAddFB2(fd, mode.hdisplay, mode.vdisplay, format,
+		    handles, pitches, offsets, &b.fb_id, 0) != 0) {
+    spdlog::warn("drm: failed to add framebuffer");
+    destroy_buffer(b);
+    return false;
+  }
+
+  struct drm_mode_map_dumb map = {};
+  map.handle = b.handle;
+  if (drmIoctl(fd, DRM_IOCTL_MODE_MAP_DUMB, &map) != 0) {
+    spdlog::warn("drm: failed to map dumb buffer");
+    destroy_buffer(b);
+    return false;
+  }
+
+  void *p = mmap(NULL, b.size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, map.offset);
+  if (p == MAP_FAILED) {
+    spdlog::warn("drm: failed to map dumb buffer");
+    destroy_buffer(b);
+    return false;
+  }
+
+  b.map = (uint8_t *)p;
+  memset(b.map, 0, b.size);
+  return true;
+}
+
+void DrmDisplay::destroy_buffer(DumbBuffer &b) {
+  if (b.map != NULL) {
+    munmap(b.map, b.size);
+    b.map = NULL;
+  }
+
+  if (b.fb_id != 0) {
+    drmModeRmFB(fd, b.fb_id);
+    b.fb_id = 0;
+  }
+
+  if (b.handle != 0) {
+    struct drm_mode_destroy_dumb destroy = {};
+    destroy.handle = b.handle;
+    drmIoctl(fd, DRM_IOCTL_MODE_DESTROY_DUMB, &destroy);
+    b.handle = 0;
+  }
+}
+
+uint32_t DrmDisplay::property_id(uint32_t obj_id, uint32_t obj_type, const char *name) {
+  drmModeObjectProperties *props = drmModeObjectGetProperties(fd, obj_id, obj_type);
+  if (props == NULL) {
+    return 0;
+  }
+
+  uint32_t id = 0;
+  for (uint32_t i = 0; i < props->count_props && id == 0; i++) {
+    drmModePropertyRes *prop = drmModeGetProperty(fd, props->props[i]);
+    if (prop != NULL && strcmp(prop->name, name) == 0) {
+      id = prop->prop_id;
+    }
+    drmModeFreeProperty(prop);
+  }
+  drmModeFreeObjectProperties(props);
+
+  if (id == 0) {
+    spdlog::warn("drm: object {} has no {} property", obj_id, name);
+  }
+  return id;
+}
+
+bool DrmDisplay::commit(uint32_t fb_id, uint32_t flags, bool active) {
+  drmModeAtomicReq *req = drmModeAtomicAlloc();
+  if (req == NULL) {
+    return false;
+  }
+
+  if (flags & DRM_MODE_ATOMIC_ALLOW_MODESET) {
+    drmModeAtomicAddProperty(req, conn_id, conn_crtc_id, active ? crtc_id : 0);
+    drmModeAtomicAddProperty(req, crtc_id, crtc_mode_id, active ? mode_blob : 0);
+    drmModeAtomicAddProperty(req, crtc_id, crtc_active, active ? 1 : 0);
+    drmModeAtomicAddProperty(req, plane_id, plane_crtc_id, active ? crtc_id : 0);
+    if (active) {
+      // src is 16.16 fixed point
+      drmModeAtomicAddProperty(req, plane_id, plane_src_x, 0);
+      drmModeAtomicAddProperty(req, plane_id, plane_src_y, 0);
+      drmModeAtomicAddProperty(req, plane_id, plane_src_w, (uint64_t)mode.hdisplay << 16);
+      drmModeAtomicAddProperty(req, plane_id, plane_src_h, (uint64_t)mode.vdisplay << 16);
+      drmModeAtomicAddProperty(req, plane_id, plane_crtc_x, 0);
+      drmModeAtomicAddProperty(req, plane_id, plane_crtc_y, 0);
+      drmModeAtomicAddProperty(req, plane_id, plane_crtc_w, mode.hdisplay);
+      drmModeAtomicAddProperty(req, plane_id, plane_crtc_h, mode.vdisplay);
+    }
+  }
+  drmModeAtomicAddProperty(req, plane_id, plane_fb_id, fb_id);
+
+  int ret = drmModeAtomicCommit(fd, req, flags, this);
+  drmModeAtomicFree(req);
+  return ret == 0;
+}
+
+#endif // GUPPY_DRM
@@ -0,0 +1,103 @@
+#ifndef __DRM_DISPLAY_H__
+#define __DRM_DISPLAY_H__
+
+#ifdef GUPPY_DRM
+
+#include "lvgl/lvgl.h"
+
+#include <xf86drm.h>
+#include <xf86drmMode.h>
+
+#include <cstddef>
+#include <cstdint>
+
+// DRM/KMS output, the alternative to fbdev for boards with a KMS driver.
+// Two dumb buffers (XRGB8888, RGB565 in GUPPY_RGB565 builds) are scanned out
+// by the primary plane of the first connected connector and LVGL renders in
+// direct mode straight into the one that isn't on screen. A frame is presented with a non-blocking atomic
+// commit; the flip-complete event is read from the DRM fd in the main loop
+// (UiReactor) and only then is the flush finished, so LVGL never draws into
+// a buffer that is still being scanned out.
+//
+// Works with the vkms virtual driver, so it can be tried on any Linux box.
+class DrmDisplay {
+ private:
+  static DrmDisplay *instance;
+  DrmDisplay();
+
+ public:
+  DrmDisplay(DrmDisplay &o) = delete;
+  void operator=(const DrmDisplay &) = delete;
+  ~DrmDisplay();
+
+  static DrmDisplay *get_instance();
+
+  bool init(const char *device);
+  bool is_enabled() const;
+  int get_fd() const;
+
+  // the two buffers, each width * height pixels
+  lv_color_t *page(int idx);
+  uint32_t get_width() const;
+  uint32_t get_height() const;
+
+  // turns the crtc off/on, the drm counterpart of fbdev_blank/unblank
+  void blank();
+  void unblank();
+
+  // reads pending events (flip complete) from the drm fd
+  void handle_events();
+
+  static void flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p);
+  static void wait(lv_disp_drv_t *drv);
+
+ private:
+  struct DumbBuffer {
+    uint32_t handle;
+    uint32_t pitch;
+    uint32_t fb_id;
+    size_t size;
+    uint8_t *map;
+  };
+
+  bool find_output();
+  bool find_plane(uint32_t crtc_idx);
+  bool create_buffer(DumbBuffer &b);
+  void destroy_buffer(DumbBuffer &b);
+  uint32_t property_id(uint32_t obj_id, uint32_t obj_type, const char *name);
+  bool commit(uint32_t fb_id, uint32_t flags, bool active = true);
+
+  static void page_flip_handler(int fd, unsigned int seq,
+				unsigned int tv_sec, unsigned int tv_usec, void *data);
+
+  int fd;
+  uint32_t conn_id;
+  uint32_t crtc_id;
+  uint32_t plane_id;
+  drmModeModeInfo mode;
+  uint32_t mode_blob;
+
+  // atomic property ids
+  uint32_t conn_crtc_id;
+  uint32_t crtc_mode_id;
+  uint32_t crtc_active;
+  uint32_t plane_fb_id;
+  uint32_t plane_crtc_id;
+  uint32_t plane_src_x;
+  uint32_t plane_src_y;
+  uint32_t plane_src_w;
+  uint32_t plane_src_h;
+  uint32_t plane_crtc_x;
+  uint32_t plane_crtc_y;
+  uint32_t plane_crtc_w;
+  uint32_t plane_crtc_h;
+
+  DumbBuffer bufs[2];
+  uint32_t front;
+  lv_disp_drv_t *flushing;
+  bool enabled;
+};
+
+#endif // GUPPY_DRM
+
+#endif // __DRM_DISPLAY_H__
@@ -125,7 +125,13 @@ ExtruderPanel::ExtruderPanel(KWebSocketClient &websocket_client,
   // lv_obj_set_grid_cell(back_btn.get_container(), LV_GRID_ALIGN_END, 2, 1, LV_GRID_ALIGN_END, 2, 2);
 
 
-  ws.register_notify_update(this);
+  ws.register_status_update(this, "extruder", "target", [this](const json &v) {
+    extruder_temp.update_target(v.template get<int>());
+  });
+
+  ws.register_status_update(this, "extruder", "temperature", [this](const json &v) {
+    extruder_temp.update_value(v.template get<int>());
+  });
 }
 
 ExtruderPanel::~ExtruderPanel() {
@@ -133,6 +139,8 @@ ExtruderPanel::~ExtruderPanel() {
     lv_obj_del(panel_cont);
     panel_cont = NULL;
   }
+
+  ws.unregister_status_update(this);
 }
 
 void ExtruderPanel::foreground() {
@@ -143,21 +151,6 @@ void ExtruderPanel::enable_spoolman() {
   spoolman_btn.enable();
 }
 
-void ExtruderPanel::consume(json &j) {
-  std::lock_guard<std::mutex> lock(lv_lock);
-  auto target_value = j["/params/0/extruder/target"_json_pointer];
-  if (!target_value.is_null()) {
-    int target = target_value.template get<int>();
-    extruder_temp.update_target(target);
-  }
-
-  auto temp_value = j["/params/0/extruder/temperature"_json_pointer];
-  if (!temp_value.is_null()) {
-    int value = temp_value.template get<int>();
-    extruder_temp.update_value(value);
-  }
-}
-
 void ExtruderPanel::handle_callback(lv_event_t *e) {
   spdlog::trace("handling extruder panel callback");
   if (lv_event_get_code(e) == LV_EVENT_VALUE_CHANGED) {
@@ -17,7 +17,6 @@ class ExtruderPanel : public NotifyConsumer {
 
   void foreground();
   void enable_spoolman();  
-  void consume(json &j);
   void handle_callback(lv_event_t *e);
 
   static void _handle_callback(lv_event_t *event) {
@@ -24,7 +24,6 @@ FanPanel::FanPanel(KWebSocketClient &websocket_client, std::mutex &lock)
   lv_obj_set_flex_flow(fans_cont, LV_FLEX_FLOW_COLUMN);
 
   lv_obj_align(back_btn.get_container(), LV_ALIGN_BOTTOM_RIGHT, 0, -20);
-  ws.register_notify_update(this);
 }
 
 FanPanel::~FanPanel() {
@@ -35,30 +34,13 @@ FanPanel::~FanPanel() {
 
   fans.clear();
 
-  ws.unregister_notify_update(this);
-}
-
-void FanPanel::consume(json &j) {
-  std::lock_guard<std::mutex> lock(lv_lock);
-  for (auto &f : fans) {
-    // hack for output_pin fans
-    auto fan_value = j[json::json_pointer(fmt::format("/params/0/{}/value", f.first))];
-    if (!fan_value.is_null()) {
-      int v = static_cast<int>(fan_value.template get<double>() * 100);
-      f.second->update_value(v);
-    }
-
-    fan_value = j[json::json_pointer(fmt::format("/params/0/{}/speed", f.first))];
-    if (!fan_value.is_null()) {
-      int v = static_cast<int>(fan_value.template get<double>() * 100);
-      f.second->update_value(v);
-    }
-  }
+  ws.unregister_status_update(this);
 }
 
 void FanPanel::create_fans(json &f) {
   std::lock_guard<std::mutex> lock(lv_lock);
   fans.clear();
+  ws.unregister_status_update(this);
 
   for (auto &fan : f.items()) {
     std::string key = fan.key();
@@ -75,6 +57,13 @@ void FanPanel::create_fans(json &f) {
     auto fptr = std::make_shared<SliderContainer>(fans_cont, display_name.c_str(), &cancel, "Off",
       &fan_on, "Max", fan_cb, this);
     fans.insert({key, fptr});
+
+    auto update_fan = [fptr](const json &v) {
+      fptr->update_value(static_cast<int>(v.template get<double>() * 100));
+    };
+    // hack for output_pin fans
+    ws.register_status_update(this, key, "value", update_fan);
+    ws.register_status_update(this, key, "speed", update_fan);
     // lv_obj_set_grid_cell(fptr->get_container(), LV_GRID_ALIGN_CENTER, 0, 1, LV_GRID_ALIGN_CENTER, rowidx++, 1);
   }
 
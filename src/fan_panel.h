@@ -16,7 +16,6 @@ class FanPanel : public NotifyConsumer {
   FanPanel(KWebSocketClient &ws, std::mutex &lock);
   ~FanPanel();
 
-  void consume(json &j);
   
   lv_obj_t *get_container();
   void create_fans(json &f);
@@ -0,0 +1,186 @@
+#include "fb_flip.h"
+#include "spdlog/spdlog.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#ifdef __linux__
+#include <linux/fb.h>
+#endif
+
+FbFlip *FbFlip::instance = NULL;
+
+FbFlip::FbFlip()
+  : fd(-1)
+  , fbp(NULL)
+  , map_size(0)
+  , page_size(0)
+  , width(0)
+  , height(0)
+  , front(0)
+  , vsync(false)
+{
+}
+
+FbFlip::~FbFlip() {
+  if (fbp != NULL) {
+    munmap(fbp, map_size);
+  }
+
+  if (fd >= 0) {
+    close(fd);
+  }
+}
+
+FbFlip *FbFlip::get_instance() {
+  if (instance == NULL) {
+    instance = new FbFlip();
+  }
+  return instance;
+}
+
+bool FbFlip::init(const char *path) {
+#ifdef __linux__
+  fd = open(path, O_RDWR | O_CLOEXEC);
+  if (fd < 0) {
+    spdlog::warn("page flip: failed to open {}", path);
+    return false;
+  }
+
+  struct fb_var_screeninfo var;
+  struct fb_fix_screeninfo fix;
+  if (ioctl(fd, FBIOGET_VSCREENINFO, &var) != 0
+      || ioctl(fd, FBIOGET_FSCREENINFO, &fix) != 0) {
+    spdlog::warn("page flip: failed to read screen info");
+    close(fd);
+    fd = -1;
+    return false;
+  }
+
+  // lvgl renders straight into the pages, so the framebuffer has to look
+  // exactly like an lvgl buffer
+  if (var.bits_per_pixel != LV_COLOR_DEPTH
+      || fix.line_length != var.xres * sizeof(lv_color_t)) {
+    spdlog::info("page flip: {} bpp, {} bytes per line doesn't match lvgl's layout",
+		 var.bits_per_pixel, fix.line_length);
+    close(fd);
+    fd = -1;
+    return false;
+  }
+
+  if (var.yres_virtual < var.yres * 2) {
+    var.yres_virtual = var.yres * 2;
+    if (ioctl(fd, FBIOPUT_VSCREENINFO, &var) != 0
+	|| ioctl(fd, FBIOGET_VSCREENINFO, &var) != 0
+	|| ioctl(fd, FBIOGET_FSCREENINFO, &fix) != 0
+	|| var.yres_virtual < var.yres * 2) {
+      spdlog::info("page flip: driver has no room for a second page");
+      close(fd);
+      fd = -1;
+      return false;
+    }
+  }
+
+  width = var.xres;
+  height = var.yres;
+  page_size = (size_t)fix.line_length * height;
+  map_size = page_size * 2;
+  if (fix.smem_len < map_size) {
+    spdlog::info("page flip: framebuffer memory too small for two pages");
+    close(fd);
+    fd = -1;
+    return false;
+  }
+
+  void *p = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (p == MAP_FAILED) {
+    spdlog::warn("page flip: failed to map framebuffer");
+    close(fd);
+    fd = -1;
+    return false;
+  }
+  fbp = (uint8_t *)p;
+
+  front = 0;
+  if (!pan(front)) {
+    spdlog::info("page flip: driver can't pan");
+    munmap(fbp, map_size);
+    fbp = NULL;
+    close(fd);
+    fd = -1;
+    return false;
+  }
+
+  uint32_t crtc = 0;
+  vsync = ioctl(fd, FBIO_WAITFORVSYNC, &crtc) == 0;
+  spdlog::info("page flip: {}x{}, two pages, vsync {}", width, height, vsync ? "on" : "unsupported");
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool FbFlip::is_enabled() const {
+  return fbp != NULL;
+}
+
+lv_color_t *FbFlip::page(int idx) {
+  return (lv_color_t *)(fbp + page_size * idx);
+}
+
+uint32_t FbFlip::get_width() const {
+  return width;
+}
+
+uint32_t FbFlip::get_height() const {
+  return height;
+}
+
+void FbFlip::restore() {
+  if (is_enabled()) {
+    pan(front);
+  }
+}
+
+void FbFlip::flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p) {
+  // direct mode: lvgl has already drawn into the page, flush is called for
+  // every redrawn area and the frame is complete with the last one
+  if (lv_disp_flush_is_last(drv)) {
+    instance->present(drv, color_p);
+  }
+
+  lv_disp_flush_ready(drv);
+}
+
+void FbFlip::present(lv_disp_drv_t *drv, lv_color_t *color_p) {
+#ifdef __linux__
+  uint32_t idx = color_p == page(0) ? 0 : 1;
+  if (!pan(idx)) {
+    spdlog::warn("page flip: pan to page {} failed", idx);
+    return;
+  }
+
+  // don't let lvgl draw into the old page while it's still scanned out
+  if (vsync) {
+    uint32_t crtc = 0;
+    ioctl(fd, FBIO_WAITFORVSYNC, &crtc);
+  }
+  front = idx;
+#endif
+}
+
+bool FbFlip::pan(uint32_t page_idx) {
+#ifdef __linux__
+  struct fb_var_screeninfo var;
+  if (ioctl(fd, FBIOGET_VSCREENINFO, &var) != 0) {
+    return false;
+  }
+
+  var.xoffset = 0;
+  var.yoffset = page_idx * height;
+  return ioctl(fd, FBIOPAN_DISPLAY, &var) == 0;
+#else
+  return false;
+#endif
+}
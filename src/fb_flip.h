@@ -0,0 +1,58 @@
+#ifndef __FB_FLIP_H__
+#define __FB_FLIP_H__
+
+#include "lvgl/lvgl.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// Double buffered framebuffer output. The framebuffer is mmapped with a
+// virtual height of two screens and LVGL renders in direct mode straight
+// into the page that isn't being scanned out. A frame is presented by
+// panning to it (FBIOPAN_DISPLAY) and waiting for vsync, so nothing is
+// copied into the framebuffer and nothing tears. LVGL keeps the other page
+// current itself, copying over only the areas it just redrew (double
+// buffered direct mode).
+//
+// init() fails (and the caller keeps fbdev_flush) if the driver can't give
+// us a second page, can't pan, or its pixel layout doesn't match LVGL's.
+class FbFlip {
+ private:
+  static FbFlip *instance;
+  FbFlip();
+
+ public:
+  FbFlip(FbFlip &o) = delete;
+  void operator=(const FbFlip &) = delete;
+  ~FbFlip();
+
+  static FbFlip *get_instance();
+
+  bool init(const char *path);
+  bool is_enabled() const;
+
+  // the two pages, each width * height pixels
+  lv_color_t *page(int idx);
+  uint32_t get_width() const;
+  uint32_t get_height() const;
+
+  // pans back to the page on screen, e.g. after fbdev_unblank() reset it
+  void restore();
+
+  static void flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p);
+
+ private:
+  void present(lv_disp_drv_t *drv, lv_color_t *color_p);
+  bool pan(uint32_t page_idx);
+
+  int fd;
+  uint8_t *fbp;
+  size_t map_size;
+  size_t page_size;
+  uint32_t width;
+  uint32_t height;
+  uint32_t front;
+  bool vsync;
+};
+
+#endif // __FB_FLIP_H__
@@ -0,0 +1,229 @@
+#include "fb_rotate.h"
+#include "spdlog/spdlog.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#ifdef __linux__
+#include <linux/fb.h>
+#endif
+
+#if LV_COLOR_DEPTH == 32 && defined(__ARM_NEON) && !defined(GUPPY_NO_SIMD)
+#include <arm_neon.h>
+#define FB_ROTATE_SIMD 1
+#elif LV_COLOR_DEPTH == 32 && defined(__mips_msa) && !defined(GUPPY_NO_SIMD)
+#include <msa.h>
+#define FB_ROTATE_SIMD 1
+#endif
+
+// 16 32bpp pixels are a 64 byte cache line
+#define FB_ROTATE_TILE 16
+
+FbRotate *FbRotate::instance = NULL;
+
+#ifdef FB_ROTATE_SIMD
+// dst row i = src column i, strides in pixels
+static inline void transpose_4x4(const uint32_t *src, intptr_t src_stride,
+				 uint32_t *dst, intptr_t dst_stride) {
+#if defined(__ARM_NEON)
+  uint32x4_t r0 = vld1q_u32(src);
+  uint32x4_t r1 = vld1q_u32(src + src_stride);
+  uint32x4_t r2 = vld1q_u32(src + 2 * src_stride);
+  uint32x4_t r3 = vld1q_u32(src + 3 * src_stride);
+
+  uint32x4x2_t t01 = vtrnq_u32(r0, r1);
+  uint32x4x2_t t23 = vtrnq_u32(r2, r3);
+
+  vst1q_u32(dst, vcombine_u32(vget_low_u32(t01.val[0]), vget_low_u32(t23.val[0])));
+  vst1q_u32(dst + dst_stride, vcombine_u32(vget_low_u32(t01.val[1]), vget_low_u32(t23.val[1])));
+  vst1q_u32(dst + 2 * dst_stride, vcombine_u32(vget_high_u32(t01.val[0]), vget_high_u32(t23.val[0])));
+  vst1q_u32(dst + 3 * dst_stride, vcombine_u32(vget_high_u32(t01.val[1]), vget_high_u32(t23.val[1])));
+#else
+  v4i32 r0 = __msa_ld_w((void *)src, 0);
+  v4i32 r1 = __msa_ld_w((void *)(src + src_stride), 0);
+  v4i32 r2 = __msa_ld_w((void *)(src + 2 * src_stride), 0);
+  v4i32 r3 = __msa_ld_w((void *)(src + 3 * src_stride), 0);
+
+  v4i32 t0 = __msa_ilvr_w(r1, r0);
+  v4i32 t1 = __msa_ilvl_w(r1, r0);
+  v4i32 t2 = __msa_ilvr_w(r3, r2);
+  v4i32 t3 = __msa_ilvl_w(r3, r2);
+
+  __msa_st_w((v4i32)__msa_ilvr_d((v2i64)t2, (v2i64)t0), dst, 0);
+  __msa_st_w((v4i32)__msa_ilvl_d((v2i64)t2, (v2i64)t0), dst + dst_stride, 0);
+  __msa_st_w((v4i32)__msa_ilvr_d((v2i64)t3, (v2i64)t1), dst + 2 * dst_stride, 0);
+  __msa_st_w((v4i32)__msa_ilvl_d((v2i64)t3, (v2i64)t1), dst + 3 * dst_stride, 0);
+#endif
+}
+#endif  // FB_ROTATE_SIMD
+
+// dst row x = src column x. strides are in pixels and may be negative, which
+// is how 90 (dst rows go up) and 270 (src rows read bottom up) share it.
+static void transpose(const lv_color_t *src, intptr_t src_stride, int32_t w, int32_t h,
+		      lv_color_t *dst, intptr_t dst_stride) {
+  for (int32_t ty = 0; ty < h; ty += FB_ROTATE_TILE) {
+    int32_t th = std::min(FB_ROTATE_TILE, h - ty);
+    for (int32_t tx = 0; tx < w; tx += FB_ROTATE_TILE) {
+      int32_t tw = std::min(FB_ROTATE_TILE, w - tx);
+      const lv_color_t *s = src + ty * src_stride + tx;
+      lv_color_t *d = dst + tx * dst_stride + ty;
+
+#ifdef FB_ROTATE_SIMD
+      if (tw == FB_ROTATE_TILE && th == FB_ROTATE_TILE) {
+	for (int32_t y = 0; y < FB_ROTATE_TILE; y += 4) {
+	  for (int32_t x = 0; x < FB_ROTATE_TILE; x += 4) {
+	    transpose_4x4((const uint32_t *)(s + y * src_stride + x), src_stride,
+			  (uint32_t *)(d + x * dst_stride + y), dst_stride);
+	  }
+	}
+	continue;
+      }
+#endif
+
+      for (int32_t x = 0; x < tw; x++) {
+	lv_color_t *drow = d + x * dst_stride;
+	for (int32_t y = 0; y < th; y++) {
+	  drow[y] = s[y * src_stride + x];
+	}
+      }
+    }
+  }
+}
+
+FbRotate::FbRotate()
+  : fd(-1)
+  , fbp(NULL)
+  , map_size(0)
+  , screen(NULL)
+  , stride(0)
+  , width(0)
+  , height(0)
+{
+}
+
+FbRotate::~FbRotate() {
+  if (fbp != NULL) {
+    munmap(fbp, map_size);
+  }
+
+  if (fd >= 0) {
+    close(fd);
+  }
+}
+
+FbRotate *FbRotate::get_instance() {
+  if (instance == NULL) {
+    instance = new FbRotate();
+  }
+  return instance;
+}
+
+bool FbRotate::init(const char *path) {
+#ifdef __linux__
+  fd = open(path, O_RDWR | O_CLOEXEC);
+  if (fd < 0) {
+    spdlog::warn("rotate: failed to open {}", path);
+    return false;
+  }
+
+  struct fb_var_screeninfo var;
+  struct fb_fix_screeninfo fix;
+  if (ioctl(fd, FBIOGET_VSCREENINFO, &var) != 0
+      || ioctl(fd, FBIOGET_FSCREENINFO, &fix) != 0) {
+    spdlog::warn("rotate: failed to read screen info");
+    close(fd);
+    fd = -1;
+    return false;
+  }
+
+  // pixels are copied as they are, only their position changes
+  if (var.bits_per_pixel != LV_COLOR_DEPTH
+      || fix.line_length % sizeof(lv_color_t) != 0) {
+    spdlog::info("rotate: {} bpp framebuffer doesn't match lvgl's {} bpp",
+		 var.bits_per_pixel, LV_COLOR_DEPTH);
+    close(fd);
+    fd = -1;
+    return false;
+  }
+
+  map_size = fix.smem_len;
+  void *p = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (p == MAP_FAILED) {
+    spdlog::warn("rotate: failed to map framebuffer");
+    close(fd);
+    fd = -1;
+    return false;
+  }
+  fbp = (uint8_t *)p;
+
+  width = var.xres;
+  height = var.yres;
+  stride = fix.line_length / sizeof(lv_color_t);
+  screen = (lv_color_t *)(fbp + (size_t)var.yoffset * fix.line_length)
+    + var.xoffset;
+
+  spdlog::info("rotate: {}x{}, rotating into the framebuffer", width, height);
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool FbRotate::is_enabled() const {
+  return fbp != NULL;
+}
+
+uint32_t FbRotate::get_width() const {
+  return width;
+}
+
+uint32_t FbRotate::get_height() const {
+  return height;
+}
+
+void FbRotate::flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p) {
+  instance->rotate((lv_disp_rot_t)drv->rotated, area, color_p);
+  lv_disp_flush_ready(drv);
+}
+
+void FbRotate::rotate(lv_disp_rot_t rotation, const lv_area_t *area, const lv_color_t *color_p) {
+  // area is in logical coordinates, same mapping as lvgl's sw_rotate:
+  //   90: (x, y) -> (y, height - 1 - x)
+  //  180: (x, y) -> (width - 1 - x, height - 1 - y)
+  //  270: (x, y) -> (width - 1 - y, x)
+  int32_t w = lv_area_get_width(area);
+  int32_t h = lv_area_get_height(area);
+
+  switch (rotation) {
+  case LV_DISP_ROT_90:
+    transpose(color_p, w, w, h,
+	      screen + (intptr_t)(height - 1 - area->x1) * stride + area->y1, -(intptr_t)stride);
+    break;
+
+  case LV_DISP_ROT_270:
+    transpose(color_p + (intptr_t)(h - 1) * w, -(intptr_t)w, w, h,
+	      screen + (intptr_t)area->x1 * stride + (width - 1 - area->y2), stride);
+    break;
+
+  case LV_DISP_ROT_180:
+    for (int32_t y = 0; y < h; y++) {
+      const lv_color_t *s = color_p + (intptr_t)y * w;
+      lv_color_t *d = screen + (intptr_t)(height - 1 - area->y1 - y) * stride
+	+ (width - 1 - area->x1);
+      for (int32_t x = 0; x < w; x++) {
+	*(d - x) = s[x];
+      }
+    }
+    break;
+
+  default:
+    for (int32_t y = 0; y < h; y++) {
+      memcpy(screen + (intptr_t)(area->y1 + y) * stride + area->x1,
+	     color_p + (intptr_t)y * w, w * sizeof(lv_color_t));
+    }
+    break;
+  }
+}
@@ -0,0 +1,50 @@
+#ifndef __FB_ROTATE_H__
+#define __FB_ROTATE_H__
+
+#include "lvgl/lvgl.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// Rotated framebuffer output, used instead of LVGL's sw_rotate when
+// display_rotate is set. LVGL renders in logical (rotated) coordinates as if
+// the display rotated in hardware, and flush writes each area straight into
+// the framebuffer already rotated. 90/270 are blocked transposes, tile by
+// tile so both the reads and the writes stay within a few cache lines, with
+// a NEON or MSA 4x4 kernel on 32 bpp builds. 180 is a reversed row copy.
+//
+// init() fails (and the caller keeps sw_rotate) if the framebuffer's pixel
+// layout doesn't match LVGL's.
+class FbRotate {
+ private:
+  static FbRotate *instance;
+  FbRotate();
+
+ public:
+  FbRotate(FbRotate &o) = delete;
+  void operator=(const FbRotate &) = delete;
+  ~FbRotate();
+
+  static FbRotate *get_instance();
+
+  bool init(const char *path);
+  bool is_enabled() const;
+
+  uint32_t get_width() const;
+  uint32_t get_height() const;
+
+  static void flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p);
+
+ private:
+  void rotate(lv_disp_rot_t rotation, const lv_area_t *area, const lv_color_t *color_p);
+
+  int fd;
+  uint8_t *fbp;
+  size_t map_size;
+  lv_color_t *screen;
+  uint32_t stride;
+  uint32_t width;
+  uint32_t height;
+};
+
+#endif // __FB_ROTATE_H__
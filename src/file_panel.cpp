@@ -52,6 +52,7 @@ FilePanel::FilePanel(lv_obj_t *parent)
 }
 
 FilePanel::~FilePanel() {
+  ThumbnailLoader::get_instance()->cancel(this);
   if (file_cont != NULL) {
     lv_obj_del(file_cont);
     file_cont = NULL;
@@ -83,32 +84,44 @@ void FilePanel::refresh_view(json &j, const std::string &gcode_path) {
     KUtils::bytes_to_mb(j["result"]["size"].template get<size_t>()),
     time_stream.str());
 
+  lv_label_set_text(detail_label, detail.c_str());
+
   auto width_scale = (double)lv_disp_get_physical_hor_res(NULL) / 800.0;
-  auto thumb_result = KUtils::get_thumbnail(gcode_path, j, width_scale);
-  std::string fullpath = thumb_result.first;
-  size_t raw_thumb_w = thumb_result.second.first;
-  size_t raw_thumb_h = thumb_result.second.second;
+  auto thumb_src = KUtils::get_thumbnail(gcode_path, j, width_scale);
 
-  if (!fullpath.empty()) {
-    lv_img_set_src(thumbnail, ("A:" + fullpath).c_str());
-    lv_label_set_text(detail_label, detail.c_str());
+  if (thumb_src.path.empty()) {
+    ThumbnailLoader::get_instance()->cancel(this);
+    lv_img_set_src(thumbnail, NULL);
+    ((lv_img_t *)thumbnail)->src_type = LV_IMG_SRC_SYMBOL;
+  } else {
+    // placeholder until the loader is done
+    lv_img_set_src(thumbnail, LV_SYMBOL_IMAGE);
+    lv_obj_align_to(thumbnail, thumbnail_container, LV_ALIGN_CENTER, 0, 0);
 
-    // Force layout pass so thumbnail container gets correct dimensions
-    lv_refr_now(NULL);
+    // container dimensions are only known after a layout pass
+    lv_obj_update_layout(thumbnail_container);
 
+    // a quarter larger than fits, the container crops it
     lv_coord_t cont_w = lv_obj_get_width(thumbnail_container);
     lv_coord_t cont_h = lv_obj_get_height(thumbnail_container);
+    ThumbnailLoader::get_instance()->load(this, thumb_src, cont_w * 5 / 4, cont_h * 5 / 4,
+      [this](std::shared_ptr<Thumbnail> t) { this->show_thumbnail(t); });
+  }
+  // no longer shown
+  thumb.reset();
+}
 
-    float scale_w = raw_thumb_w ? (float)cont_w / raw_thumb_w : 1.0f;
-    float scale_h = raw_thumb_h ? (float)cont_h / raw_thumb_h : 1.0f;
-    float scale = std::min(scale_w, scale_h);
-
-    lv_img_set_zoom(thumbnail, scale * 320);
-    lv_obj_align_to(thumbnail, thumbnail_container, LV_ALIGN_CENTER, 0, 0);
-  } else {
+void FilePanel::show_thumbnail(std::shared_ptr<Thumbnail> t) {
+  if (!t) {
     lv_img_set_src(thumbnail, NULL);
     ((lv_img_t *)thumbnail)->src_type = LV_IMG_SRC_SYMBOL;
+    return;
   }
+
+  // already at its final size
+  thumb = t;
+  lv_img_set_src(thumbnail, &thumb->dsc);
+  lv_obj_align_to(thumbnail, thumbnail_container, LV_ALIGN_CENTER, 0, 0);
 }
 
 void FilePanel::foreground() {
@@ -118,7 +131,3 @@ void FilePanel::foreground() {
 lv_obj_t *FilePanel::get_container() {
   return file_cont;
 }
-
-const char *FilePanel::get_thumbnail_path() {
-  return (const char *)lv_img_get_src(thumbnail);
-}
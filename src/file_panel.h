@@ -3,8 +3,10 @@
 
 #include "lvgl/lvgl.h"
 #include "button_container.h"
+#include "thumbnail_loader.h"
 #include "hv/json.hpp"
 
+#include <memory>
 #include <string>
 
 using json = nlohmann::json;
@@ -17,14 +19,17 @@ public:
   void foreground();
   void refresh_view(json &j, const std::string &gcode_path);
   lv_obj_t *get_container();
-  const char *get_thumbnail_path();
 
 private:
+  // lv_lock held
+  void show_thumbnail(std::shared_ptr<Thumbnail> t);
+
   lv_obj_t *file_cont;
   lv_obj_t *thumbnail_container;
   lv_obj_t *thumbnail;
   lv_obj_t *fname_label;
   lv_obj_t *detail_label;
+  std::shared_ptr<Thumbnail> thumb;
 };
 
 #endif // __FILE_PANEL_H__
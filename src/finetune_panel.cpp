@@ -88,7 +88,25 @@ FineTunePanel::FineTunePanel(KWebSocketClient &websocket_client, std::mutex &l)
   lv_obj_set_grid_cell(values_cont, LV_GRID_ALIGN_STRETCH, 4, 1, LV_GRID_ALIGN_STRETCH, 0, 3);
   lv_obj_set_grid_cell(back_btn.get_container(), LV_GRID_ALIGN_STRETCH, 4, 1, LV_GRID_ALIGN_STRETCH, 3, 1);
 
-  ws.register_notify_update(this);
+  ws.register_status_update(this, "gcode_move", "homing_origin", [this](const json &v) {
+    if (v.size() > 2) {
+      z_offset.update_label(fmt::format("{:.5} mm", v.at(2).template get<double>()).c_str());
+    }
+  });
+
+  ws.register_status_update(this, "extruder", "pressure_advance", [this](const json &v) {
+    pa.update_label(fmt::format("{:.5} mm/s", v.template get<double>()).c_str());
+  });
+
+  ws.register_status_update(this, "gcode_move", "speed_factor", [this](const json &v) {
+    speed_factor.update_label(fmt::format("{}%",
+      static_cast<int>(v.template get<double>() * 100)).c_str());
+  });
+
+  ws.register_status_update(this, "gcode_move", "extrude_factor", [this](const json &v) {
+    flow_factor.update_label(fmt::format("{}%",
+      static_cast<int>(v.template get<double>() * 100)).c_str());
+  });
 }
 
 FineTunePanel::~FineTunePanel() {
@@ -96,7 +114,7 @@ FineTunePanel::~FineTunePanel() {
     lv_obj_del(panel_cont);
     panel_cont = NULL;
   }
-  ws.unregister_notify_update(this);
+  ws.unregister_status_update(this);
 }
 
 void FineTunePanel::foreground() {
@@ -129,31 +147,6 @@ void FineTunePanel::foreground() {
   lv_obj_move_foreground(panel_cont);
 }
 
-void FineTunePanel::consume(json &j) {
-  std::lock_guard<std::mutex> lock(lv_lock);
-  auto v = j["/params/0/gcode_move/homing_origin/2"_json_pointer];
-  if (!v.is_null()) {
-    z_offset.update_label(fmt::format("{:.5} mm", v.template get<double>()).c_str());
-  }
-
-  v = j["/params/0/extruder/pressure_advance"_json_pointer];
-  if (!v.is_null()) {
-    pa.update_label(fmt::format("{:.5} mm/s", v.template get<double>()).c_str());
-  }
-
-  v = j["/params/0/gcode_move/speed_factor"_json_pointer];
-  if (!v.is_null()) {
-    speed_factor.update_label(fmt::format("{}%",
-      static_cast<int>(v.template get<double>() * 100)).c_str());
-  }
-
-  v = j["/params/0/gcode_move/extrude_factor"_json_pointer];
-  if (!v.is_null()) {
-    flow_factor.update_label(fmt::format("{}%",
-      static_cast<int>(v.template get<double>() * 100)).c_str());
-  }
-}
-
 void FineTunePanel::handle_callback(lv_event_t *e) {
   spdlog::trace("fine tune btn callback");
   if (lv_event_get_code(e) == LV_EVENT_VALUE_CHANGED) {
@@ -21,7 +21,6 @@ class FineTunePanel : public NotifyConsumer {
   void handle_speed(lv_event_t *event);
   void handle_flow(lv_event_t *event);
 
-  void consume(json &j);  
   
   static void _handle_callback(lv_event_t *event) {
     FineTunePanel *panel = (FineTunePanel*)event->user_data;
@@ -16,6 +16,14 @@
 #include "spdlog/spdlog.h"
 #include "state.h"
 #include "theme.h"
+#include "ui_reactor.h"
+#include "fb_flip.h"
+#include "drm_display.h"
+#include "asset_store.h"
+#include "image_cache.h"
+#include "thumbnail_loader.h"
+
+#include <algorithm>
 
 GuppyScreen *GuppyScreen::instance = NULL;
 lv_style_t GuppyScreen::style_container;
@@ -31,6 +39,12 @@ lv_obj_t *GuppyScreen::screen_saver = NULL;
 KWebSocketClient GuppyScreen::ws(NULL);
 
 std::mutex GuppyScreen::lv_lock;
+std::atomic<int32_t> GuppyScreen::display_sleep_ms(0);
+std::atomic<uint32_t> GuppyScreen::idle_refresh_ms(0);
+std::atomic_bool GuppyScreen::sleeping(false);
+
+// how long after the last touch the display keeps refreshing at full rate
+static const uint32_t REFRESH_ACTIVE_HOLD_MS = 1000;
 
 GuppyScreen::GuppyScreen()
   : spoolman_panel(ws, lv_lock)
@@ -102,14 +116,57 @@ GuppyScreen *GuppyScreen::init(std::function<void(lv_color_t, lv_color_t)> hal_i
   lv_init();
 
 #if !defined(SIMULATOR) && !defined(OS_ANDROID)
+  UiReactor *reactor = UiReactor::get_instance();
+#ifdef GUPPY_DRM
+  DrmDisplay *drm = DrmDisplay::get_instance();
+  auto backend = conf->get_json("/display_backend");
+  auto drm_device = conf->get_json("/drm_device");
+  if (backend.is_string() && backend.template get<std::string>() == "drm"
+      && drm->init(drm_device.is_string()
+		   ? drm_device.template get<std::string>().c_str()
+		   : "/dev/dri/card0")) {
+    // flip events that arrive while the main loop sleeps
+    reactor->watch(drm->get_fd(), [drm]() { drm->handle_events(); });
+  } else
+#endif
+  {
   /*Linux frame buffer device init*/
   fbdev_init();
   fbdev_unblank();
+  }
+  reactor->watch_input(EVDEV_NAME);
 #endif  // OS_ANDROID
 
   hal_init(primary_color, secondary_color);
   lv_png_init();
 
+  // decoded icons, thumbnails and png files
+  auto image_cache_kb = conf->get_json("/image_cache_kb");
+  ImageCache::get_instance()->init(image_cache_kb.is_number_unsigned()
+				   ? image_cache_kb.template get<size_t>() * 1024
+				   : IMAGE_CACHE_DEFAULT);
+
+  // packed icons, decoded on first use
+  AssetStore *assets = AssetStore::get_instance();
+  assets->init();
+
+  auto icon_size = conf->get_json("/icon_size");
+  auto icon_cache = conf->get_json("/icon_cache_path");
+  assets->set_icon_size(icon_size.is_number_unsigned()
+			? icon_size.template get<uint32_t>()
+			: AssetStore::auto_icon_size(),
+			icon_cache.is_string()
+			? icon_cache.template get<std::string>()
+			: (fs::path(conf->get_path()).parent_path() / "icon_cache").string());
+
+  // gcode thumbnails are fetched and decoded off this thread
+  auto thumb_cache_kb = conf->get_json("/thumbnail_cache_kb");
+  ThumbnailLoader::get_instance()->start(lv_lock,
+					 (fs::path(conf->get<std::string>("/thumbnail_path")) / "scaled").string(),
+					 thumb_cache_kb.is_number_unsigned()
+					 ? thumb_cache_kb.template get<size_t>() * 1024
+					 : THUMBNAIL_CACHE_DEFAULT);
+
   lv_style_init(&style_container);
   lv_style_set_border_width(&style_container, 0);
   lv_style_set_radius(&style_container, 0);
@@ -139,6 +196,19 @@ GuppyScreen *GuppyScreen::init(std::function<void(lv_color_t, lv_color_t)> hal_i
   lv_disp_set_theme(NULL, &th_new);
 
   ws.register_notify_update(State::get_instance());
+  ws.on_status_ready([]() {
+    // picked up on wake while the display sleeps
+    if (!sleeping) {
+      UiReactor::get_instance()->wakeup();
+    }
+  });
+
+  auto display_sleep = conf->get_json("/display_sleep_sec");
+  set_display_sleep(display_sleep.is_number() ? display_sleep.template get<int32_t>() : 0);
+  auto idle_refresh = conf->get_json("/idle_refresh_ms");
+  set_idle_refresh(idle_refresh.is_number_unsigned()
+		   ? idle_refresh.template get<uint32_t>()
+		   : IDLE_REFRESH_DEFAULT_MS);
 
   GuppyScreen *gs = GuppyScreen::get();
   auto printers = conf->get_json("/printers");
@@ -190,42 +260,165 @@ GuppyScreen *GuppyScreen::init(std::function<void(lv_color_t, lv_color_t)> hal_i
 
 void GuppyScreen::loop() {
   /*Handle LitlevGL tasks (tickless mode)*/
-#if !defined(SIMULATOR) && !defined(OS_ANDROID)
-  std::atomic_bool is_sleeping(false);
-  Config *conf = Config::get_instance();
-#endif
+  UiReactor *reactor = UiReactor::get_instance();
+  bool input = false;
 
   while (1) {
+#if !defined(SIMULATOR) && !defined(OS_ANDROID)
+    if (sleeping && reactor->has_input()) {
+      // blanked: no timers and no widget updates, only a touch wakes us.
+      // status updates keep landing in State and the status queue, which
+      // holds the latest value per field for the refresh on wake.
+      if (!reactor->wait(UINT32_MAX) && display_sleep_ms > 0) {
+        continue;
+      }
+
+      lv_lock.lock();
+      lv_disp_trig_activity(NULL);
+      wake_display();
+      // the touch only wakes the screen. LVGL ignores it until it's
+      // released, so it can't land on whatever is under the screen saver
+      // (e-stop, pause, cancel).
+      for (lv_indev_t *indev = lv_indev_get_next(NULL); indev != NULL; indev = lv_indev_get_next(indev)) {
+        if (indev->driver->type == LV_INDEV_TYPE_POINTER) {
+          lv_indev_wait_release(indev);
+        }
+      }
+      lv_lock.unlock();
+      input = true;
+    }
+#endif  // SIMULATOR/OS_ANDROID
+
     lv_lock.lock();
-    lv_timer_handler();
-    lv_lock.unlock();
+    if (input) {
+      // read the touch right away instead of on the next read period
+      for (lv_indev_t *indev = lv_indev_get_next(NULL); indev != NULL; indev = lv_indev_get_next(indev)) {
+        lv_timer_resume(indev->driver->read_timer);
+        lv_timer_ready(indev->driver->read_timer);
+      }
+    }
+
+    if (!sleeping) {
+      ws.process_status_updates();
+    }
+    update_refresh_period(input);
+    uint32_t idle_ms = lv_timer_handler();
+
+    if (reactor->has_input()) {
+      // nothing to poll for while the pointer is up, the next touch wakes us.
+      // scroll momentum, snapping and LV_EVENT_SCROLL_END run from the read
+      // timer after release, so it keeps going until the scroll settles.
+      for (lv_indev_t *indev = lv_indev_get_next(NULL); indev != NULL; indev = lv_indev_get_next(indev)) {
+        if (indev->driver->type == LV_INDEV_TYPE_POINTER
+            && indev->proc.state == LV_INDEV_STATE_RELEASED
+            && indev->proc.types.pointer.scroll_obj == NULL
+            && indev->proc.types.pointer.scroll_throw_vect.x == 0
+            && indev->proc.types.pointer.scroll_throw_vect.y == 0) {
+          lv_timer_pause(indev->driver->read_timer);
+        }
+      }
+    }
 
   #if !defined(SIMULATOR) && !defined(OS_ANDROID)
-    int32_t display_sleep = conf->get<int32_t>("/display_sleep_sec") * 1000;
-    if (display_sleep != -1) {
-      if (lv_disp_get_inactive_time(NULL) > display_sleep) {
-        if (!is_sleeping.load()) {
-          spdlog::debug("putting display to sleeping");
-          fbdev_blank();
-          lv_obj_move_foreground(screen_saver);
-          // spdlog::debug("screen saver foreground");
-          is_sleeping = true;
+    if (display_sleep_ms > 0) {
+      uint32_t inactive = lv_disp_get_inactive_time(NULL);
+      if (inactive > (uint32_t)display_sleep_ms) {
+        if (!sleeping) {
+          sleep_display();
         }
       } else {
-        if (is_sleeping.load()) {
-          spdlog::debug("waking up display");
-          fbdev_unblank();
-          lv_obj_move_background(screen_saver);
-          is_sleeping = false;
+        if (sleeping) {
+          wake_display();
         }
+
+        // wake up in time to blank the display
+        idle_ms = std::min<uint32_t>(idle_ms, display_sleep_ms - inactive + 1);
       }
+    } else if (sleeping) {
+      wake_display();
     }
 #endif  // SIMULATOR/OS_ANDROID
+    lv_lock.unlock();
 
-    usleep(10000);
+    input = reactor->wait(idle_ms);
   }
 }
 
+#if !defined(SIMULATOR) && !defined(OS_ANDROID)
+// lv_lock held
+void GuppyScreen::sleep_display() {
+  spdlog::debug("putting display to sleeping");
+#ifdef GUPPY_DRM
+  if (DrmDisplay::get_instance()->is_enabled()) {
+    DrmDisplay::get_instance()->blank();
+  } else
+#endif
+  fbdev_blank();
+  lv_obj_move_foreground(screen_saver);
+
+  lv_disp_t *disp = lv_disp_get_default();
+  if (disp != NULL && disp->refr_timer != NULL) {
+    lv_timer_pause(disp->refr_timer);
+  }
+  sleeping = true;
+}
+
+// lv_lock held
+void GuppyScreen::wake_display() {
+  spdlog::debug("waking up display");
+  sleeping = false;
+#ifdef GUPPY_DRM
+  if (DrmDisplay::get_instance()->is_enabled()) {
+    DrmDisplay::get_instance()->unblank();
+  } else
+#endif
+  {
+  fbdev_unblank();
+  FbFlip::get_instance()->restore();
+  }
+  lv_obj_move_background(screen_saver);
+
+  // everything that changed while asleep goes out in one refresh
+  lv_disp_t *disp = lv_disp_get_default();
+  if (disp != NULL && disp->refr_timer != NULL) {
+    lv_obj_invalidate(lv_scr_act());
+    lv_timer_resume(disp->refr_timer);
+    lv_timer_ready(disp->refr_timer);
+  }
+}
+#endif  // SIMULATOR/OS_ANDROID
+
+// full rate while the screen is touched or animating, telemetry alone
+// refreshes at the idle rate
+void GuppyScreen::update_refresh_period(bool input) {
+  lv_disp_t *disp = lv_disp_get_default();
+  if (disp == NULL || disp->refr_timer == NULL) {
+    return;
+  }
+
+  uint32_t period = LV_DISP_DEF_REFR_PERIOD;
+  uint32_t idle = idle_refresh_ms;
+  if (idle > period
+      && !input
+      && lv_anim_count_running() == 0
+      && lv_disp_get_inactive_time(disp) > REFRESH_ACTIVE_HOLD_MS) {
+    period = idle;
+  }
+
+  if (disp->refr_timer->period != period) {
+    lv_timer_set_period(disp->refr_timer, period);
+  }
+}
+
+void GuppyScreen::set_idle_refresh(uint32_t ms) {
+  idle_refresh_ms = ms;
+}
+
+void GuppyScreen::set_display_sleep(int32_t sec) {
+  display_sleep_ms = sec > 0 ? sec * 1000 : 0;
+  UiReactor::get_instance()->wakeup();
+}
+
 std::mutex &GuppyScreen::get_lock() {
     return lv_lock;
 }
@@ -2,6 +2,7 @@
 #define __GUPPY_SCREEN_H__
 
 #include <mutex>
+#include <atomic>
 #include <functional>
 
 #include "lv_tc.h"
@@ -14,8 +15,17 @@
 #include "spoolman_panel.h"
 #include "websocket_client.h"
 
+// idle refresh period when the config doesn't set idle_refresh_ms
+#define IDLE_REFRESH_DEFAULT_MS 250
+
 class GuppyScreen {
  private:
+  static void update_refresh_period(bool input);
+#ifndef OS_ANDROID
+  static void sleep_display();
+  static void wake_display();
+#endif
+
   static GuppyScreen *instance;
   static lv_style_t style_container;
   static lv_style_t style_imgbtn_default;
@@ -27,6 +37,12 @@ class GuppyScreen {
 #endif
   static std::mutex lv_lock;
   static KWebSocketClient ws;
+  // 0 when the display never sleeps
+  static std::atomic<int32_t> display_sleep_ms;
+  // refresh period once touch and animations have settled, 0 for full rate
+  static std::atomic<uint32_t> idle_refresh_ms;
+  // display blanked, rendering and widget updates suspended
+  static std::atomic_bool sleeping;
 
   SpoolmanPanel spoolman_panel;
   MainPanel main_panel;
@@ -43,6 +59,8 @@ class GuppyScreen {
   static GuppyScreen *get();
   static GuppyScreen *init(std::function<void(lv_color_t, lv_color_t)> hal_init);
   static void loop();
+  static void set_display_sleep(int32_t sec);
+  static void set_idle_refresh(uint32_t ms);
   static void new_theme_apply_cb(lv_theme_t *th, lv_obj_t *obj);
   static void handle_calibrated(lv_event_t *event);
   static void save_calibration_coeff(lv_tc_coeff_t coeff);
@@ -2,6 +2,7 @@
 #include "state.h"
 #include "spdlog/spdlog.h"
 #include "config.h"
+#include "utils.h"
 
 static const float distances[] = {0.1, 0.5, 1, 5, 10, 25, 50};
 
@@ -32,7 +33,7 @@ HomingPanel::HomingPanel(KWebSocketClient &websocket_client, std::mutex &lock)
     "Do you want to emergency stop?",
     [&websocket_client]() {
       spdlog::debug("emergency stop pressed");
-      websocket_client.send_jsonrpc("printer.emergency_stop");
+      websocket_client.send_priority("printer.emergency_stop", KUtils::input_age_ms());
     })
   , motoroff_btn(homing_cont, &motor_off_img, "Motor Off", &HomingPanel::_handle_callback, this)
   , back_btn(homing_cont, &back, "Back", &HomingPanel::_handle_callback, this)
@@ -70,39 +71,43 @@ HomingPanel::HomingPanel(KWebSocketClient &websocket_client, std::mutex &lock)
   lv_obj_add_flag(back_btn.get_container(), LV_OBJ_FLAG_FLOATING);
   lv_obj_align(back_btn.get_container(), LV_ALIGN_BOTTOM_RIGHT, 10, 0);
 
-  ws.register_notify_update(this);
+  ws.register_status_update(this, "toolhead", "homed_axes", [this](const json &v) {
+    update_homed_axes(v.template get<std::string>());
+  });
+
+  // read back from State when jogging
+  ws.register_status_update(this, "toolhead", "position", nullptr);
+  ws.register_status_update(this, "toolhead", "axis_minimum", nullptr);
+  ws.register_status_update(this, "toolhead", "axis_maximum", nullptr);
 }
 
-HomingPanel::~HomingPanel() { }
+HomingPanel::~HomingPanel() {
+  ws.unregister_status_update(this);
+}
 
-void HomingPanel::consume(json &j) {
-  auto v = j["/params/0/toolhead/homed_axes"_json_pointer];
-  if (!v.is_null()) {
-    std::string homed_axes = v.template get<std::string>();
-    std::lock_guard<std::mutex> lock(lv_lock);
-    if (homed_axes.find("x") != std::string::npos) {
-      x_up_btn.enable();
-      x_down_btn.enable();
-    } else {
-      x_up_btn.disable();
-      x_down_btn.disable();
-    }
+void HomingPanel::update_homed_axes(const std::string &homed_axes) {
+  if (homed_axes.find("x") != std::string::npos) {
+    x_up_btn.enable();
+    x_down_btn.enable();
+  } else {
+    x_up_btn.disable();
+    x_down_btn.disable();
+  }
 
-    if (homed_axes.find("y") != std::string::npos) {
-      y_up_btn.enable();
-      y_down_btn.enable();
-    } else {
-      y_up_btn.disable();
-      y_down_btn.disable();
-    }
+  if (homed_axes.find("y") != std::string::npos) {
+    y_up_btn.enable();
+    y_down_btn.enable();
+  } else {
+    y_up_btn.disable();
+    y_down_btn.disable();
+  }
 
-    if (homed_axes.find("z") != std::string::npos) {
-      z_up_btn.enable();
-      z_down_btn.enable();
-    } else {
-      z_up_btn.disable();
-      z_down_btn.disable();
-    }
+  if (homed_axes.find("z") != std::string::npos) {
+    z_up_btn.enable();
+    z_down_btn.enable();
+  } else {
+    z_up_btn.disable();
+    z_down_btn.disable();
   }
 }
 
@@ -159,7 +164,7 @@ void HomingPanel::handle_callback(lv_event_t *event) {
     ws.gcode_script("G28 X Y");
   } else if (btn == emergency_btn.get_container()) {
     spdlog::debug("emergency stop pressed");
-    ws.send_jsonrpc("printer.emergency_stop");
+    ws.send_priority("printer.emergency_stop", KUtils::input_age_ms());
   } else if (btn == motoroff_btn.get_container()) {
     spdlog::debug("motor off pressed");
     ws.gcode_script("M84");
@@ -14,7 +14,7 @@ public:
   HomingPanel(KWebSocketClient &ws, std::mutex &);
   ~HomingPanel();
 
-  void consume(json &data);
+  void update_homed_axes(const std::string &homed_axes);
   lv_obj_t *get_container();
   void foreground();
   void handle_callback(lv_event_t *event);
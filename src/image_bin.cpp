@@ -0,0 +1,49 @@
+#include "image_bin.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+uint32_t ImageBin::hash(const void *data, size_t len) {
+  const uint8_t *p = (const uint8_t *)data;
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < len; i++) {
+    h = (h ^ p[i]) * 16777619u;
+  }
+  return h;
+}
+
+void ImageBin::unpremultiply(const float *rgba, size_t n, uint8_t *out) {
+  for (size_t i = 0; i < n; i++) {
+    const float *s = &rgba[i * 4];
+    uint8_t rgb[3] = {0, 0, 0};
+    if (s[3] > 0) {
+      for (int c = 0; c < 3; c++) {
+	rgb[c] = (uint8_t)std::min(255.0f, s[c] / s[3] + 0.5f);
+      }
+    }
+
+    lv_color_t color = lv_color_make(rgb[0], rgb[1], rgb[2]);
+    uint8_t *d = out + i * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    memcpy(d, &color, sizeof(lv_color_t));
+    d[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = (uint8_t)std::min(255.0f, s[3] * 255 + 0.5f);
+  }
+}
+
+bool ImageBin::save(const std::string &path, const lv_img_header_t &header,
+		    const uint8_t *data, size_t size) {
+  std::string tmp = path + ".tmp";
+  FILE *f = fopen(tmp.c_str(), "wb");
+  if (f == NULL) {
+    return false;
+  }
+
+  bool ok = fwrite(&header, sizeof(header), 1, f) == 1
+    && fwrite(data, 1, size, f) == size;
+  ok = fclose(f) == 0 && ok;
+  if (!ok || rename(tmp.c_str(), path.c_str()) != 0) {
+    remove(tmp.c_str());
+    return false;
+  }
+  return true;
+}
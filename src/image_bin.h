@@ -0,0 +1,30 @@
+#ifndef __IMAGE_BIN_H__
+#define __IMAGE_BIN_H__
+
+#include "lvgl/lvgl.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// lv_img_header_t has 11 bits for each dimension
+#define IMAGE_BIN_MAX_SIZE 2047
+
+// The LV_IMG_CF_TRUE_COLOR_ALPHA rasters rendered here rather than decoded
+// from a file (rasterized icons, scaled thumbnails), and their caches on
+// disk in LVGL's .bin layout.
+namespace ImageBin {
+  // fnv-1a, for naming cache files
+  uint32_t hash(const void *data, size_t len);
+
+  // n premultiplied float pixels (r g b 0-255, a 0-1) to
+  // LV_IMG_CF_TRUE_COLOR_ALPHA at the build's color depth
+  void unpremultiply(const float *rgba, size_t n, uint8_t *out);
+
+  // header then size bytes of pixels. written aside and renamed, a crash
+  // never leaves half a file behind
+  bool save(const std::string &path, const lv_img_header_t &header,
+	    const uint8_t *data, size_t size);
+}
+
+#endif // __IMAGE_BIN_H__
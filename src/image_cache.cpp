@@ -0,0 +1,258 @@
+#include "image_cache.h"
+#include "image_bin.h"
+#include "lvgl/src/extra/libs/png/lodepng.h"
+#include "spdlog/spdlog.h"
+
+#include <cstdio>
+#include <cstring>
+#include <strings.h>
+#include <sys/stat.h>
+#include <vector>
+
+ImageCache *ImageCache::instance = NULL;
+
+// the file behind an LVGL path on the stdio drive, empty for other drives
+static std::string file_path(const char *src) {
+#if LV_USE_FS_STDIO
+  if (src[0] == LV_FS_STDIO_LETTER && src[1] == ':') {
+    return std::string(LV_FS_STDIO_PATH) + (src + 2);
+  }
+#endif
+  return "";
+}
+
+static bool is_png(const std::string &path) {
+  return path.size() > 4 && strcasecmp(path.c_str() + path.size() - 4, ".png") == 0;
+}
+
+ImageCache::ImageCache()
+  : budget(0)
+  , used(0)
+  , hits(0)
+  , misses(0)
+  , evictions(0)
+{
+}
+
+ImageCache::~ImageCache() {
+  for (auto &e : entries) {
+    lv_mem_free(e.second.data);
+  }
+}
+
+ImageCache *ImageCache::get_instance() {
+  if (instance == NULL) {
+    instance = new ImageCache();
+  }
+  return instance;
+}
+
+void ImageCache::init(size_t b) {
+  {
+    std::lock_guard<std::mutex> l(lock);
+    budget = b;
+  }
+
+  // created after lv_png's, so tried before it
+  lv_img_decoder_t *dec = lv_img_decoder_create();
+  lv_img_decoder_set_info_cb(dec, info_cb);
+  lv_img_decoder_set_open_cb(dec, open_cb);
+  lv_img_decoder_set_close_cb(dec, close_cb);
+
+  spdlog::debug("image cache budget {} KB", budget / 1024);
+}
+
+const uint8_t *ImageCache::acquire(const std::string &key) {
+  std::lock_guard<std::mutex> l(lock);
+  auto it = entries.find(key);
+  if (it == entries.end()) {
+    misses++;
+    return NULL;
+  }
+
+  Entry &e = it->second;
+  lru.splice(lru.begin(), lru, e.lru);
+  e.refs++;
+  hits++;
+  return e.data;
+}
+
+const uint8_t *ImageCache::insert(const std::string &key, uint8_t *data, size_t size) {
+  std::lock_guard<std::mutex> l(lock);
+  auto it = entries.find(key);
+  if (it != entries.end()) {
+    // decoded twice, keep the one others may hold already
+    lv_mem_free(data);
+    Entry &e = it->second;
+    lru.splice(lru.begin(), lru, e.lru);
+    e.refs++;
+    return e.data;
+  }
+
+  lru.push_front(key);
+  entries[key] = Entry{data, size, 1, lru.begin()};
+  used += size;
+  evict();
+  return data;
+}
+
+void ImageCache::release(const std::string &key) {
+  std::lock_guard<std::mutex> l(lock);
+  auto it = entries.find(key);
+  if (it != entries.end() && it->second.refs > 0) {
+    it->second.refs--;
+    evict();
+  }
+}
+
+void ImageCache::pin(const std::string &key) {
+  std::lock_guard<std::mutex> l(lock);
+  pins[key]++;
+}
+
+void ImageCache::unpin(const std::string &key) {
+  std::lock_guard<std::mutex> l(lock);
+  auto it = pins.find(key);
+  if (it != pins.end() && --it->second == 0) {
+    pins.erase(it);
+    evict();
+  }
+}
+
+ImageCache::Stats ImageCache::get_stats() {
+  std::lock_guard<std::mutex> l(lock);
+  size_t pinned = 0;
+  for (auto &p : pins) {
+    auto e = entries.find(p.first);
+    if (e != entries.end()) {
+      pinned += e->second.size;
+    }
+  }
+  return Stats{hits, misses, evictions, used, budget, pinned, entries.size()};
+}
+
+// drops the least recently used images nobody holds until within budget
+void ImageCache::evict() {
+  auto it = lru.end();
+  while (used > budget && it != lru.begin()) {
+    --it;
+    auto e = entries.find(*it);
+    if (e->second.refs > 0 || pins.count(*it) > 0) {
+      continue;
+    }
+
+    spdlog::trace("image cache: evicting {}, {} bytes", *it, e->second.size);
+    used -= e->second.size;
+    evictions++;
+    lv_mem_free(e->second.data);
+    entries.erase(e);
+    it = lru.erase(it);
+  }
+}
+
+lv_res_t ImageCache::info_cb(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header) {
+  LV_UNUSED(decoder);
+  if (lv_img_src_get_type(src) != LV_IMG_SRC_FILE) {
+    return LV_RES_INV;
+  }
+
+  std::string path = file_path((const char *)src);
+  if (!is_png(path)) {
+    return LV_RES_INV;
+  }
+
+  // signature, IHDR length and type, then big endian width and height
+  uint8_t ihdr[24];
+  FILE *f = fopen(path.c_str(), "rb");
+  if (f == NULL) {
+    return LV_RES_INV;
+  }
+  bool ok = fread(ihdr, 1, sizeof(ihdr), f) == sizeof(ihdr)
+    && memcmp(ihdr + 12, "IHDR", 4) == 0;
+  fclose(f);
+  if (!ok) {
+    return LV_RES_INV;
+  }
+
+  uint32_t w = (ihdr[16] << 24) | (ihdr[17] << 16) | (ihdr[18] << 8) | ihdr[19];
+  uint32_t h = (ihdr[20] << 24) | (ihdr[21] << 16) | (ihdr[22] << 8) | ihdr[23];
+  if (w == 0 || h == 0 || w > IMAGE_BIN_MAX_SIZE || h > IMAGE_BIN_MAX_SIZE) {
+    return LV_RES_INV;
+  }
+
+  header->w = w;
+  header->h = h;
+  header->always_zero = 0;
+  header->cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+  return LV_RES_OK;
+}
+
+lv_res_t ImageCache::open_cb(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {
+  LV_UNUSED(decoder);
+  if (dsc->src_type != LV_IMG_SRC_FILE) {
+    return LV_RES_INV;
+  }
+
+  // a file written again (a new resonance graph) is a new image
+  std::string path = file_path((const char *)dsc->src);
+  struct stat st;
+  if (!is_png(path) || stat(path.c_str(), &st) != 0) {
+    return LV_RES_INV;
+  }
+  std::string key = fmt::format("png:{}:{}:{}", path, (int64_t)st.st_mtime, (int64_t)st.st_size);
+
+  const uint8_t *data = instance->acquire(key);
+  if (data == NULL) {
+    FILE *f = fopen(path.c_str(), "rb");
+    if (f == NULL) {
+      return LV_RES_INV;
+    }
+    std::vector<uint8_t> png(st.st_size);
+    bool ok = fread(png.data(), 1, png.size(), f) == png.size();
+    fclose(f);
+
+    unsigned char *rgba = NULL;
+    unsigned w = 0;
+    unsigned h = 0;
+    if (!ok || lodepng_decode32(&rgba, &w, &h, png.data(), png.size()) != 0
+        || w != dsc->header.w || h != dsc->header.h) {
+      spdlog::warn("image cache: failed to decode {}", path);
+      lv_mem_free(rgba);
+      return LV_RES_INV;
+    }
+
+    // what LVGL's png decoder would have made of it
+    size_t px = (size_t)w * h;
+    uint8_t *out = (uint8_t *)lv_mem_alloc(px * LV_IMG_PX_SIZE_ALPHA_BYTE);
+    if (out == NULL) {
+      lv_mem_free(rgba);
+      return LV_RES_INV;
+    }
+    for (size_t i = 0; i < px; i++) {
+      const uint8_t *s = rgba + i * 4;
+      lv_color_t color = lv_color_make(s[0], s[1], s[2]);
+      uint8_t *d = out + i * LV_IMG_PX_SIZE_ALPHA_BYTE;
+      memcpy(d, &color, sizeof(lv_color_t));
+      d[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = s[3];
+    }
+    lv_mem_free(rgba);
+
+    spdlog::debug("image cache: decoded {} {}x{}", path, w, h);
+    data = instance->insert(key, out, px * LV_IMG_PX_SIZE_ALPHA_BYTE);
+  }
+
+  dsc->img_data = data;
+  dsc->user_data = new std::string(key);
+  return LV_RES_OK;
+}
+
+void ImageCache::close_cb(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {
+  LV_UNUSED(decoder);
+  std::string *key = (std::string *)dsc->user_data;
+  if (key != NULL) {
+    instance->release(*key);
+    delete key;
+    dsc->user_data = NULL;
+    dsc->img_data = NULL;
+  }
+}
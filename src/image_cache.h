@@ -0,0 +1,102 @@
+#ifndef __IMAGE_CACHE_H__
+#define __IMAGE_CACHE_H__
+
+#include "lvgl/lvgl.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// enough for every icon of a 64px theme, a few thumbnails and a resonance
+// graph
+#define IMAGE_CACHE_DEFAULT (4 * 1024 * 1024)
+
+// Decoded images shared by every panel, within a budget in bytes rather
+// than LVGL's image cache's count of entries, so one large PNG doesn't push
+// out everything else.
+//
+// Buffers are reference counted: whoever shows one holds a reference, and
+// widgets showing the same image share the buffer. Images nobody holds
+// stay cached until the budget is needed, least recently used first.
+// Pinned images are never evicted, nor are ones still referenced; the
+// budget may be exceeded while they are.
+//
+// Packed icons (AssetStore) and gcode thumbnails (ThumbnailLoader) live
+// here, and a decoder in front of LVGL's keeps PNG files (the resonance and
+// belt graphs) here too.
+//
+// Thread safe, ThumbnailLoader fills it from its worker.
+class ImageCache {
+ private:
+  static ImageCache *instance;
+  ImageCache();
+
+ public:
+  ImageCache(ImageCache &o) = delete;
+  void operator=(const ImageCache &) = delete;
+  ~ImageCache();
+
+  static ImageCache *get_instance();
+
+  struct Stats {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    size_t used;
+    size_t budget;
+    size_t pinned;
+    size_t entries;
+  };
+
+  // registers the PNG file decoder
+  void init(size_t budget);
+
+  // a reference to key's buffer, NULL if it isn't cached
+  const uint8_t *acquire(const std::string &key);
+
+  // caches data (from lv_mem_alloc, owned by the cache from now on) as key
+  // and returns a reference to it. If key is already cached, data is freed
+  // and the cached buffer returned.
+  const uint8_t *insert(const std::string &key, uint8_t *data, size_t size);
+
+  void release(const std::string &key);
+
+  // keeps key cached, whether or not anyone holds it, until unpinned. Pins
+  // on keys not cached yet apply once they are.
+  void pin(const std::string &key);
+  void unpin(const std::string &key);
+
+  Stats get_stats();
+
+ private:
+  struct Entry {
+    uint8_t *data;
+    size_t size;
+    uint32_t refs;
+    std::list<std::string>::iterator lru;
+  };
+
+  // lock held
+  void evict();
+
+  static lv_res_t info_cb(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header);
+  static lv_res_t open_cb(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc);
+  static void close_cb(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc);
+
+  std::mutex lock;
+  size_t budget;
+  size_t used;
+  uint64_t hits;
+  uint64_t misses;
+  uint64_t evictions;
+  std::unordered_map<std::string, Entry> entries;
+  // pin counts
+  std::unordered_map<std::string, uint32_t> pins;
+  // most recently used first
+  std::list<std::string> lru;
+};
+
+#endif // __IMAGE_CACHE_H__
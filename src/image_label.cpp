@@ -1,4 +1,5 @@
 #include "image_label.h"
+#include "asset_store.h"
 #include <cstring>
 #include <cstdio>
 
@@ -47,7 +48,9 @@ ImageLabel::ImageLabel(lv_obj_t *parent,
 		       const char *v)
   : ImageLabel(parent, img, width_pct, height_pct, v)
 {
-  auto wscale = lv_disp_get_physical_hor_res(NULL) / 800.0;
+  // icons rasterized at the screen's size are already part of the way there
+  auto wscale = lv_disp_get_physical_hor_res(NULL) / 800.0
+    / AssetStore::get_instance()->icon_scale(img);
   lv_img_set_size_mode(image, LV_IMG_SIZE_MODE_REAL);
   lv_img_set_zoom(image, img_scale * wscale);
 }
@@ -93,34 +93,26 @@ void InitPanel::connected(KWebSocketClient &ws) {
 	auto display_leds = state->get_display_leds();
 	this->main_panel.create_leds(display_leds);
 
-	// subscribe to all objects except gcode_macro
+	// configfile is static and large, query it once. everything else is
+	// subscribed to as far as the panels registered for it.
 	auto objs = d["/result/objects"_json_pointer];
 	if (!objs.is_null()) {
-	  json sub_objs;
-	  for (auto &obj : objs) {
-	    std::string obj_name = obj.template get<std::string>();
-	    if (obj_name.rfind("gcode_macro ", 0 ) != 0) {
-	      sub_objs[obj_name] = nullptr;
-	    }
-	  }
-
-	  sub_objs["tmcstatus"] = nullptr;
-
-	  json subs = {{ "objects", sub_objs }};
-	  spdlog::debug("subcribing to {}", subs.dump());
-	  ws.send_jsonrpc("printer.objects.subscribe", subs,
-			  [this](json &data) {
-			    State::get_instance()->set_data("printer_state",
-							    data, "/result/status");
-			    this->main_panel.init(data);
-			    this->bedmesh_panel.refresh_views_with_lock(
-									data["/result/status/bed_mesh"_json_pointer]);
-			    spdlog::debug("done init");
-			    std::lock_guard<std::mutex> lock(this->lv_lock);
-			    lv_obj_add_flag(this->cont, LV_OBJ_FLAG_HIDDEN);
-			    lv_obj_move_background(this->cont);
-					
-			  });
+	  json query = {{ "objects", {{ "configfile", json::array({ "config", "settings" }) }} }};
+	  ws.send_jsonrpc("printer.objects.query", query, [this, &ws](json &j) {
+	    State::get_instance()->set_data("printer_state", j, "/result/status");
+
+	    ws.subscribe_status([this](json &data) {
+	      State::get_instance()->set_data("printer_state",
+					      data, "/result/status");
+	      this->main_panel.init(data);
+	      this->bedmesh_panel.refresh_views_with_lock(
+						  data["/result/status/bed_mesh"_json_pointer]);
+	      spdlog::debug("done init");
+	      std::lock_guard<std::mutex> lock(this->lv_lock);
+	      lv_obj_add_flag(this->cont, LV_OBJ_FLAG_HIDDEN);
+	      lv_obj_move_background(this->cont);
+	    });
+	  });
 	}
   });
 
@@ -71,7 +71,7 @@ InputShaperPanel::InputShaperPanel(KWebSocketClient &c, std::mutex &l)
     "Do you want to emergency stop?",
     [&c]() {
       spdlog::debug("emergency stop pressed");
-      c.send_jsonrpc("printer.emergency_stop");
+      c.send_priority("printer.emergency_stop", KUtils::input_age_ms());
     })
   , back_btn(cont, &back, "Back", &InputShaperPanel::_handle_callback, this)
   , ximage_fullsized(false)
@@ -254,8 +254,13 @@ InputShaperPanel::~InputShaperPanel() {
 }
 
 void InputShaperPanel::foreground() {
-  auto inputshaper = State::get_instance()
-    ->get_data("/printer_state/configfile/config/input_shaper"_json_pointer);
+  State *s = State::get_instance();
+  static const StateKey config_key = s->key("configfile", "config");
+  auto config = s->get_value(config_key);
+  json inputshaper;
+  if (config && config->contains("input_shaper")) {
+    inputshaper = config->at("input_shaper");
+  }
   spdlog::trace("input shapper {}", inputshaper.dump());
 
   if (!inputshaper.is_null()) {
@@ -351,7 +356,7 @@ void InputShaperPanel::handle_callback(lv_event_t *event) {
   } else if (btn == back_btn.get_container()) {
     lv_obj_move_background(cont);
   } else if (btn == emergency_btn.get_container()) {
-    ws.send_jsonrpc("printer.emergency_stop");
+    ws.send_priority("printer.emergency_stop", KUtils::input_age_ms());
   }
 }
 
@@ -25,8 +25,6 @@ LedPanel::LedPanel(KWebSocketClient &websocket_client, std::mutex &lock)
     lv_obj_set_flex_align(leds_cont, LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
 
     lv_obj_align(back_btn.get_container(), LV_ALIGN_BOTTOM_RIGHT, 0, -20);
-
-    ws.register_notify_update(this);
 }
 
 LedPanel::~LedPanel() {
@@ -37,34 +35,13 @@ LedPanel::~LedPanel() {
 
   leds.clear();
 
-  ws.unregister_notify_update(this);
-}
-
-void LedPanel::consume(json &j) {
-  std::lock_guard<std::mutex> lock(lv_lock);
-  for (auto &l : leds) {
-    // hack for output_pin leds
-    auto value = j[json::json_pointer(fmt::format("/params/0/{}/value", l.first))];
-    if (!value.is_null()) {
-      int v = static_cast<int>(value.template get<double>() * 100);
-      l.second->update_value(v);
-    }
-
-    value = j[json::json_pointer(fmt::format("/params/0/{}/color_data", l.first))];
-    if (!value.is_null() && value.size() > 0) {
-      // color_data = [[r,b,g,w]]
-      value =  value.at(0);
-      if (value.size() == 4) {
-	int v = static_cast<int>(value.at(3).template get<double>() * 100);
-	l.second->update_value(v);
-      }
-    }
-  }
+  ws.unregister_status_update(this);
 }
 
 void LedPanel::init(json &l) {
   std::lock_guard<std::mutex> lock(lv_lock);
   leds.clear();
+  ws.unregister_status_update(this);
   for (auto &led : l.items()) {
     std::string key = led.key();
     spdlog::trace("create led {}, {}", l.dump(), led.value().dump());
@@ -79,6 +56,18 @@ void LedPanel::init(json &l) {
     auto lptr = std::make_shared<SliderContainer>(leds_cont, display_name.c_str(), &cancel, "Off",
 						  &light_img, "Max", led_cb, this);
     leds.insert({key, lptr});
+
+    // hack for output_pin leds
+    ws.register_status_update(this, key, "value", [lptr](const json &v) {
+      lptr->update_value(static_cast<int>(v.template get<double>() * 100));
+    });
+
+    ws.register_status_update(this, key, "color_data", [lptr](const json &v) {
+      // color_data = [[r,b,g,w]]
+      if (v.size() > 0 && v.at(0).size() == 4) {
+	lptr->update_value(static_cast<int>(v.at(0).at(3).template get<double>() * 100));
+      }
+    });
   }
 
   if (leds.size() > 3) {
@@ -15,7 +15,6 @@ class LedPanel : public NotifyConsumer {
   LedPanel(KWebSocketClient &, std::mutex &);
   ~LedPanel();
 
-  void consume(json &j);
 
   lv_obj_t *get_container();
   void init(json&);
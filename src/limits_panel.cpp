@@ -31,7 +31,21 @@ LimitsPanel::LimitsPanel(KWebSocketClient &c, std::mutex &l)
 
   lv_obj_align(back_btn.get_container(), LV_ALIGN_BOTTOM_RIGHT, 0, -20);
   
-  ws.register_notify_update(this);
+  ws.register_status_update(this, "toolhead", "max_velocity", [this](const json &v) {
+    velocity.update_value(v.template get<int>());
+  });
+
+  ws.register_status_update(this, "toolhead", "max_accel", [this](const json &v) {
+    acceleration.update_value(v.template get<int>());
+  });
+
+  ws.register_status_update(this, "toolhead", "max_accel_to_decel", [this](const json &v) {
+    accel_to_decel.update_value(v.template get<int>());
+  });
+
+  ws.register_status_update(this, "toolhead", "square_corner_velocity", [this](const json &v) {
+    square_corner.update_value(v.template get<int>());
+  });
 }
 
 LimitsPanel::~LimitsPanel() {
@@ -39,6 +53,8 @@ LimitsPanel::~LimitsPanel() {
     lv_obj_del(cont);
     cont = NULL;
   }
+
+  ws.unregister_status_update(this);
 }
 
 void LimitsPanel::init(json &j) {
@@ -92,30 +108,6 @@ void LimitsPanel::foreground() {
   lv_obj_move_foreground(cont);
 }
 
-void LimitsPanel::consume(json &j) {
-  std::lock_guard<std::mutex> lock(lv_lock);
-  auto v = j["/params/0/toolhead/max_velocity"_json_pointer];
-  if (!v.is_null()) {
-    velocity.update_value(v.template get<int>());
-  }
-
-  v = j["/params/0/toolhead/max_accel"_json_pointer];
-  if (!v.is_null()) {
-    acceleration.update_value(v.template get<int>());
-  }
-
-  v = j["/params/0/toolhead/max_accel_to_decel"_json_pointer];
-  if (!v.is_null()) {
-    accel_to_decel.update_value(v.template get<int>());
-  }
-
-  v = j["/params/0/toolhead/square_corner_velocity"_json_pointer];
-  if (!v.is_null()) {
-    square_corner.update_value(v.template get<int>());
-  }
-  
-}
-
 void LimitsPanel::handle_callback(lv_event_t *e) {
   lv_obj_t *btn = lv_event_get_current_target(e);
 
@@ -16,7 +16,6 @@ class LimitsPanel : public NotifyConsumer {
 
   void init(json &j);
   void foreground();
-  void consume(json &j);
 
   void handle_callback(lv_event_t *event);
   
@@ -33,6 +33,11 @@ static void hal_init(lv_color_t p, lv_color_t s);
 #include "hv/hlog.h"
 #include "config.h"
 #include "utils.h"
+#include "fb_flip.h"
+#include "fb_rotate.h"
+#include "draw_simd.h"
+#include "draw_pool.h"
+#include "drm_display.h"
 
 #include <algorithm>
 
@@ -93,32 +98,83 @@ static void hal_init(lv_color_t primary, lv_color_t secondary) {
 
     /*Initialize a descriptor for the buffer*/
     static lv_disp_draw_buf_t disp_buf;
-    lv_disp_draw_buf_init(&disp_buf, buf, buf2, DISP_BUF_SIZE);
 
     /*Initialize and register a display driver*/
     static lv_disp_drv_t disp_drv;
     lv_disp_drv_init(&disp_drv);
     disp_drv.draw_buf   = &disp_buf;
     disp_drv.flush_cb   = fbdev_flush;
+    disp_drv.draw_ctx_init = &DrawSimd::init_ctx;
 
     uint32_t width;
     uint32_t height;
     uint32_t dpi;
+    Config *conf = Config::get_instance();
+    auto rotate = conf->get_json("/display_rotate");
+
+#ifdef GUPPY_PARALLEL_DRAW
+    auto draw_threads = conf->get_json("/draw_threads");
+    DrawPool::get_instance()->start(draw_threads.is_number_unsigned()
+				    ? draw_threads.template get<uint32_t>() : 0);
+#endif
+
+#ifdef GUPPY_DRM
+    DrmDisplay *drm = DrmDisplay::get_instance();
+    if (drm->is_enabled()) {
+      width = drm->get_width();
+      height = drm->get_height();
+      lv_disp_draw_buf_init(&disp_buf, drm->page(0), drm->page(1), width * height);
+      disp_drv.hor_res = width;
+      disp_drv.ver_res = height;
+      disp_drv.direct_mode = 1;
+      disp_drv.flush_cb = &DrmDisplay::flush;
+      disp_drv.wait_cb = &DrmDisplay::wait;
+      if (!rotate.is_null()) {
+        spdlog::warn("display_rotate is not supported with the drm backend");
+      }
+      spdlog::info("rendering into drm dumb buffers");
+    } else {
+#endif
     fbdev_get_sizes(&width, &height, &dpi);
     
     disp_drv.hor_res    = width;
     disp_drv.ver_res    = height;
-    Config *conf = Config::get_instance();
-    auto rotate = conf->get_json("/display_rotate");
     if (!rotate.is_null()) {
       auto rotate_value = rotate.template get<uint32_t>();
       if (rotate_value > 0 && rotate_value < 4) {
-        disp_drv.sw_rotate = 1;
         disp_drv.rotated = rotate_value;
+
+        // lvgl renders as if the panel rotated itself and the flush rotates
+        // into the framebuffer, else lvgl rotates into a temporary buffer
+        FbRotate *fb_rotate = FbRotate::get_instance();
+        if (fb_rotate->init(FBDEV_PATH)
+            && fb_rotate->get_width() == width && fb_rotate->get_height() == height) {
+          disp_drv.flush_cb = &FbRotate::flush;
+        } else {
+          disp_drv.sw_rotate = 1;
+        }
       }
     }
 
-    spdlog::debug("resolution {} x {}", width, height);
+    // rotated frames are rendered in chunks, they can't draw into the pages
+    auto page_flip = conf->get_json("/display_page_flip");
+    FbFlip *flip = FbFlip::get_instance();
+    if (page_flip.is_boolean() && page_flip.template get<bool>()
+        && disp_drv.rotated == LV_DISP_ROT_NONE
+        && flip->init(FBDEV_PATH)
+        && flip->get_width() == width && flip->get_height() == height) {
+      lv_disp_draw_buf_init(&disp_buf, flip->page(0), flip->page(1), width * height);
+      disp_drv.direct_mode = 1;
+      disp_drv.flush_cb = &FbFlip::flush;
+      spdlog::info("rendering into page flipped framebuffer");
+    } else {
+      lv_disp_draw_buf_init(&disp_buf, buf, buf2, DISP_BUF_SIZE);
+    }
+#ifdef GUPPY_DRM
+    }
+#endif
+
+    spdlog::debug("resolution {} x {}, {} blend kernels", width, height, DrawSimd::kernel_name());
     lv_disp_t * disp = lv_disp_drv_register(&disp_drv);
     lv_theme_t * th = height <= 480
       ? lv_theme_default_init(NULL, primary, secondary, true, &lv_font_montserrat_12)
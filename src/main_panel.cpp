@@ -59,8 +59,6 @@ MainPanel::MainPanel(KWebSocketClient &websocket,
   lv_style_set_img_recolor(&style, lv_color_black());
   lv_style_set_border_width(&style, 0);
   lv_style_set_bg_color(&style, lv_palette_darken(LV_PALETTE_GREY, 4));
-
-  ws.register_notify_update(this);
 }
 
 MainPanel::~MainPanel() {
@@ -70,6 +68,7 @@ MainPanel::~MainPanel() {
   }
 
   sensors.clear();
+  ws.unregister_status_update(this);
 }
 
 void MainPanel::subscribe() {
@@ -106,24 +105,6 @@ void MainPanel::init(json &j) {
   printertune_panel.init(j);
 }
 
-void MainPanel::consume(json &j) {
-  std::lock_guard<std::mutex> lock(lv_lock);
-  for (const auto &el : sensors) {
-    auto target_value = j[json::json_pointer(fmt::format("/params/0/{}/target", el.first))];
-    if (!target_value.is_null()) {
-      int target = target_value.template get<int>();
-      el.second->update_target(target);
-    }
-
-    auto temp_value = j[json::json_pointer(fmt::format("/params/0/{}/temperature", el.first))];
-    if (!temp_value.is_null()) {
-      int value = temp_value.template get<int>();
-      el.second->update_series(value);
-      el.second->update_value(value);
-    }
-  }
-}
-
 static void scroll_begin_event(lv_event_t *e)
 {
   /*Disable the scroll animations. Triggered when a tab button is clicked */
@@ -235,6 +216,7 @@ void MainPanel::create_main(lv_obj_t *parent)
 void MainPanel::create_sensors(json &temp_sensors) {
   std::lock_guard<std::mutex> lock(lv_lock);
   sensors.clear();
+  ws.unregister_status_update(this);
   for (auto &sensor : temp_sensors.items()) {
     std::string key = sensor.key();
     std::string sensor_name = key;
@@ -278,9 +260,20 @@ void MainPanel::create_sensors(json &temp_sensors) {
     lv_chart_series_t *temp_series =
       lv_chart_add_series(temp_chart, color_code, LV_CHART_AXIS_PRIMARY_Y);
 
-    sensors.insert({key, std::make_shared<SensorContainer>(ws, temp_cont, sensor_img, 150,
+    auto sensor_cont = std::make_shared<SensorContainer>(ws, temp_cont, sensor_img, 150,
       display_name.c_str(), color_code, controllable, false, numpad, sensor_name,
-      temp_chart, temp_series, type)});
+      temp_chart, temp_series, type);
+    sensors.insert({key, sensor_cont});
+
+    ws.register_status_update(this, key, "target", [sensor_cont](const json &v) {
+      sensor_cont->update_target(v.template get<int>());
+    });
+
+    ws.register_status_update(this, key, "temperature", [sensor_cont](const json &v) {
+      int value = v.template get<int>();
+      sensor_cont->update_series(value);
+      sensor_cont->update_value(value);
+    });
   }
 }
 
@@ -31,7 +31,6 @@ class MainPanel : public NotifyConsumer {
 	    SpoolmanPanel &sm);
 
   ~MainPanel();
-  void consume(json &data);
   void init(json &data);
   void subscribe();
   PrinterTunePanel& get_tune_panel();
@@ -89,11 +89,9 @@ void MiniPrintStatus::update_progress(int p) {
   lv_arc_set_value(progress_bar, p);
 }
 
-void MiniPrintStatus::update_img(const std::string &img_path, size_t twidth) {
-  auto screen_width = lv_disp_get_physical_hor_res(NULL);
-  uint32_t normalized_thumb_scale = ((0.05 * (double)screen_width) / (double)twidth) * 256;
-  lv_img_set_zoom(thumb, normalized_thumb_scale);  
-  lv_img_set_src(thumb, img_path.c_str());
+// img is already scaled to size
+void MiniPrintStatus::update_img(const lv_img_dsc_t *img) {
+  lv_img_set_src(thumb, img);
 }
 
 void MiniPrintStatus::reset() {
@@ -8,3 +8,10 @@ NotifyConsumer::NotifyConsumer(std::mutex &lock)
 
 NotifyConsumer::~NotifyConsumer() {
 }
+
+void NotifyConsumer::consume(json &data) {
+}
+
+void NotifyConsumer::consume_status(const StatusUpdate &update) {
+  consume(update.to_json());
+}
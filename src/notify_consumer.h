@@ -2,6 +2,9 @@
 #define __NOTIFY_CONSUMER_H__
 
 #include "hv/json.hpp"
+#include "status_update.h"
+
+#include <mutex>
 
 using json = nlohmann::json;
 
@@ -9,7 +12,9 @@ class NotifyConsumer {
  public:
   NotifyConsumer(std::mutex &lv_lock);
   ~NotifyConsumer();
-  virtual void consume(nlohmann::json &data) = 0;
+  virtual void consume(nlohmann::json &data);
+  // notify_status_update deltas, defaults to the legacy json view
+  virtual void consume_status(const StatusUpdate &update);
   // virtual void consume(std::string &str) = 0;
  protected:
   std::mutex &lv_lock;
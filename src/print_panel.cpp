@@ -146,7 +146,18 @@ PrintPanel::PrintPanel(KWebSocketClient &websocket, std::mutex &lock, PrintStatu
   lv_label_set_text(label, "Printing in progress...");
   lv_obj_align(label, LV_ALIGN_TOP_MID, 0, 0);
 
-  ws.register_notify_update(this);
+  ws.register_method_callback("notify_filelist_changed",
+			      "PrintPanel",
+			      [this](json &d) { subscribe(); });
+
+  ws.register_status_update(this, "print_stats", "state", [this](const json &v) {
+    std::string pstat_state = v.template get<std::string>();
+    if (pstat_state != "printing" && pstat_state != "paused") {
+      status_btn.disable();
+    } else {
+      status_btn.enable();
+    }
+  });
 }
 
 PrintPanel::~PrintPanel() {
@@ -159,6 +170,8 @@ PrintPanel::~PrintPanel() {
     lv_obj_del(prompt_cont);
     prompt_cont = NULL;
   }
+
+  ws.unregister_status_update(this);
 }
 
 void PrintPanel::populate_files(json &j) {
@@ -166,25 +179,6 @@ void PrintPanel::populate_files(json &j) {
   show_dir(cur_dir, SORTED_BY_MODIFIED);
 }
 
-void PrintPanel::consume(json &j) {
-  if (j["method"] == "notify_filelist_changed") {
-    subscribe();
-    return;
-  }
-  json &pstat_state = j["/params/0/print_stats/state"_json_pointer];
-  if (pstat_state.is_null()) {
-    return;
-  }
-
-  std::lock_guard<std::mutex> lock(lv_lock);
-  if (pstat_state.template get<std::string>() != "printing"
-    && pstat_state.template get<std::string>() != "paused") {
-    status_btn.disable();
-  } else {
-    status_btn.enable();
-  }
-}
-
 void PrintPanel::subscribe() {
   ws.send_jsonrpc("server.files.list", R"({"root":"gcodes"})"_json, [this](json &d) {
     std::lock_guard<std::mutex> lock(lv_lock);
@@ -206,14 +200,15 @@ void PrintPanel::subscribe() {
 }
 
 void PrintPanel::foreground() {
-  json &pstat_state = State::get_instance()
-    ->get_data("/printer_state/print_stats/state"_json_pointer);
+  State *s = State::get_instance();
+  static const StateKey print_state_key = s->key("print_stats", "state");
+  std::string pstat_state = s->get_string(print_state_key);
   spdlog::debug("print panel print stats {}",
-    pstat_state.is_null() ? "nil" : pstat_state.template get<std::string>());
+    pstat_state.empty() ? "nil" : pstat_state);
 
-  if (!pstat_state.is_null()
-    && pstat_state.template get<std::string>() != "printing"
-    && pstat_state.template get<std::string>() != "paused") {
+  if (!pstat_state.empty()
+    && pstat_state != "printing"
+    && pstat_state != "paused") {
     status_btn.disable();
   } else {
     status_btn.enable();
@@ -353,14 +348,15 @@ void PrintPanel::handle_print_callback(lv_event_t *event) {
   lv_event_code_t code = lv_event_get_code(event);
   if (code == LV_EVENT_CLICKED && cur_file != NULL) {
 
-    json &pstat_state = State::get_instance()
-      ->get_data("/printer_state/print_stats/state"_json_pointer);
+    State *s = State::get_instance();
+    static const StateKey print_state_key = s->key("print_stats", "state");
+    std::string pstat_state = s->get_string(print_state_key);
     spdlog::debug("print panel print stats {}",
-      pstat_state.is_null() ? "nil" : pstat_state.template get<std::string>());
+      pstat_state.empty() ? "nil" : pstat_state);
 
-    if (!pstat_state.is_null()
-      && pstat_state.template get<std::string>() != "printing"
-      && pstat_state.template get<std::string>() != "paused") {
+    if (!pstat_state.empty()
+      && pstat_state != "printing"
+      && pstat_state != "paused") {
       spdlog::debug("printer ready to print. print file {}", cur_file->full_path);
 
       // ws.send_jsonrpc("printer.gcode.script",
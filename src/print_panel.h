@@ -14,7 +14,6 @@ public:
   PrintPanel(KWebSocketClient &ws, std::mutex &lv_lock, PrintStatusPanel &ps);
   ~PrintPanel();
 
-  void consume(json &data);
   void populate_files(json &data);
   void subscribe();
   void foreground();
@@ -2,8 +2,11 @@
 #include "finetune_panel.h"
 #include "state.h"
 #include "utils.h"
+#include "image_cache.h"
 #include "spdlog/spdlog.h"
 
+#include <cmath>
+
 
 LV_IMG_DECLARE(extruder);
 LV_IMG_DECLARE(speed_up_img);
@@ -46,7 +49,7 @@ PrintStatusPanel::PrintStatusPanel(KWebSocketClient &websocket_client,
 		  "Do you want to emergency stop?",
 		  [&websocket_client]() {
 		    spdlog::debug("emergency stop pressed");
-		    websocket_client.send_jsonrpc("printer.emergency_stop");
+		    websocket_client.send_priority("printer.emergency_stop", KUtils::input_age_ms());
 		  })
   , back_btn(buttons_cont, &back, "Back", &PrintStatusPanel::_handle_callback, this)
   , thumbnail_cont(lv_obj_create(status_cont))
@@ -144,16 +147,126 @@ PrintStatusPanel::PrintStatusPanel(KWebSocketClient &websocket_client,
   //row 2
   lv_obj_set_grid_cell(buttons_cont, LV_GRID_ALIGN_STRETCH, 0, 2, LV_GRID_ALIGN_STRETCH, 1, 1);
 
-  ws.register_notify_update(this);
+  ws.register_status_update(this, "print_stats", "filename", [this](const json &v) {
+    // filename change indicates a start of a print, the same name again is
+    // not one
+    std::string filename = v.is_string() ? v.template get<std::string>() : "";
+    if (filename == print_filename) {
+      return;
+    }
+    print_filename = filename;
+
+    reset();
+    populate();
+    foreground(); // auto move to front when print is detected
+  });
+
+  ws.register_status_update(this, "print_stats", "state", [this](const json &v) {
+    auto print_status = v.template get<std::string>();
+    if (print_status != "printing" && print_status != "paused") {
+      mini_print_status.hide();
+    } else {
+      mini_print_status.show();
+    }
+
+    mini_print_status.update_status(print_status);
+  });
+
+  ws.register_status_update(this, "extruder", "target", [this](const json &v) {
+    extruder_target = v.template get<int>();
+  });
+
+  ws.register_status_update(this, "heater_bed", "target", [this](const json &v) {
+    heater_bed_target = v.template get<int>();
+  });
+
+  ws.register_status_update(this, "extruder", "temperature", [this](const json &v) {
+    if (extruder_target > 0) {
+      extruder_temp.update_label(fmt::format("{} / {}", v.template get<int>(), extruder_target).c_str());
+    } else {
+      extruder_temp.update_label(fmt::format("{}", v.template get<int>()).c_str());
+    }
+  });
+
+  ws.register_status_update(this, "heater_bed", "temperature", [this](const json &v) {
+    if (heater_bed_target > 0) {
+      bed_temp.update_label(fmt::format("{} / {}", v.template get<int>(), heater_bed_target).c_str());
+    } else {
+      bed_temp.update_label(fmt::format("{}", v.template get<int>()).c_str());
+    }
+  });
+
+  // speed
+  ws.register_status_update(this, "motion_report", "live_velocity", [this](const json &v) {
+    int s = static_cast<int>(v.template get<double>());
+    print_speed.update_label((std::to_string(s) + " mm/s").c_str());
+  });
+
+  // zoffset
+  ws.register_status_update(this, "gcode_move", "homing_origin", [this](const json &v) {
+    if (v.size() > 2) {
+      z_offset.update_label(fmt::format("{:.5} mm", v.at(2).template get<double>()).c_str());
+    }
+  });
+
+  // progress
+  ws.register_status_update(this, "print_stats", "print_duration", [this](const json &v) {
+    update_time_progress(static_cast<uint32_t>(v.template get<float>()));
+  });
+
+  // progress percentage
+  ws.register_status_update(this, "virtual_sdcard", "progress", [this](const json &v) {
+    int new_value = static_cast<int>(v.template get<double>() * 100);
+    lv_bar_set_value(progress_bar, new_value, LV_ANIM_ON);
+    lv_label_set_text(progress_label, fmt::format("{}%", new_value).c_str());
+    mini_print_status.update_progress(new_value);
+  });
+
+  ws.register_status_update(this, "motion_report", "live_extruder_velocity", [this](const json &v) {
+    double flow = pi() / 4 * std::pow(filament_diameter, 2) * v.template get<double>();
+    flow_rate.update_label(fmt::format("{:.1f} mm3/s", flow > 0.0 ? flow : 0.0).c_str());
+  });
+
+  ws.register_status_update(this, "pause_resume", "is_paused", [this](const json &v) {
+    bool is_paused = v.template get<bool>();
+    if (is_paused) {
+      resume_btn.enable();
+      lv_obj_clear_flag(resume_btn.get_container(), LV_OBJ_FLAG_HIDDEN);
+
+      pause_btn.disable();
+      lv_obj_add_flag(pause_btn.get_container(), LV_OBJ_FLAG_HIDDEN);
+
+    } else {
+      pause_btn.enable();
+      lv_obj_clear_flag(pause_btn.get_container(), LV_OBJ_FLAG_HIDDEN);
+
+      resume_btn.disable();
+      lv_obj_add_flag(resume_btn.get_container(), LV_OBJ_FLAG_HIDDEN);
+    }
+  });
+
+  // layers
+  ws.register_status_update(this, "print_stats", "info", [this](const json &v) {
+    json info = v;
+    update_layers(info);
+  });
+
+  // without print_stats.info layers are estimated from the z position
+  ws.register_status_update(this, "gcode_move", "gcode_position", [this](const json &v) {
+    json info = State::get_instance()->get_data("/printer_state/print_stats/info"_json_pointer);
+    update_layers(info);
+  });
 }
 
 PrintStatusPanel::~PrintStatusPanel() {
+  ThumbnailLoader::get_instance()->cancel(this);
+  ThumbnailLoader::get_instance()->cancel(&mini_thumb);
   if (status_cont != NULL) {
     lv_obj_del(status_cont);
     status_cont = NULL;
   }
 
-  ws.unregister_notify_update(this);
+  ws.unregister_status_update(this);
 }
 
 void PrintStatusPanel::foreground() {
@@ -181,19 +294,43 @@ void PrintStatusPanel::reset() {
   heater_bed_target = -1;
 
   // free src
+  ThumbnailLoader::get_instance()->cancel(this);
+  ThumbnailLoader::get_instance()->cancel(&mini_thumb);
   lv_img_set_src(thumbnail, NULL);
   // hack to color in empty space.
   ((lv_img_t*)thumbnail)->src_type = LV_IMG_SRC_SYMBOL;
 
   mini_print_status.reset();
+  ImageCache *cache = ImageCache::get_instance();
+  if (thumb) {
+    cache->unpin(thumb->key);
+  }
+  if (mini_thumb) {
+    cache->unpin(mini_thumb->key);
+  }
+  thumb.reset();
+  mini_thumb.reset();
 }
 
 void PrintStatusPanel::init(json &fans) {
+  for (auto &f : watched_fans) {
+    ws.unregister_status_update(this, f);
+  }
+
+  watched_fans.clear();
   fan_speeds.clear();
   std::vector<std::string> values;
   for (auto &f : fans.items()) {
     std::string fan_name = f.key();
 
+    auto update_fan = [this, fan_name](const json &v) {
+      fan_speeds[fan_name] = static_cast<int>(v.template get<double>() * 100);
+      update_fan_speeds();
+    };
+    ws.register_status_update(this, fan_name, "value", update_fan);
+    ws.register_status_update(this, fan_name, "speed", update_fan);
+    watched_fans.push_back(fan_name);
+
     auto fan_value = State::get_instance()
       ->get_data(json::json_pointer(fmt::format("/printer_state/{}/value", fan_name)));
     if (!fan_value.is_null()) {
@@ -287,161 +424,65 @@ void PrintStatusPanel::handle_metadata(const std::string &gcode_file, json &j) {
   current_file = j["/result"_json_pointer];
 
   auto width_scale = (double)lv_disp_get_physical_hor_res(NULL) / 800.0;
-  auto thumb_detail = KUtils::get_thumbnail(gcode_file, j, width_scale);
-  std::string fullpath = thumb_detail.first;
-  if (fullpath.length() > 0) {
-    spdlog::trace("thumb path: {}", fullpath);
+  auto thumb_src = KUtils::get_thumbnail(gcode_file, j, width_scale);
+  if (thumb_src.path.length() > 0) {
+    spdlog::trace("thumb path: {}", thumb_src.path);
     std::lock_guard<std::mutex> lock(lv_lock);
-    const std::string img_path = "A:" + fullpath;
-
-    lv_img_set_src(thumbnail, img_path.c_str());
-    auto thumb_w = thumb_detail.second.first;
-    auto thumb_h = thumb_detail.second.second;
+    // placeholder until the loader is done
+    lv_img_set_src(thumbnail, LV_SYMBOL_IMAGE);
 
+    lv_obj_update_layout(thumbnail_cont);
     auto available_w = lv_obj_get_width(thumbnail_cont);
     auto available_h = lv_obj_get_height(thumbnail_cont) - lv_obj_get_height(pbar_cont) - lv_obj_get_style_pad_row(thumbnail_cont, LV_PART_MAIN);
 
-    double scale_x = (double)available_w / (double)thumb_w;
-    double scale_y = (double)available_h / (double)thumb_h;
-    double scale = std::min(scale_x, scale_y);
+    ThumbnailLoader *loader = ThumbnailLoader::get_instance();
+    loader->load(this, thumb_src, std::max<lv_coord_t>(available_w, 0), std::max<lv_coord_t>(available_h, 0),
+      [this](std::shared_ptr<Thumbnail> t) { this->show_thumbnail(t); });
 
-    uint32_t lv_zoom = static_cast<uint32_t>(scale * 256.0);
-    lv_img_set_pivot(thumbnail, thumb_w / 2, thumb_h);
-    lv_img_set_zoom(thumbnail, lv_zoom);
-    mini_print_status.update_img(img_path, thumb_detail.second.first);
+    // the mini status shows it a twentieth of the screen wide
+    uint32_t mini_w = 0.05 * lv_disp_get_physical_hor_res(NULL);
+    loader->load(&mini_thumb, thumb_src, mini_w, mini_w,
+      [this](std::shared_ptr<Thumbnail> t) { this->show_mini_thumbnail(t); });
   }
 }
 
-
-void PrintStatusPanel::consume(json &j) {
-  std::lock_guard<std::mutex> lock(lv_lock);
-
-  auto printfile = j["/params/0/print_stats/filename"_json_pointer];
-  if (!printfile.is_null()) {
-    // filename change indicates a start of a print
-    reset();
-    populate();
-    foreground(); // auto move to front when print is detected
-  }
-
-  auto& pstate = j["/params/0/print_stats/state"_json_pointer];
-  if (!pstate.is_null()) {
-    auto print_status = pstate.template get<std::string>();
-    if (print_status != "printing" && print_status != "paused") {
-      mini_print_status.hide();
-    } else {
-      mini_print_status.show();
-    }
-
-    mini_print_status.update_status(print_status);
-  }
-
-  auto v = j["/params/0/extruder/target"_json_pointer];
-  if (!v.is_null()) {
-    extruder_target = v.template get<int>();
-  }
-
-  v = j["/params/0/heater_bed/target"_json_pointer];
-  if (!v.is_null()) {
-    heater_bed_target = v.template get<int>();
+void PrintStatusPanel::show_thumbnail(std::shared_ptr<Thumbnail> t) {
+  if (!t) {
+    lv_img_set_src(thumbnail, NULL);
+    ((lv_img_t*)thumbnail)->src_type = LV_IMG_SRC_SYMBOL;
+    return;
   }
 
-  v = j["/params/0/extruder/temperature"_json_pointer];
-  if (!v.is_null()) {
-    if (extruder_target > 0) {
-      extruder_temp.update_label(fmt::format("{} / {}", v.template get<int>(), extruder_target).c_str());
-    } else {
-      extruder_temp.update_label(fmt::format("{}", v.template get<int>()).c_str());
-    }
+  // the print's thumbnails stay decoded until the next one starts
+  ImageCache *cache = ImageCache::get_instance();
+  cache->pin(t->key);
+  if (thumb) {
+    cache->unpin(thumb->key);
   }
+  thumb = t;
+  lv_img_set_src(thumbnail, &thumb->dsc);
+}
 
-  v = j["/params/0/heater_bed/temperature"_json_pointer];
-  if (!v.is_null()) {
-    if (heater_bed_target > 0) {
-      bed_temp.update_label(fmt::format("{} / {}", v.template get<int>(), heater_bed_target).c_str());
-    } else {
-      bed_temp.update_label(fmt::format("{}", v.template get<int>()).c_str());
+void PrintStatusPanel::show_mini_thumbnail(std::shared_ptr<Thumbnail> t) {
+  if (t) {
+    ImageCache *cache = ImageCache::get_instance();
+    cache->pin(t->key);
+    if (mini_thumb) {
+      cache->unpin(mini_thumb->key);
     }
+    mini_thumb = t;
+    mini_print_status.update_img(&mini_thumb->dsc);
   }
+}
 
-  // speed
-  auto speed = j["/params/0/motion_report/live_velocity"_json_pointer];
-  if (!speed.is_null()) {
-    int s = static_cast<int>(speed.template get<double>());
-    print_speed.update_label((std::to_string(s) + " mm/s").c_str());
-  }
-
-  // zoffset
-  v = j["/params/0/gcode_move/homing_origin/2"_json_pointer];
-  if (!v.is_null()) {
-    z_offset.update_label(fmt::format("{:.5} mm", v.template get<double>()).c_str());
-  }
 
+void PrintStatusPanel::update_fan_speeds() {
   std::vector<std::string> values;
   for (auto &f : fan_speeds) {
-    std::string fan_name = f.first;
-
-    int fv = f.second;
-    auto fan_value = j[json::json_pointer(fmt::format("/params/0/{}/value", fan_name))];
-    if (!fan_value.is_null()) {
-      fv = static_cast<int>(fan_value.template get<double>() * 100);
-      f.second = fv;
-    }
-
-    fan_value = j[json::json_pointer(fmt::format("/params/0/{}/speed", fan_name))];
-    if (!fan_value.is_null()) {
-      fv = static_cast<int>(fan_value.template get<double>() * 100);
-      f.second = fv;
-    }
-    values.push_back(fmt::format("{}%", fv));
+    values.push_back(fmt::format("{}%", f.second));
   }
 
   fan0.update_label(fmt::format("{}", fmt::join(values, ", ")).c_str());
-
-  // progress
-  v = j["/params/0/print_stats/print_duration"_json_pointer];
-  if (!v.is_null()) {
-    uint32_t passed = static_cast<uint32_t>(v.template get<float>());
-    update_time_progress(passed);
-  }
-
-  // progress percentage
-  v = j["/params/0/virtual_sdcard/progress"_json_pointer];
-  if (!v.is_null()) {
-    int new_value = static_cast<int>(v.template get<double>() * 100);
-    lv_bar_set_value(progress_bar, new_value, LV_ANIM_ON);
-    lv_label_set_text(progress_label, fmt::format("{}%", new_value).c_str());
-    mini_print_status.update_progress(new_value);
-  }
-
-  v = j["/params/0/motion_report/live_extruder_velocity"_json_pointer];
-  if (!v.is_null()) {
-    double flow = pi() / 4 * std::pow(filament_diameter, 2) * v.template get<double>();
-    flow_rate.update_label(fmt::format("{:.1f} mm3/s", flow > 0.0 ? flow : 0.0).c_str());
-  }
-
-  v = j["/params/0/pause_resume/is_paused"_json_pointer];
-  if (!v.is_null()) {
-    bool is_paused = v.template get<bool>();
-    if (is_paused) {
-      resume_btn.enable();
-      lv_obj_clear_flag(resume_btn.get_container(), LV_OBJ_FLAG_HIDDEN);
-
-      pause_btn.disable();
-      lv_obj_add_flag(pause_btn.get_container(), LV_OBJ_FLAG_HIDDEN);
-
-    } else {
-      pause_btn.enable();
-      lv_obj_clear_flag(pause_btn.get_container(), LV_OBJ_FLAG_HIDDEN);
-
-      resume_btn.disable();
-      lv_obj_add_flag(resume_btn.get_container(), LV_OBJ_FLAG_HIDDEN);
-    }
-  }
-
-  // layers
-  v = j["/params/0/print_stats/info"_json_pointer];
-  update_layers(v);
 }
 
 void PrintStatusPanel::handle_callback(lv_event_t *event) {
@@ -450,9 +491,9 @@ void PrintStatusPanel::handle_callback(lv_event_t *event) {
     lv_obj_move_background(status_cont);
 
   } else if (btn == emergency_btn.get_container()) {
-    ws.send_jsonrpc("printer.emergency_stop");
+    ws.send_priority("printer.emergency_stop", KUtils::input_age_ms());
   } else if (btn == pause_btn.get_container()) {
-    ws.send_jsonrpc("printer.print.pause");
+    ws.send_priority("printer.print.pause", KUtils::input_age_ms());
     pause_btn.disable();
 
   } else if (btn == resume_btn.get_container()) {
@@ -521,18 +562,19 @@ int PrintStatusPanel::current_layer(json &info) {
 
   if (!current_file.is_null()) {
     State *s = State::get_instance();
-    auto pd = s->get_data("/printer_state/print_stats/print_duration"_json_pointer);
-    auto zpos = s->get_data("/printer_state/gcode_move/gcode_position/2"_json_pointer);
+    static const StateKey print_duration_key = s->key("print_stats", "print_duration");
+    static const StateKey gcode_position_key = s->key("gcode_move", "gcode_position");
+    double pd = s->get_number(print_duration_key);
+    double zpos = s->get_number(gcode_position_key, 2, NAN);
 
     auto first_layer_height = current_file["/first_layer_height"_json_pointer];
     auto layer_height = current_file["/layer_height"_json_pointer];
 
-    if (!pd.is_null()
-        && pd.template get<int>() > 0
-        && !zpos.is_null()
+    if (static_cast<int>(pd) > 0
+        && !std::isnan(zpos)
         && !first_layer_height.is_null()
         && !layer_height.is_null()) {
-      auto layer = static_cast<int>(std::ceil((zpos.template get<double>() - first_layer_height.template get<double>()) / layer_height.template get<double>() + 1));
+      auto layer = static_cast<int>(std::ceil((zpos - first_layer_height.template get<double>()) / layer_height.template get<double>() + 1));
       auto total = max_layer(info);
       if (layer > total) {
         return total;
@@ -7,11 +7,13 @@
 #include "image_label.h"
 #include "finetune_panel.h"
 #include "mini_print_status.h"
+#include "thumbnail_loader.h"
 #include "lvgl/lvgl.h"
 
 #include <mutex>
 #include <ctime>
 #include <map>
+#include <memory>
 
 class PrintStatusPanel : public NotifyConsumer {
  public:
@@ -26,6 +28,9 @@ class PrintStatusPanel : public NotifyConsumer {
   void background();
 
   void handle_metadata(const std::string &gcode_file, json &j);
+  // lv_lock held
+  void show_thumbnail(std::shared_ptr<Thumbnail> t);
+  void show_mini_thumbnail(std::shared_ptr<Thumbnail> t);
   void handle_callback(lv_event_t *event);
   
   static void _handle_callback(lv_event_t *event) {
@@ -33,8 +38,8 @@ class PrintStatusPanel : public NotifyConsumer {
     panel->handle_callback(event);
   };
 
-  void consume(json &j);
   void update_time_progress(uint32_t time_passed);
+  void update_fan_speeds();
   void update_flow_rate(double filament_used);
   void update_layers(json &info);
   int max_layer(json &info);
@@ -84,8 +89,13 @@ class PrintStatusPanel : public NotifyConsumer {
   int extruder_target;
   int heater_bed_target;
   json current_file;
+  // last print_stats.filename handled
+  std::string print_filename;
+  std::shared_ptr<Thumbnail> thumb;
+  std::shared_ptr<Thumbnail> mini_thumb;
 
   std::map<std::string, int> fan_speeds;
+  std::vector<std::string> watched_fans;
 };
 
 #endif // __PRINT_STATUS_PANEL_H__
@@ -135,7 +135,6 @@ PromptPanel::PromptPanel(KWebSocketClient &websocket_client,
 
   lv_obj_add_flag(prompt_cont, LV_OBJ_FLAG_HIDDEN);
 
-  ws.register_notify_update(this);
   ws.register_method_callback(
     "notify_gcode_response",
     "PromptPanel",
@@ -145,7 +144,6 @@ PromptPanel::PromptPanel(KWebSocketClient &websocket_client,
 
 PromptPanel::~PromptPanel() {
   if (prompt_cont) lv_obj_del(prompt_cont);
-  ws.unregister_notify_update(this);
 }
 
 void PromptPanel::foreground() {
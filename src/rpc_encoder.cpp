@@ -0,0 +1,80 @@
+#include "rpc_encoder.h"
+
+RpcEncoder::RpcEncoder() {
+  buf.reserve(512);
+}
+
+const std::string &RpcEncoder::request(const std::string &method, const json *params, uint64_t id) {
+  begin(method);
+  if (params != NULL) {
+    buf += ",\"params\":";
+    buf += params->dump();
+  }
+  end(id);
+  return buf;
+}
+
+const std::string &RpcEncoder::gcode_script(const std::string &gcode, uint64_t id) {
+  begin("printer.gcode.script");
+  buf += ",\"params\":{\"script\":\"";
+  append_escaped(gcode);
+  buf += "\"}";
+  end(id);
+  return buf;
+}
+
+void RpcEncoder::begin(std::string_view method) {
+  buf.assign("{\"jsonrpc\":\"2.0\",\"method\":\"");
+  append_escaped(method);
+  buf += '"';
+}
+
+void RpcEncoder::end(uint64_t id) {
+  buf += ",\"id\":";
+  append_uint(id);
+  buf += '}';
+}
+
+void RpcEncoder::append_escaped(std::string_view s) {
+  static const char hex[] = "0123456789abcdef";
+  for (char c : s) {
+    switch (c) {
+    case '"':
+      buf += "\\\"";
+      break;
+    case '\\':
+      buf += "\\\\";
+      break;
+    case '\n':
+      buf += "\\n";
+      break;
+    case '\r':
+      buf += "\\r";
+      break;
+    case '\t':
+      buf += "\\t";
+      break;
+    default:
+      if (static_cast<unsigned char>(c) < 0x20) {
+	buf += "\\u00";
+	buf += hex[(c >> 4) & 0xf];
+	buf += hex[c & 0xf];
+      } else {
+	buf += c;
+      }
+    }
+  }
+}
+
+void RpcEncoder::append_uint(uint64_t v) {
+  char digits[20];
+  size_t n = 0;
+  do {
+    digits[n++] = '0' + (v % 10);
+    v /= 10;
+  } while (v > 0);
+
+  while (n > 0) {
+    buf += digits[--n];
+  }
+}
@@ -0,0 +1,35 @@
+#ifndef __RPC_ENCODER_H__
+#define __RPC_ENCODER_H__
+
+#include "hv/json.hpp"
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+
+using json = nlohmann::json;
+
+// Writes JSON-RPC request frames into a buffer reused across calls. The
+// returned frame is valid until the next call. printer.gcode.script, the
+// request sent for every jog, extrude and fan change, is written by hand so
+// encoding it doesn't touch the heap once the buffer has grown; other
+// params go through json::dump.
+class RpcEncoder {
+ public:
+  RpcEncoder();
+  RpcEncoder(RpcEncoder &o) = delete;
+  void operator=(const RpcEncoder &) = delete;
+
+  const std::string &request(const std::string &method, const json *params, uint64_t id);
+  const std::string &gcode_script(const std::string &gcode, uint64_t id);
+
+ private:
+  void begin(std::string_view method);
+  void end(uint64_t id);
+  void append_escaped(std::string_view s);
+  void append_uint(uint64_t v);
+
+  std::string buf;
+};
+
+#endif // __RPC_ENCODER_H__
@@ -0,0 +1,61 @@
+#ifndef __SPSC_QUEUE_H__
+#define __SPSC_QUEUE_H__
+
+#include <atomic>
+#include <vector>
+#include <cstddef>
+
+// bounded single producer, single consumer ring. push() is only called from
+// one thread and pop() from another, neither blocks.
+template <typename T>
+class SpscQueue {
+ public:
+  // capacity is rounded up to a power of two
+  SpscQueue(size_t capacity)
+    : head(0)
+    , tail(0)
+  {
+    size_t n = 1;
+    while (n < capacity) {
+      n <<= 1;
+    }
+    buf.resize(n);
+    mask = n - 1;
+  }
+
+  SpscQueue(SpscQueue &o) = delete;
+  void operator=(const SpscQueue &) = delete;
+
+  // returns false if the queue is full
+  bool push(const T &v) {
+    size_t t = tail.load(std::memory_order_relaxed);
+    if (t - head.load(std::memory_order_acquire) > mask) {
+      return false;
+    }
+
+    buf[t & mask] = v;
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+  // returns false if the queue is empty
+  bool pop(T &v) {
+    size_t h = head.load(std::memory_order_relaxed);
+    if (h == tail.load(std::memory_order_acquire)) {
+      return false;
+    }
+
+    v = buf[h & mask];
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+ private:
+  std::vector<T> buf;
+  size_t mask;
+  // consumer and producer indices on separate cache lines
+  alignas(64) std::atomic<size_t> head;
+  alignas(64) std::atomic<size_t> tail;
+};
+
+#endif // __SPSC_QUEUE_H__
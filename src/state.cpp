@@ -4,6 +4,8 @@
 #include "spdlog/spdlog.h"
 #include "lvgl/lvgl.h"
 
+#include <cstring>
+
 const uint32_t GUPPY_COLOR_SIZE = 19;
 const lv_palette_t GUPPY_COLORS[GUPPY_COLOR_SIZE] = {
   LV_PALETTE_RED,
@@ -32,7 +34,12 @@ State *State::instance{NULL};
 
 State::State(std::mutex &state_lock)
   : NotifyConsumer(state_lock)
+  , slot_count(0)
+  , snapshot(std::make_shared<const json>(json::object()))
 {
+  for (auto &c : chunks) {
+    c.store(NULL, std::memory_order_relaxed);
+  }
 }
 
 State *State::get_instance() {
@@ -45,33 +52,332 @@ State *State::get_instance() {
 void State::reset() {
   std::lock_guard<std::mutex> guard(lock);
   data.clear();
+  std::atomic_store(&snapshot, std::make_shared<const json>(json::object()));
+
+  for (StateKey k = 0; k < names.size(); k++) {
+    if (get_slot(k)->kind.load(std::memory_order_relaxed) != FIELD_ABSENT) {
+      publish_locked(k, FIELD_ABSENT, 0, nullptr);
+    }
+    // the json view was dropped above, nothing to sync
+    is_dirty[k] = false;
+  }
+  dirty.clear();
 }
 
 void State::set_data(const std::string &key, json &j, const std::string &json_path) {
   std::lock_guard<std::mutex> guard(lock);
   auto patch = j[json::json_pointer(json_path)];
   if (!patch.is_null()) {
+    if (key == "printer_state") {
+      apply_status_locked(patch);
+      return;
+    }
+
     // spdlog::debug("setting data key {}\nbefore: {}\npatch: {}", key, data.contains(key) ? data[key].dump() : "nil"
     // 		  ,patch.dump());
     data[key].merge_patch(patch);
     // spdlog::debug("after: {}", data.contains(key) ? data[key].dump() : "nil");
+
+    auto next = std::make_shared<json>(*snapshot);
+    (*next)[key].merge_patch(patch);
+    std::atomic_store(&snapshot, std::shared_ptr<const json>(next));
   }
 }
 
 json &State::get_data() {
   std::lock_guard<std::mutex> guard(lock);
+  sync_printer_state_locked();
   return data;
 }
 
 json &State::get_data(const json::json_pointer &ptr) {
   std::lock_guard<std::mutex> guard(lock);
+  sync_printer_state_locked();
   return data[ptr];
 }
 
 void State::consume(json &j) {
   if (j.contains("params") && !j["params"].empty()) {
-    set_data("printer_state", j, "/params/0");
+    std::lock_guard<std::mutex> guard(lock);
+    apply_status_locked(j["params"][0]);
+  }
+}
+
+void State::consume_status(const StatusUpdate &update) {
+  std::lock_guard<std::mutex> guard(lock);
+  for (const auto &d : update) {
+    apply_locked(d.object, d.field, d.value);
+  }
+}
+
+StateKey State::key(const std::string &object, const std::string &field) {
+  std::lock_guard<std::mutex> guard(lock);
+  return intern_locked(object, field);
+}
+
+bool State::has(StateKey k) {
+  Slot *s = get_slot(k);
+  return s != NULL && s->kind.load(std::memory_order_acquire) != FIELD_ABSENT;
+}
+
+uint64_t State::get_version(StateKey k) {
+  Slot *s = get_slot(k);
+  return s != NULL ? s->seq.load(std::memory_order_acquire) / 2 : 0;
+}
+
+double State::get_number(StateKey k, double def) {
+  Slot *s = get_slot(k);
+  if (s == NULL) {
+    return def;
+  }
+
+  uint64_t bits;
+  uint32_t kind = read_number(*s, bits);
+  return is_number(kind) ? to_double(kind, bits) : def;
+}
+
+double State::get_number(StateKey k, size_t idx, double def) {
+  auto v = get_value(k);
+  if (v && v->is_array() && idx < v->size() && (*v)[idx].is_number()) {
+    return (*v)[idx].template get<double>();
+  }
+
+  return def;
+}
+
+std::string State::get_string(StateKey k, const std::string &def) {
+  auto v = get_value(k);
+  if (v && v->is_string()) {
+    return v->template get<std::string>();
+  }
+
+  return def;
+}
+
+std::shared_ptr<const json> State::get_value(StateKey k) {
+  Slot *s = get_slot(k);
+  if (s == NULL) {
+    return nullptr;
+  }
+
+  auto v = std::atomic_load(&s->value);
+  if (v) {
+    return v;
+  }
+
+  uint64_t bits;
+  uint32_t kind = read_number(*s, bits);
+  if (is_number(kind)) {
+    return std::make_shared<const json>(to_json(kind, bits));
+  }
+
+  return nullptr;
+}
+
+std::shared_ptr<const json> State::get_snapshot() {
+  return std::atomic_load(&snapshot);
+}
+
+State::Slot *State::get_slot(StateKey k) {
+  if (k >= slot_count.load(std::memory_order_acquire)) {
+    return NULL;
+  }
+
+  return &chunks[k / SLOTS_PER_CHUNK].load(std::memory_order_acquire)[k % SLOTS_PER_CHUNK];
+}
+
+bool State::is_number(uint32_t kind) {
+  return kind == FIELD_INTEGER || kind == FIELD_UNSIGNED || kind == FIELD_FLOAT;
+}
+
+uint64_t State::load_bits(const Slot &s) {
+  return static_cast<uint64_t>(s.number_hi.load(std::memory_order_relaxed)) << 32
+    | s.number_lo.load(std::memory_order_relaxed);
+}
+
+uint32_t State::read_number(const Slot &s, uint64_t &bits) {
+  while (true) {
+    uint32_t seq = s.seq.load(std::memory_order_acquire);
+    if (seq & 1) {
+      continue;
+    }
+
+    uint32_t kind = s.kind.load(std::memory_order_relaxed);
+    bits = load_bits(s);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (s.seq.load(std::memory_order_relaxed) == seq) {
+      return kind;
+    }
+  }
+}
+
+double State::to_double(uint32_t kind, uint64_t bits) {
+  if (kind == FIELD_INTEGER) {
+    return static_cast<double>(static_cast<int64_t>(bits));
+  }
+  if (kind == FIELD_UNSIGNED) {
+    return static_cast<double>(bits);
+  }
+
+  double v;
+  std::memcpy(&v, &bits, sizeof(v));
+  return v;
+}
+
+// the number as moonraker sent it, 3 stays an integer
+json State::to_json(uint32_t kind, uint64_t bits) {
+  if (kind == FIELD_INTEGER) {
+    return json(static_cast<int64_t>(bits));
+  }
+  if (kind == FIELD_UNSIGNED) {
+    return json(bits);
+  }
+
+  return json(to_double(kind, bits));
+}
+
+StateKey State::intern_locked(const std::string &object, const std::string &field) {
+  auto &fields = keys[object];
+  const auto &entry = fields.find(field);
+  if (entry != fields.end()) {
+    return entry->second;
+  }
+
+  uint32_t k = slot_count.load(std::memory_order_relaxed);
+  if (k >= SLOTS_PER_CHUNK * MAX_CHUNKS) {
+    spdlog::error("state store full, dropping {}.{}", object, field);
+    return INVALID_STATE_KEY;
+  }
+
+  if (k % SLOTS_PER_CHUNK == 0) {
+    chunks[k / SLOTS_PER_CHUNK].store(new Slot[SLOTS_PER_CHUNK], std::memory_order_release);
+  }
+
+  fields.insert({field, k});
+  names.push_back({object, field});
+  is_dirty.push_back(false);
+  slot_count.store(k + 1, std::memory_order_release);
+  return k;
+}
+
+void State::publish_locked(StateKey k,
+			   uint32_t kind,
+			   uint64_t bits,
+			   std::shared_ptr<const json> value) {
+  Slot &s = *get_slot(k);
+
+  uint32_t seq = s.seq.load(std::memory_order_relaxed);
+  s.seq.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  s.kind.store(kind, std::memory_order_relaxed);
+  s.number_lo.store(static_cast<uint32_t>(bits), std::memory_order_relaxed);
+  s.number_hi.store(static_cast<uint32_t>(bits >> 32), std::memory_order_relaxed);
+  std::atomic_store(&s.value, value);
+
+  s.seq.store(seq + 2, std::memory_order_release);
+
+  if (!is_dirty[k]) {
+    is_dirty[k] = true;
+    dirty.push_back(k);
+  }
+}
+
+// same semantics as merge_patch of {object: {field: value}}
+void State::apply_locked(const std::string &object, const std::string &field, const json &value) {
+  StateKey k = intern_locked(object, field);
+  if (k == INVALID_STATE_KEY) {
+    return;
+  }
+
+  Slot &s = *get_slot(k);
+  uint32_t kind = s.kind.load(std::memory_order_relaxed);
+  if (value.is_null()) {
+    if (kind != FIELD_ABSENT) {
+      publish_locked(k, FIELD_ABSENT, 0, nullptr);
+    }
+  } else if (value.is_number()) {
+    uint32_t next_kind;
+    uint64_t bits;
+    if (value.is_number_unsigned()) {
+      next_kind = FIELD_UNSIGNED;
+      bits = value.template get<uint64_t>();
+    } else if (value.is_number_integer()) {
+      next_kind = FIELD_INTEGER;
+      bits = static_cast<uint64_t>(value.template get<int64_t>());
+    } else {
+      next_kind = FIELD_FLOAT;
+      double v = value.template get<double>();
+      std::memcpy(&bits, &v, sizeof(bits));
+    }
+
+    if (kind != next_kind || load_bits(s) != bits) {
+      publish_locked(k, next_kind, bits, nullptr);
+    }
+  } else {
+    auto cur = std::atomic_load(&s.value);
+    if (value.is_object()) {
+      // merge_patch never stores nulls nested in an object. published values
+      // are immutable, so the patch goes into a copy.
+      auto next = std::make_shared<json>(kind == FIELD_VALUE && cur->is_object()
+					 ? *cur : json::object());
+      next->merge_patch(value);
+      if (kind != FIELD_VALUE || *cur != *next) {
+	publish_locked(k, FIELD_VALUE, 0, next);
+      }
+    } else if (kind != FIELD_VALUE || *cur != value) {
+      publish_locked(k, FIELD_VALUE, 0, std::make_shared<const json>(value));
+    }
+  }
+}
+
+void State::apply_status_locked(const json &status) {
+  if (!status.is_object()) {
+    return;
+  }
+
+  for (const auto &o : status.items()) {
+    if (o.value().is_object()) {
+      for (const auto &f : o.value().items()) {
+	apply_locked(o.key(), f.key(), f.value());
+      }
+    } else if (o.value().is_null()) {
+      // whole object removed
+      const auto &fields = keys.find(o.key());
+      if (fields != keys.end()) {
+	for (const auto &f : fields->second) {
+	  if (get_slot(f.second)->kind.load(std::memory_order_relaxed) != FIELD_ABSENT) {
+	    publish_locked(f.second, FIELD_ABSENT, 0, nullptr);
+	  }
+	}
+      }
+    }
+  }
+}
+
+// brings the json view of printer_state up to date for get_data() readers
+void State::sync_printer_state_locked() {
+  if (dirty.empty()) {
+    return;
+  }
+
+  json &printer_state = data["printer_state"];
+  for (StateKey k : dirty) {
+    is_dirty[k] = false;
+    const Slot &s = *get_slot(k);
+    json &obj = printer_state[names[k].first];
+    uint32_t kind = s.kind.load(std::memory_order_relaxed);
+    if (kind == FIELD_ABSENT) {
+      if (obj.is_object()) {
+	obj.erase(names[k].second);
+      }
+    } else if (is_number(kind)) {
+      obj[names[k].second] = to_json(kind, load_bits(s));
+    } else {
+      obj[names[k].second] = *s.value;
+    }
   }
+  dirty.clear();
 }
 
 std::vector<std::string> State::get_extruders() {
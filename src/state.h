@@ -2,13 +2,82 @@
 #define __STATE_H__
 
 #include <mutex>
+#include <atomic>
+#include <memory>
 #include <vector>
+#include <string>
+#include <cstdint>
+#include <unordered_map>
 #include "notify_consumer.h"
 
+// interned printer_state object/field, stays valid across reset()
+typedef uint32_t StateKey;
+static const StateKey INVALID_STATE_KEY = UINT32_MAX;
+
 class State : public NotifyConsumer {
  private:
   static State *instance;
   static std::mutex lock;
+
+  enum FieldKind : uint32_t {
+    FIELD_ABSENT = 0,
+    // numbers, by their json type
+    FIELD_INTEGER,
+    FIELD_UNSIGNED,
+    FIELD_FLOAT,
+    FIELD_VALUE
+  };
+
+  // one printer_state object field. updates are serialized by lock, reads
+  // don't lock: seq is odd while an update is in progress and readers retry
+  // if it moved. numbers keep the bits of their json type (int64_t,
+  // uint64_t or double), split in halves so the slot stays lock-free on 32
+  // bit targets without 64 bit atomics. value is immutable once published
+  // and swapped with std::atomic_load/atomic_store.
+  struct Slot {
+    std::atomic<uint32_t> seq{0};
+    std::atomic<uint32_t> kind{FIELD_ABSENT};
+    std::atomic<uint32_t> number_lo{0};
+    std::atomic<uint32_t> number_hi{0};
+    std::shared_ptr<const json> value;
+  };
+
+  static const size_t SLOTS_PER_CHUNK = 64;
+  static const size_t MAX_CHUNKS = 256;
+
+  Slot *get_slot(StateKey k);
+  static bool is_number(uint32_t kind);
+  static uint64_t load_bits(const Slot &s);
+  // kind and bits of the slot, read consistently
+  static uint32_t read_number(const Slot &s, uint64_t &bits);
+  static double to_double(uint32_t kind, uint64_t bits);
+  static json to_json(uint32_t kind, uint64_t bits);
+
+  StateKey intern_locked(const std::string &object, const std::string &field);
+  void publish_locked(StateKey k, uint32_t kind, uint64_t bits,
+		      std::shared_ptr<const json> value);
+  void apply_locked(const std::string &object, const std::string &field, const json &value);
+  void apply_status_locked(const json &status);
+  void sync_printer_state_locked();
+
+  // printer_state lives in a typed store: one slot per object field,
+  // numbers kept unboxed with their json type, everything else (strings,
+  // arrays, objects) as json.
+  // slots are allocated in chunks that never move, so readers holding a key
+  // don't race with new fields being interned.
+  std::atomic<Slot *> chunks[MAX_CHUNKS];
+  std::atomic<uint32_t> slot_count;
+
+  // writer side, under lock
+  std::unordered_map<std::string, std::unordered_map<std::string, StateKey>> keys;
+  std::vector<std::pair<std::string, std::string>> names;
+  // slots changed since data["printer_state"] was last brought up to date
+  std::vector<StateKey> dirty;
+  std::vector<bool> is_dirty;
+
+  // everything but printer_state (printer_objs, roots, printer_info, ...),
+  // republished copy-on-write by set_data
+  std::shared_ptr<const json> snapshot;
   
  protected:
   json data;
@@ -20,10 +89,29 @@ class State : public NotifyConsumer {
 
   void reset();
   void set_data(const std::string &key, json &j, const std::string &json_path);
+  // compatibility json view. the reference outlives the lock, so it can race
+  // with updates; prefer the typed accessors and get_snapshot()
   json &get_data();
   json &get_data(const json::json_pointer &ptr);
 
   void consume(json &j);
+  void consume_status(const StatusUpdate &update);
+
+  // typed printer_state access. lookups by key neither lock, allocate nor
+  // insert, and are safe against the websocket thread updating the field.
+  StateKey key(const std::string &object, const std::string &field);
+  bool has(StateKey k);
+  // bumped every time the field changes value
+  uint64_t get_version(StateKey k);
+  double get_number(StateKey k, double def = 0);
+  // element idx of a numeric array field, e.g. gcode_move.gcode_position
+  double get_number(StateKey k, size_t idx, double def);
+  std::string get_string(StateKey k, const std::string &def = "");
+  // null if the field is absent
+  std::shared_ptr<const json> get_value(StateKey k);
+
+  // immutable view of the non printer_state data, readable without locking
+  std::shared_ptr<const json> get_snapshot();
 
   std::vector<std::string> get_extruders();
   std::vector<std::string> get_heaters();
@@ -0,0 +1,251 @@
+#include "status_registry.h"
+#include "spdlog/spdlog.h"
+
+#include <algorithm>
+
+StatusRegistry::StatusRegistry()
+  : path_count(0)
+  , queue(1024)
+  , overflow(false)
+  , gen(0)
+{
+  for (auto &c : path_chunks) {
+    c.store(NULL, std::memory_order_relaxed);
+  }
+}
+
+StatusRegistry::~StatusRegistry() {
+  for (auto &c : path_chunks) {
+    delete[] c.load(std::memory_order_relaxed);
+  }
+}
+
+void StatusRegistry::add(NotifyConsumer *consumer,
+			 const std::string &object,
+			 const std::string &field,
+			 StatusHandler handler) {
+  std::lock_guard<std::mutex> guard(lock);
+  auto sub = std::make_shared<Subscriber>(Subscriber{consumer, handler});
+  ObjectEntry &entry = objects[object];
+  if (field.empty()) {
+    entry.whole.push_back(sub);
+    return;
+  }
+
+  const auto &f = entry.fields.find(field);
+  if (f == entry.fields.end()) {
+    entry.fields.insert({field, slots.size()});
+    slots.push_back({sub});
+  } else {
+    slots[f->second].push_back(sub);
+  }
+}
+
+void StatusRegistry::remove(NotifyConsumer *consumer) {
+  std::lock_guard<std::mutex> guard(lock);
+  auto owned_by = [consumer](const std::shared_ptr<Subscriber> &s) {
+    return s->consumer == consumer;
+  };
+
+  for (auto &slot : slots) {
+    slot.erase(std::remove_if(slot.begin(), slot.end(), owned_by), slot.end());
+  }
+
+  for (auto &entry : objects) {
+    Slot &whole = entry.second.whole;
+    whole.erase(std::remove_if(whole.begin(), whole.end(), owned_by), whole.end());
+  }
+}
+
+void StatusRegistry::remove(NotifyConsumer *consumer, const std::string &object) {
+  std::lock_guard<std::mutex> guard(lock);
+  const auto &entry = objects.find(object);
+  if (entry == objects.end()) {
+    return;
+  }
+
+  auto owned_by = [consumer](const std::shared_ptr<Subscriber> &s) {
+    return s->consumer == consumer;
+  };
+
+  for (auto &f : entry->second.fields) {
+    Slot &slot = slots[f.second];
+    slot.erase(std::remove_if(slot.begin(), slot.end(), owned_by), slot.end());
+  }
+
+  Slot &whole = entry->second.whole;
+  whole.erase(std::remove_if(whole.begin(), whole.end(), owned_by), whole.end());
+}
+
+bool StatusRegistry::set_active(NotifyConsumer *consumer, bool active) {
+  std::lock_guard<std::mutex> guard(lock);
+  if (active) {
+    return inactive.erase(consumer) > 0;
+  }
+
+  return inactive.insert(consumer).second;
+}
+
+json StatusRegistry::get_subscription() {
+  std::lock_guard<std::mutex> guard(lock);
+  auto is_active = [this](const std::shared_ptr<Subscriber> &s) {
+    return inactive.find(s->consumer) == inactive.end();
+  };
+
+  json objs = json::object();
+  for (const auto &entry : objects) {
+    const Slot &whole = entry.second.whole;
+    if (std::any_of(whole.begin(), whole.end(), is_active)) {
+      objs[entry.first] = nullptr;
+      continue;
+    }
+
+    std::vector<std::string> fields;
+    for (const auto &f : entry.second.fields) {
+      const Slot &slot = slots[f.second];
+      if (std::any_of(slot.begin(), slot.end(), is_active)) {
+	fields.push_back(f.first);
+      }
+    }
+
+    if (!fields.empty()) {
+      // stable order so subscriptions can be compared
+      std::sort(fields.begin(), fields.end());
+      objs[entry.first] = fields;
+    }
+  }
+
+  return objs;
+}
+
+StatusRegistry::Path *StatusRegistry::get_path(uint32_t id) {
+  return &path_chunks[id / PATHS_PER_CHUNK].load(std::memory_order_acquire)[id % PATHS_PER_CHUNK];
+}
+
+// moonraker only sends what we subscribed to, so every field seen gets a
+// path, drain() skips the ones nobody registered for
+bool StatusRegistry::enqueue(const StatusUpdate &update) {
+  bool queued = false;
+  for (const auto &d : update) {
+    uint32_t id;
+    auto &fields = path_ids[d.object];
+    const auto &p = fields.find(d.field);
+    if (p == fields.end()) {
+      id = path_count.load(std::memory_order_relaxed);
+      if (id >= PATHS_PER_CHUNK * MAX_PATH_CHUNKS) {
+	spdlog::error("status registry full, dropping {}.{}", d.object, d.field);
+	continue;
+      }
+
+      if (id % PATHS_PER_CHUNK == 0) {
+	path_chunks[id / PATHS_PER_CHUNK].store(new Path[PATHS_PER_CHUNK], std::memory_order_release);
+      }
+
+      Path &path = *get_path(id);
+      path.object = d.object;
+      path.field = d.field;
+      fields.insert({d.field, id});
+      path_count.store(id + 1, std::memory_order_release);
+    } else {
+      id = p->second;
+    }
+
+    Path &path = *get_path(id);
+    if (!path.queued.exchange(true)) {
+      if (!queue.push(id)) {
+	path.queued = false;
+	overflow = true;
+      }
+      queued = true;
+    }
+  }
+
+  return queued;
+}
+
+void StatusRegistry::drain() {
+  drained.clear();
+  uint32_t id;
+  while (queue.pop(id)) {
+    drained.push_back(id);
+  }
+
+  bool resync = overflow.exchange(false);
+  if (drained.empty() && !resync) {
+    return;
+  }
+
+  State *state = State::get_instance();
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    if (resync) {
+      drained.clear();
+      uint32_t count = path_count.load(std::memory_order_acquire);
+      for (uint32_t i = 0; i < count; i++) {
+	drained.push_back(i);
+      }
+    }
+
+    gen++;
+    pending.clear();
+    touched.clear();
+    latest.clear();
+    // pending keeps pointers into latest, it must not reallocate
+    latest.reserve(drained.size());
+
+    for (uint32_t i : drained) {
+      Path &path = *get_path(i);
+      // cleared before reading, an update landing after this queues it again
+      path.queued = false;
+
+      if (path.entry == NULL) {
+	// objects entries are never erased, their addresses stay valid
+	const auto &o = objects.find(path.object);
+	if (o == objects.end()) {
+	  continue;
+	}
+	path.entry = &o->second;
+	path.state_key = state->key(path.object, path.field);
+      }
+
+      auto value = state->get_value(path.state_key);
+      latest.push_back(value ? *value : json());
+      const json &v = latest.back();
+
+      ObjectEntry &entry = *path.entry;
+      // null means the field went away, field handlers only see values
+      const auto &f = entry.fields.find(path.field);
+      if (f != entry.fields.end() && !v.is_null()) {
+	for (const auto &s : slots[f->second]) {
+	  if (s->handler) {
+	    pending.push_back({s, &v});
+	  }
+	}
+      }
+
+      if (!entry.whole.empty()) {
+	if (entry.changed_gen != gen) {
+	  entry.changed_gen = gen;
+	  entry.changed = json::object();
+	  touched.push_back(&entry);
+	}
+	entry.changed[path.field] = v;
+      }
+    }
+
+    for (const auto &entry : touched) {
+      for (const auto &s : entry->whole) {
+	if (s->handler) {
+	  pending.push_back({s, &entry->changed});
+	}
+      }
+    }
+  }
+
+  // handlers may (un)register, so they run without the registry lock
+  for (const auto &p : pending) {
+    p.sub->handler(*p.value);
+  }
+
+  pending.clear();
+}
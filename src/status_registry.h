@@ -0,0 +1,124 @@
+#ifndef __STATUS_REGISTRY_H__
+#define __STATUS_REGISTRY_H__
+
+#include "notify_consumer.h"
+#include "status_update.h"
+#include "spsc_queue.h"
+#include "state.h"
+
+#include <set>
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <vector>
+#include <functional>
+#include <unordered_map>
+
+typedef std::function<void(const json &)> StatusHandler;
+
+// Routes status deltas to consumers that registered interest in a specific
+// object field (e.g. extruder.temperature) or in a whole object (empty field,
+// the handler then gets an object of the fields changed since the last
+// drain). A null handler only records interest in the path, for consumers
+// that read it back from State.
+//
+// The websocket thread only enqueues the paths an update touched, it never
+// waits for the LVGL thread: it owns the interning of paths and hands their
+// ids over through the SPSC queue, without taking the registry lock. drain()
+// runs once per frame on the LVGL thread and hands each handler the latest
+// value of its path from State, so a field updated several times within a
+// frame reaches the widgets once.
+//
+// The registrations of active consumers also make up the set of fields
+// subscribed to from moonraker, consumers that are off screen can be marked
+// inactive to drop their fields from it.
+class StatusRegistry {
+ public:
+  StatusRegistry();
+  StatusRegistry(StatusRegistry &o) = delete;
+  ~StatusRegistry();
+  void operator=(const StatusRegistry &) = delete;
+
+  void add(NotifyConsumer *consumer,
+	   const std::string &object,
+	   const std::string &field,
+	   StatusHandler handler);
+  void remove(NotifyConsumer *consumer);
+  void remove(NotifyConsumer *consumer, const std::string &object);
+
+  // returns true if the consumer's state changed
+  bool set_active(NotifyConsumer *consumer, bool active);
+
+  // "objects" param of printer.objects.subscribe covering the active
+  // registrations, {object: [fields...]} or {object: null} for all fields
+  json get_subscription();
+
+  // websocket thread, after State consumed the update. returns true if
+  // drain() has new work. lock-free.
+  bool enqueue(const StatusUpdate &update);
+  // LVGL thread, with lv_lock held
+  void drain();
+
+ private:
+  struct Subscriber {
+    NotifyConsumer *consumer;
+    StatusHandler handler;
+  };
+
+  typedef std::vector<std::shared_ptr<Subscriber>> Slot;
+
+  struct ObjectEntry {
+    std::unordered_map<std::string, size_t> fields;
+    Slot whole;
+    // fields of this object changed since the last drain
+    json changed;
+    uint64_t changed_gen = 0;
+  };
+
+  // an object field seen in an update. object and field are written by the
+  // websocket thread before the path is published and never change.
+  struct Path {
+    std::string object;
+    std::string field;
+    // set while the path sits in the queue, so it's queued at most once
+    std::atomic_bool queued{false};
+    // resolved by drain(), LVGL thread only
+    ObjectEntry *entry = NULL;
+    StateKey state_key = INVALID_STATE_KEY;
+  };
+
+  static const size_t PATHS_PER_CHUNK = 64;
+  static const size_t MAX_PATH_CHUNKS = 64;
+
+  Path *get_path(uint32_t id);
+
+  struct Pending {
+    std::shared_ptr<Subscriber> sub;
+    const json *value;
+  };
+
+  std::mutex lock;
+  std::unordered_map<std::string, ObjectEntry> objects;
+  std::vector<Slot> slots;
+  std::set<NotifyConsumer *> inactive;
+
+  // paths live in chunks that never move, published by path_count, so
+  // drain() reads them while the websocket thread adds more
+  std::atomic<Path *> path_chunks[MAX_PATH_CHUNKS];
+  std::atomic<uint32_t> path_count;
+  // object -> field -> path id, websocket thread only
+  std::unordered_map<std::string, std::unordered_map<std::string, uint32_t>> path_ids;
+  SpscQueue<uint32_t> queue;
+  // the queue filled up, the next drain re-reads every path
+  std::atomic_bool overflow;
+
+  // drain() scratch, reused across frames
+  std::vector<uint32_t> drained;
+  std::vector<json> latest;
+  std::vector<Pending> pending;
+  std::vector<ObjectEntry *> touched;
+  uint64_t gen;
+};
+
+#endif // __STATUS_REGISTRY_H__
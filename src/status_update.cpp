@@ -0,0 +1,262 @@
+#include "status_update.h"
+
+#include <algorithm>
+#include <string_view>
+
+StatusUpdate::StatusUpdate()
+  : count(0)
+  , eventtime(0)
+  , legacy_valid(false)
+{
+}
+
+void StatusUpdate::clear() {
+  count = 0;
+  eventtime = 0;
+  legacy_valid = false;
+}
+
+StatusDelta &StatusUpdate::next() {
+  if (count == deltas.size()) {
+    deltas.emplace_back();
+  }
+
+  legacy_valid = false;
+  return deltas[count++];
+}
+
+void StatusUpdate::assign(const json &status) {
+  clear();
+  if (!status.is_object()) {
+    return;
+  }
+
+  for (const auto &o : status.items()) {
+    if (!o.value().is_object()) {
+      continue;
+    }
+
+    for (const auto &f : o.value().items()) {
+      StatusDelta &d = next();
+      d.object.assign(o.key());
+      d.field.assign(f.key());
+      d.value = f.value();
+    }
+  }
+}
+
+size_t StatusUpdate::size() const {
+  return count;
+}
+
+bool StatusUpdate::empty() const {
+  return count == 0;
+}
+
+const StatusDelta &StatusUpdate::operator[](size_t i) const {
+  return deltas[i];
+}
+
+std::vector<StatusDelta>::const_iterator StatusUpdate::begin() const {
+  return deltas.begin();
+}
+
+std::vector<StatusDelta>::const_iterator StatusUpdate::end() const {
+  return deltas.begin() + count;
+}
+
+double StatusUpdate::get_eventtime() const {
+  return eventtime;
+}
+
+void StatusUpdate::set_eventtime(double t) {
+  eventtime = t;
+  legacy_valid = false;
+}
+
+json &StatusUpdate::to_json() const {
+  if (!legacy_valid) {
+    json status = json::object();
+    for (const auto &d : *this) {
+      status[d.object][d.field] = d.value;
+    }
+
+    legacy = {
+      { "jsonrpc", "2.0" },
+      { "method", "notify_status_update" },
+      { "params", json::array() }
+    };
+    legacy["params"].push_back(std::move(status));
+    legacy["params"].push_back(eventtime);
+    legacy_valid = true;
+  }
+
+  return legacy;
+}
+
+StatusUpdateParser::StatusUpdateParser()
+  : depth(0)
+  , params_idx(0)
+  , is_status(false)
+{
+}
+
+bool StatusUpdateParser::is_status_update(const std::string &msg) {
+  std::string_view prefix(msg.data(), std::min<size_t>(msg.size(), 64));
+  return prefix.find("\"notify_status_update\"") != std::string_view::npos;
+}
+
+bool StatusUpdateParser::parse(const std::string &msg) {
+  update.clear();
+  depth = 0;
+  top_key.clear();
+  params_idx = 0;
+  is_status = false;
+  nested.clear();
+
+  bool ok = json::sax_parse(msg, this);
+  nested.clear();
+  return ok && is_status;
+}
+
+const StatusUpdate &StatusUpdateParser::get_update() const {
+  return update;
+}
+
+bool StatusUpdateParser::null() {
+  return value(json());
+}
+
+bool StatusUpdateParser::boolean(bool v) {
+  return value(json(v));
+}
+
+bool StatusUpdateParser::number_integer(number_integer_t v) {
+  return value(json(v));
+}
+
+bool StatusUpdateParser::number_unsigned(number_unsigned_t v) {
+  return value(json(v));
+}
+
+bool StatusUpdateParser::number_float(number_float_t v, const string_t &s) {
+  return value(json(v));
+}
+
+bool StatusUpdateParser::string(string_t &v) {
+  if (nested.empty() && depth == 1 && top_key == "method") {
+    is_status = v == "notify_status_update";
+    return true;
+  }
+
+  return value(json(std::move(v)));
+}
+
+bool StatusUpdateParser::binary(binary_t &v) {
+  // not produced by the text parser
+  return true;
+}
+
+bool StatusUpdateParser::start_object(std::size_t n) {
+  return start_container(json::object());
+}
+
+bool StatusUpdateParser::key(string_t &v) {
+  if (!nested.empty()) {
+    nested_key = std::move(v);
+  } else if (depth == 1) {
+    top_key = std::move(v);
+  } else if (depth == 3) {
+    cur_object = std::move(v);
+  } else if (depth == 4) {
+    cur_field = std::move(v);
+  }
+
+  return true;
+}
+
+bool StatusUpdateParser::end_object() {
+  return end_container();
+}
+
+bool StatusUpdateParser::start_array(std::size_t n) {
+  return start_container(json::array());
+}
+
+bool StatusUpdateParser::end_array() {
+  return end_container();
+}
+
+bool StatusUpdateParser::parse_error(std::size_t pos,
+				     const std::string &token,
+				     const nlohmann::detail::exception &e) {
+  return false;
+}
+
+// depth 1: message, 2: params array, 3: status object (params[0]),
+// 4: fields of a printer object, 5+: values nested below a field
+bool StatusUpdateParser::value(json &&v) {
+  if (!nested.empty()) {
+    json &parent = *nested.back();
+    if (parent.is_object()) {
+      parent[nested_key] = std::move(v);
+    } else {
+      parent.push_back(std::move(v));
+    }
+    return true;
+  }
+
+  if (depth == 2 && top_key == "params") {
+    if (params_idx == 1 && v.is_number()) {
+      update.set_eventtime(v.get<double>());
+    }
+    params_idx++;
+  } else if (depth == 4 && top_key == "params" && params_idx == 0) {
+    StatusDelta &d = update.next();
+    d.object.assign(cur_object);
+    d.field.assign(cur_field);
+    d.value = std::move(v);
+  }
+
+  return true;
+}
+
+bool StatusUpdateParser::start_container(json &&c) {
+  if (!nested.empty()) {
+    json &parent = *nested.back();
+    if (parent.is_object()) {
+      json &child = parent[nested_key];
+      child = std::move(c);
+      nested.push_back(&child);
+    } else {
+      parent.push_back(std::move(c));
+      nested.push_back(&parent.back());
+    }
+  } else if (depth == 4 && top_key == "params" && params_idx == 0) {
+    StatusDelta &d = update.next();
+    d.object.assign(cur_object);
+    d.field.assign(cur_field);
+    d.value = std::move(c);
+    nested.push_back(&d.value);
+  }
+
+  depth++;
+  return true;
+}
+
+bool StatusUpdateParser::end_container() {
+  if (depth == 0) {
+    return false;
+  }
+
+  depth--;
+  if (!nested.empty()) {
+    nested.pop_back();
+  }
+
+  if (depth == 2 && top_key == "params") {
+    params_idx++;
+  }
+
+  return true;
+}
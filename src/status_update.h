@@ -0,0 +1,99 @@
+#ifndef __STATUS_UPDATE_H__
+#define __STATUS_UPDATE_H__
+
+#include "hv/json.hpp"
+
+#include <string>
+#include <vector>
+
+using json = nlohmann::json;
+
+// one changed field of a printer object, e.g. ("extruder", "temperature", 210.3)
+struct StatusDelta {
+  std::string object;
+  std::string field;
+  json value;
+};
+
+// flat view over the deltas carried by a single notify_status_update
+class StatusUpdate {
+ public:
+  StatusUpdate();
+
+  void clear();
+  StatusDelta &next();
+
+  // replace the deltas with the fields of a {object: {field: value}} status,
+  // as returned by printer.objects.query and printer.objects.subscribe
+  void assign(const json &status);
+
+  size_t size() const;
+  bool empty() const;
+  const StatusDelta &operator[](size_t i) const;
+  std::vector<StatusDelta>::const_iterator begin() const;
+  std::vector<StatusDelta>::const_iterator end() const;
+
+  double get_eventtime() const;
+  void set_eventtime(double t);
+
+  // legacy {"method": ..., "params": [{obj: {field: value}}, eventtime]} view,
+  // built lazily at most once per update for consumers that still walk json
+  json &to_json() const;
+
+ private:
+  // entries past count are kept around so their buffers get reused
+  std::vector<StatusDelta> deltas;
+  size_t count;
+  double eventtime;
+  mutable json legacy;
+  mutable bool legacy_valid;
+};
+
+// SAX handler turning a notify_status_update frame into a StatusUpdate
+// without building a DOM for the whole message. Only values nested below a
+// field (arrays like homing_origin, objects like bed_mesh profiles) are
+// materialized, and only for the field that carries them.
+class StatusUpdateParser : public nlohmann::json_sax<json> {
+ public:
+  StatusUpdateParser();
+
+  // cheap check on the frame prefix, moonraker puts "method" right after "jsonrpc"
+  static bool is_status_update(const std::string &msg);
+
+  // returns false if msg is malformed or not a notify_status_update
+  bool parse(const std::string &msg);
+  const StatusUpdate &get_update() const;
+
+  bool null() override;
+  bool boolean(bool v) override;
+  bool number_integer(number_integer_t v) override;
+  bool number_unsigned(number_unsigned_t v) override;
+  bool number_float(number_float_t v, const string_t &s) override;
+  bool string(string_t &v) override;
+  bool binary(binary_t &v) override;
+  bool start_object(std::size_t n) override;
+  bool key(string_t &v) override;
+  bool end_object() override;
+  bool start_array(std::size_t n) override;
+  bool end_array() override;
+  bool parse_error(std::size_t pos,
+		   const std::string &token,
+		   const nlohmann::detail::exception &e) override;
+
+ private:
+  bool value(json &&v);
+  bool start_container(json &&c);
+  bool end_container();
+
+  StatusUpdate update;
+  size_t depth;
+  std::string top_key;
+  size_t params_idx;
+  bool is_status;
+  std::string cur_object;
+  std::string cur_field;
+  std::string nested_key;
+  std::vector<json *> nested;
+};
+
+#endif // __STATUS_UPDATE_H__
@@ -4,6 +4,7 @@
 #include "theme.h"
 #include "spdlog/spdlog.h"
 #include "guppyscreen.h"
+#include "image_cache.h"
 
 #include <algorithm>
 #include <iterator>
@@ -55,6 +56,18 @@ static const SleepOption sleep_options[] = {
   {"1 Hour", 3600}
 };
 
+struct RefreshOption {
+  const char *label;
+  uint32_t ms;
+};
+
+static const RefreshOption refresh_options[] = {
+  {"Full Rate", 0},
+  {"10 Hz", 100},
+  {"4 Hz", 250},
+  {"1 Hz", 1000}
+};
+
 SysInfoPanel::SysInfoPanel()
   : cont(lv_obj_create(lv_scr_act()))
   , left_cont(lv_obj_create(cont))
@@ -65,6 +78,10 @@ SysInfoPanel::SysInfoPanel()
   , disp_sleep_cont(lv_obj_create(left_cont))
   , display_sleep_dd(lv_dropdown_create(disp_sleep_cont))
 
+  // idle refresh rate
+  , idle_refresh_cont(lv_obj_create(left_cont))
+  , idle_refresh_dd(lv_dropdown_create(idle_refresh_cont))
+
   // log level
   , ll_cont(lv_obj_create(left_cont))
   , loglevel_dd(lv_dropdown_create(ll_cont))
@@ -131,6 +148,34 @@ SysInfoPanel::SysInfoPanel()
   lv_obj_add_event_cb(display_sleep_dd, &SysInfoPanel::_handle_callback,
     LV_EVENT_VALUE_CHANGED, this);
 
+  lv_obj_set_size(idle_refresh_cont, LV_PCT(100), LV_SIZE_CONTENT);
+  lv_obj_set_style_pad_all(idle_refresh_cont, 0, 0);
+  l = lv_label_create(idle_refresh_cont);
+  lv_label_set_text(l, "Idle Refresh");
+  lv_obj_align(l, LV_ALIGN_LEFT_MID, 0, 0);
+  lv_obj_align(idle_refresh_dd, LV_ALIGN_RIGHT_MID, 0, 0);
+
+  dd_options.clear();
+  for (const auto &opt : refresh_options) {
+    dd_options += opt.label;
+    dd_options += '\n';
+  }
+  dd_options.pop_back();
+
+  lv_dropdown_set_options(idle_refresh_dd, dd_options.c_str());
+
+  v = conf->get_json("/idle_refresh_ms");
+  uint32_t refresh_ms = v.is_number_unsigned() ? v.template get<uint32_t>() : IDLE_REFRESH_DEFAULT_MS;
+  for (size_t i = 0; i < std::size(refresh_options); ++i) {
+    if (refresh_options[i].ms == refresh_ms) {
+      lv_dropdown_set_selected(idle_refresh_dd, i);
+      break;
+    }
+  }
+
+  lv_obj_add_event_cb(idle_refresh_dd, &SysInfoPanel::_handle_callback,
+    LV_EVENT_VALUE_CHANGED, this);
+
   lv_obj_set_size(ll_cont, LV_PCT(100), LV_SIZE_CONTENT);
   lv_obj_set_style_pad_all(ll_cont, 0, 0);
   l = lv_label_create(ll_cont);
@@ -247,8 +292,13 @@ void SysInfoPanel::foreground() {
     auto ip = KUtils::interface_ip(iface);
     network_detail.push_back(fmt::format("\t{}: {}", iface, ip));
   }
-  lv_label_set_text(network_label, fmt::format("{}\n\nGuppyScreen\n\tVersion: " GS_VERSION,
-    fmt::join(network_detail, "\n")).c_str());
+  ImageCache::Stats images = ImageCache::get_instance()->get_stats();
+  uint64_t lookups = images.hits + images.misses;
+  lv_label_set_text(network_label, fmt::format("{}\n\nGuppyScreen\n\tVersion: " GS_VERSION
+    "\n\tImage Cache: {} / {} KB, {} KB pinned\n\t\t{}% hits, {} evicted",
+    fmt::join(network_detail, "\n"),
+    images.used / 1024, images.budget / 1024, images.pinned / 1024,
+    lookups > 0 ? images.hits * 100 / lookups : 0, images.evictions).c_str());
 }
 
 void SysInfoPanel::handle_callback(lv_event_t *e)
@@ -290,9 +340,17 @@ void SysInfoPanel::handle_callback(lv_event_t *e)
         if (opt.label == selected_label) {
           conf->set<int32_t>("/display_sleep_sec", opt.seconds);
           conf->save();
+          GuppyScreen::set_display_sleep(opt.seconds);
           break;
         }
       }
+    } else if (obj == idle_refresh_dd) {
+      uint32_t idx = lv_dropdown_get_selected(idle_refresh_dd);
+      if (idx < std::size(refresh_options)) {
+        conf->set<uint32_t>("/idle_refresh_ms", refresh_options[idx].ms);
+        conf->save();
+        GuppyScreen::set_idle_refresh(refresh_options[idx].ms);
+      }
     } else if (obj == z_icon_toggle) {
       bool inverted = lv_obj_has_state(z_icon_toggle, LV_STATE_CHECKED);
       conf->set<bool>("/invert_z_direction", inverted);
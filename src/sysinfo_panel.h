@@ -29,6 +29,9 @@ class SysInfoPanel {
   lv_obj_t *disp_sleep_cont;
   lv_obj_t *display_sleep_dd;
 
+  lv_obj_t *idle_refresh_cont;
+  lv_obj_t *idle_refresh_dd;
+
   lv_obj_t *ll_cont;
   lv_obj_t *loglevel_dd;
   uint32_t loglevel;
@@ -0,0 +1,460 @@
+#include "thumbnail_loader.h"
+#include "image_bin.h"
+#include "image_cache.h"
+#include "hv/requests.h"
+#include "lvgl/src/extra/libs/png/lodepng.h"
+#include "spdlog/spdlog.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#ifdef __APPLE__
+#include <filesystem>
+namespace fs = std::filesystem;
+#else
+#include <experimental/filesystem>
+namespace fs = std::experimental::filesystem;
+#endif
+
+namespace {
+
+// source pixels and weights making up one output pixel
+struct Taps {
+  uint32_t first;
+  std::vector<float> weights;
+};
+
+// tent filter, as wide as the source pixels an output pixel covers when
+// shrinking (so every source pixel contributes) and bilinear when enlarging
+std::vector<Taps> taps(uint32_t src, uint32_t dst) {
+  float scale = (float)dst / src;
+  float support = scale < 1 ? 1 / scale : 1;
+
+  std::vector<Taps> out(dst);
+  for (uint32_t o = 0; o < dst; o++) {
+    float center = (o + 0.5f) / scale - 0.5f;
+    int32_t lo = std::max<int32_t>(0, (int32_t)std::ceil(center - support));
+    int32_t hi = std::min<int32_t>(src - 1, (int32_t)std::floor(center + support));
+
+    Taps &t = out[o];
+    float sum = 0;
+    for (int32_t i = lo; i <= hi; i++) {
+      float w = std::max(0.0f, 1 - std::fabs(i - center) / support);
+      t.weights.push_back(w);
+      sum += w;
+    }
+
+    if (sum > 0) {
+      t.first = lo;
+      for (float &w : t.weights) {
+	w /= sum;
+      }
+    } else {
+      // center sits on the edge of the image
+      t.first = std::min<uint32_t>(src - 1, std::max<int32_t>(0, std::lround(center)));
+      t.weights.assign(1, 1.0f);
+    }
+  }
+  return out;
+}
+
+// sw x sh RGBA to dw x dh premultiplied RGBA, a pass per axis
+void resample(const uint8_t *rgba, uint32_t sw, uint32_t sh,
+	      uint32_t dw, uint32_t dh, std::vector<float> &out) {
+  std::vector<float> src((size_t)sw * sh * 4);
+  for (size_t i = 0; i < (size_t)sw * sh; i++) {
+    float a = rgba[i * 4 + 3] / 255.0f;
+    for (int c = 0; c < 3; c++) {
+      src[i * 4 + c] = rgba[i * 4 + c] * a;
+    }
+    src[i * 4 + 3] = a;
+  }
+
+  std::vector<Taps> tx = taps(sw, dw);
+  std::vector<float> rows((size_t)dw * sh * 4, 0.0f);
+  for (uint32_t y = 0; y < sh; y++) {
+    const float *s = &src[(size_t)y * sw * 4];
+    float *d = &rows[(size_t)y * dw * 4];
+    for (uint32_t x = 0; x < dw; x++) {
+      const Taps &t = tx[x];
+      for (size_t k = 0; k < t.weights.size(); k++) {
+	const float *p = s + (t.first + k) * 4;
+	for (int c = 0; c < 4; c++) {
+	  d[x * 4 + c] += p[c] * t.weights[k];
+	}
+      }
+    }
+  }
+
+  std::vector<Taps> ty = taps(sh, dh);
+  out.assign((size_t)dw * dh * 4, 0.0f);
+  for (uint32_t y = 0; y < dh; y++) {
+    const Taps &t = ty[y];
+    float *d = &out[(size_t)y * dw * 4];
+    for (size_t k = 0; k < t.weights.size(); k++) {
+      const float *s = &rows[(size_t)(t.first + k) * dw * 4];
+      float w = t.weights[k];
+      for (size_t i = 0; i < (size_t)dw * 4; i++) {
+	d[i] += s[i] * w;
+      }
+    }
+  }
+}
+
+}  // namespace
+
+Thumbnail::Thumbnail(const std::string &k, const uint8_t *bin)
+  : key(k)
+{
+  memset(&dsc, 0, sizeof(dsc));
+  memcpy(&dsc.header, bin, sizeof(dsc.header));
+  dsc.data_size = (size_t)dsc.header.w * dsc.header.h * LV_IMG_PX_SIZE_ALPHA_BYTE;
+  dsc.data = bin + sizeof(dsc.header);
+}
+
+Thumbnail::~Thumbnail() {
+  lv_img_cache_invalidate_src(&dsc);
+  ImageCache::get_instance()->release(key);
+}
+
+ThumbnailLoader *ThumbnailLoader::instance = NULL;
+
+ThumbnailLoader::ThumbnailLoader()
+  : lv_lock(NULL)
+  , budget(0)
+  , scanned(false)
+  , used(0)
+  , stopping(false)
+  , next_seq(0)
+{
+}
+
+ThumbnailLoader::~ThumbnailLoader() {
+  {
+    std::lock_guard<std::mutex> l(lock);
+    stopping = true;
+  }
+  wake.notify_all();
+
+  if (worker.joinable()) {
+    worker.join();
+  }
+}
+
+ThumbnailLoader *ThumbnailLoader::get_instance() {
+  if (instance == NULL) {
+    instance = new ThumbnailLoader();
+  }
+  return instance;
+}
+
+void ThumbnailLoader::start(std::mutex &l, const std::string &dir, size_t b) {
+  if (worker.joinable()) {
+    return;
+  }
+
+  lv_lock = &l;
+  cache_dir = dir;
+  budget = b;
+  spdlog::debug("thumbnail cache {}, {} KB", cache_dir, budget / 1024);
+  worker = std::thread(&ThumbnailLoader::work, this);
+}
+
+void ThumbnailLoader::load(const void *owner,
+			   const KUtils::ThumbnailSource &src,
+			   uint32_t w,
+			   uint32_t h,
+			   loaded_cb done) {
+  {
+    std::lock_guard<std::mutex> l(lock);
+    drop_queued(owner);
+    uint64_t seq = ++next_seq;
+    current[owner] = seq;
+    queue.push_back({owner, seq, src, w, h, done});
+  }
+  wake.notify_one();
+}
+
+void ThumbnailLoader::cancel(const void *owner) {
+  std::lock_guard<std::mutex> l(lock);
+  drop_queued(owner);
+  current.erase(owner);
+}
+
+// lock held
+void ThumbnailLoader::drop_queued(const void *owner) {
+  queue.erase(std::remove_if(queue.begin(), queue.end(),
+			     [owner](const Job &j) { return j.owner == owner; }),
+	      queue.end());
+}
+
+bool ThumbnailLoader::is_current(const Job &job) {
+  std::lock_guard<std::mutex> l(lock);
+  const auto &c = current.find(job.owner);
+  return c != current.end() && c->second == job.seq;
+}
+
+void ThumbnailLoader::work() {
+  while (true) {
+    Job job;
+    {
+      std::unique_lock<std::mutex> l(lock);
+      wake.wait(l, [this] { return stopping || !queue.empty(); });
+      if (stopping) {
+	return;
+      }
+      job = std::move(queue.front());
+      queue.pop_front();
+    }
+
+    std::shared_ptr<Thumbnail> thumb = fetch(job);
+
+    std::lock_guard<std::mutex> lv(*lv_lock);
+    bool deliver = false;
+    {
+      std::lock_guard<std::mutex> l(lock);
+      const auto &c = current.find(job.owner);
+      if (c != current.end() && c->second == job.seq) {
+	current.erase(c);
+	deliver = true;
+      }
+    }
+    if (deliver) {
+      job.done(thumb);
+    }
+    // ours is the last reference if it wasn't shown
+    thumb.reset();
+  }
+}
+
+std::shared_ptr<Thumbnail> ThumbnailLoader::fetch(const Job &job) {
+  std::string name = cache_path(job);
+  std::string key = "thumb:" + name;
+  ImageCache *cache = ImageCache::get_instance();
+
+  // shown elsewhere or recently
+  const uint8_t *bin = cache->acquire(key);
+  if (bin != NULL) {
+    return std::make_shared<Thumbnail>(key, bin);
+  }
+
+  size_t size = 0;
+  uint8_t *data = NULL;
+  if (budget > 0 && job.w > 0 && job.h > 0) {
+    data = read_cached(name, size);
+  }
+
+  if (data == NULL) {
+    if (!job.src.url.empty() && job.src.key != fetched) {
+      spdlog::debug("thumb url {}", job.src.url);
+      auto downloaded = requests::downloadFile(job.src.url.c_str(), job.src.path.c_str());
+      spdlog::trace("downloaded size {}", downloaded);
+      fetched = downloaded > 0 ? job.src.key : "";
+    }
+
+    // the owner may have moved on while this was downloading
+    if (!is_current(job)) {
+      return NULL;
+    }
+
+    data = decode(job.src.path, job.w, job.h, size);
+    if (data == NULL) {
+      return NULL;
+    }
+    if (budget > 0 && job.w > 0 && job.h > 0) {
+      save_cached(name, data, size);
+    }
+  }
+
+  return std::make_shared<Thumbnail>(key, cache->insert(key, data, size));
+}
+
+uint8_t *ThumbnailLoader::decode(const std::string &path, uint32_t w, uint32_t h, size_t &size) {
+  std::ifstream f(path, std::ios::binary);
+  if (!f) {
+    spdlog::warn("failed to open thumbnail {}", path);
+    return NULL;
+  }
+  std::vector<uint8_t> png((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+
+  unsigned char *rgba = NULL;
+  unsigned sw = 0;
+  unsigned sh = 0;
+  unsigned err = lodepng_decode32(&rgba, &sw, &sh, png.data(), png.size());
+  if (err != 0 || sw == 0 || sh == 0) {
+    spdlog::warn("failed to decode thumbnail {}: {}", path, err != 0 ? lodepng_error_text(err) : "empty");
+    lv_mem_free(rgba);
+    return NULL;
+  }
+
+  // fit w x h, keeping the aspect ratio
+  if (w == 0 || h == 0) {
+    w = sw;
+    h = sh;
+  } else {
+    double scale = std::min((double)w / sw, (double)h / sh);
+    w = std::max<uint32_t>(1, std::lround(sw * scale));
+    h = std::max<uint32_t>(1, std::lround(sh * scale));
+  }
+  if (w > IMAGE_BIN_MAX_SIZE || h > IMAGE_BIN_MAX_SIZE) {
+    spdlog::warn("thumbnail {} too large at {}x{}", path, w, h);
+    lv_mem_free(rgba);
+    return NULL;
+  }
+
+  std::vector<float> px;
+  if (w != sw || h != sh) {
+    resample(rgba, sw, sh, w, h, px);
+  } else {
+    px.resize((size_t)w * h * 4);
+    for (size_t i = 0; i < px.size(); i += 4) {
+      float a = rgba[i + 3] / 255.0f;
+      for (int c = 0; c < 3; c++) {
+	px[i + c] = rgba[i + c] * a;
+      }
+      px[i + 3] = a;
+    }
+  }
+  lv_mem_free(rgba);
+
+  lv_img_header_t header;
+  memset(&header, 0, sizeof(header));
+  header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+  header.w = w;
+  header.h = h;
+
+  size_t n = (size_t)w * h;
+  size = sizeof(header) + n * LV_IMG_PX_SIZE_ALPHA_BYTE;
+  uint8_t *bin = (uint8_t *)lv_mem_alloc(size);
+  if (bin == NULL) {
+    return NULL;
+  }
+  memcpy(bin, &header, sizeof(header));
+  ImageBin::unpremultiply(px.data(), n, bin + sizeof(header));
+
+  spdlog::trace("decoded thumbnail {} {}x{} at {}x{}", path, sw, sh, w, h);
+  return bin;
+}
+
+// one file per gcode file version, size and color format, in LVGL's .bin
+// layout
+std::string ThumbnailLoader::cache_path(const Job &job) const {
+  char name[64];
+  snprintf(name, sizeof(name), "%08x_%ux%u_%d%s.bin", ImageBin::hash(job.src.key.data(), job.src.key.size()), job.w, job.h,
+	   LV_COLOR_DEPTH, LV_COLOR_16_SWAP ? "s" : "");
+  return name;
+}
+
+uint8_t *ThumbnailLoader::read_cached(const std::string &name, size_t &size) {
+  scan_cache();
+  auto f = files.find(name);
+  if (f == files.end()) {
+    return NULL;
+  }
+
+  std::string path = (fs::path(cache_dir) / name).string();
+  FILE *in = fopen(path.c_str(), "rb");
+  if (in == NULL) {
+    return NULL;
+  }
+
+  lv_img_header_t header;
+  uint8_t *bin = NULL;
+  bool ok = fread(&header, sizeof(header), 1, in) == 1
+    && header.cf == LV_IMG_CF_TRUE_COLOR_ALPHA
+    && header.w > 0 && header.h > 0;
+  if (ok) {
+    size = sizeof(header) + (size_t)header.w * header.h * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    bin = (uint8_t *)lv_mem_alloc(size);
+    ok = bin != NULL
+      && fread(bin + sizeof(header), 1, size - sizeof(header), in) == size - sizeof(header);
+  }
+  fclose(in);
+  if (!ok) {
+    lv_mem_free(bin);
+    return NULL;
+  }
+  memcpy(bin, &header, sizeof(header));
+
+  // the modified time orders the files for the next scan
+  lru.splice(lru.begin(), lru, f->second.second);
+  std::error_code ec;
+  fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+
+  spdlog::trace("cached thumbnail {} {}x{}", name, header.w, header.h);
+  return bin;
+}
+
+void ThumbnailLoader::save_cached(const std::string &name, const uint8_t *bin, size_t size) {
+  scan_cache();
+  std::error_code ec;
+  fs::create_directories(cache_dir, ec);
+
+  lv_img_header_t header;
+  memcpy(&header, bin, sizeof(header));
+  std::string path = (fs::path(cache_dir) / name).string();
+  if (!ImageBin::save(path, header, bin + sizeof(header), size - sizeof(header))) {
+    spdlog::debug("thumbnail: can't write {}", path);
+    return;
+  }
+
+  auto f = files.find(name);
+  if (f != files.end()) {
+    used -= f->second.first;
+    lru.erase(f->second.second);
+    files.erase(f);
+  }
+  lru.push_front(name);
+  files[name] = std::make_pair(size, lru.begin());
+  used += size;
+  evict();
+}
+
+// picks up what previous runs left in cache_dir
+void ThumbnailLoader::scan_cache() {
+  if (scanned) {
+    return;
+  }
+  scanned = true;
+
+  std::vector<std::pair<fs::file_time_type, std::string>> found;
+  std::error_code ec;
+  for (fs::directory_iterator it(cache_dir, ec), end; !ec && it != end; it.increment(ec)) {
+    const fs::path &p = it->path();
+    if (p.extension() != ".bin" || !fs::is_regular_file(p, ec)) {
+      continue;
+    }
+    found.emplace_back(fs::last_write_time(p, ec), p.filename().string());
+  }
+
+  // newest first
+  std::sort(found.begin(), found.end(),
+	    [](const std::pair<fs::file_time_type, std::string> &a,
+	       const std::pair<fs::file_time_type, std::string> &b) { return a.first > b.first; });
+  for (const auto &f : found) {
+    size_t size = fs::file_size(fs::path(cache_dir) / f.second, ec);
+    if (ec) {
+      continue;
+    }
+    lru.push_back(f.second);
+    files[f.second] = std::make_pair(size, std::prev(lru.end()));
+    used += size;
+  }
+  evict();
+}
+
+// the newest file stays even if it is over budget on its own
+void ThumbnailLoader::evict() {
+  while (used > budget && lru.size() > 1) {
+    const std::string name = lru.back();
+    std::error_code ec;
+    fs::remove(fs::path(cache_dir) / name, ec);
+    used -= files[name].first;
+    files.erase(name);
+    lru.pop_back();
+    spdlog::trace("evicted thumbnail {}", name);
+  }
+}
@@ -0,0 +1,128 @@
+#ifndef __THUMBNAIL_LOADER_H__
+#define __THUMBNAIL_LOADER_H__
+
+#include "lvgl/lvgl.h"
+#include "utils.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// a few screens' worth of thumbnails at 800x480
+#define THUMBNAIL_CACHE_DEFAULT (8 * 1024 * 1024)
+
+// A decoded thumbnail, LV_IMG_CF_TRUE_COLOR_ALPHA at the build's color
+// depth, for use as an lv_img source. Only dropped with lv_lock held, after
+// the widgets showing it got another source: freeing it drops it from LVGL's
+// image cache, which is keyed by the dsc address.
+//
+// The pixels are a reference to key's buffer in the ImageCache, laid out as
+// an LVGL .bin file.
+struct Thumbnail {
+  Thumbnail(const std::string &key, const uint8_t *bin);
+  ~Thumbnail();
+
+  std::string key;
+  lv_img_dsc_t dsc;
+};
+
+// Fetches (when moonraker is remote) and decodes gcode thumbnails on a
+// worker thread, so selecting a file doesn't stall the UI for an HTTP
+// download and a PNG decode.
+//
+// Thumbnails are resampled to the size they are shown at, so widgets blit
+// them 1:1 instead of zooming them on every redraw. The result is kept in
+// cache_dir as an LVGL .bin file, keyed by gcode file, modified time, size
+// and color format: showing it again is a file read, without a download or
+// PNG decode. The cache is trimmed to budget bytes, least recently used
+// first. Decoded thumbnails go through the ImageCache, so owners showing the
+// same file at the same size share a buffer and one shown recently comes
+// back without touching the disk.
+//
+// Requests are made per owner, a widget or panel showing one thumbnail at a
+// time. A new request replaces the owner's previous one: if that is still
+// queued it is dropped, if it is being fetched its result is discarded.
+class ThumbnailLoader {
+ private:
+  static ThumbnailLoader *instance;
+  ThumbnailLoader();
+
+ public:
+  ThumbnailLoader(ThumbnailLoader &o) = delete;
+  void operator=(const ThumbnailLoader &) = delete;
+  ~ThumbnailLoader();
+
+  static ThumbnailLoader *get_instance();
+
+  // run with lv_lock held, NULL when the thumbnail couldn't be loaded
+  typedef std::function<void(std::shared_ptr<Thumbnail>)> loaded_cb;
+
+  // lv_lock is held when results are handed back
+  void start(std::mutex &lv_lock, const std::string &cache_dir, size_t budget);
+
+  // loads src scaled to fit w x h, its own size if either is 0
+  void load(const void *owner, const KUtils::ThumbnailSource &src,
+	    uint32_t w, uint32_t h, loaded_cb done);
+
+  // forgets the owner's request, done won't be called
+  void cancel(const void *owner);
+
+ private:
+  struct Job {
+    const void *owner;
+    uint64_t seq;
+    KUtils::ThumbnailSource src;
+    uint32_t w;
+    uint32_t h;
+    loaded_cb done;
+  };
+
+  void work();
+  std::shared_ptr<Thumbnail> fetch(const Job &job);
+  bool is_current(const Job &job);
+  void drop_queued(const void *owner);
+  // .bin layout buffers from lv_mem_alloc
+  static uint8_t *decode(const std::string &path, uint32_t w, uint32_t h, size_t &size);
+
+  // disk cache, worker thread only
+  std::string cache_path(const Job &job) const;
+  uint8_t *read_cached(const std::string &name, size_t &size);
+  void save_cached(const std::string &name, const uint8_t *bin, size_t size);
+  void scan_cache();
+  void evict();
+
+  std::mutex *lv_lock;
+  std::string cache_dir;
+  size_t budget;
+  bool scanned;
+  size_t used;
+  // file name to size, most recently used first
+  std::unordered_map<std::string, std::pair<size_t, std::list<std::string>::iterator>> files;
+  std::list<std::string> lru;
+  // key of the last png downloaded, owners showing the same file at
+  // different sizes fetch it once
+  std::string fetched;
+
+  std::thread worker;
+  std::mutex lock;
+  std::condition_variable wake;
+  bool stopping;
+
+  // guarded by lock
+  std::deque<Job> queue;
+  // the latest request of each owner
+  std::map<const void *, uint64_t> current;
+  uint64_t next_seq;
+};
+
+#endif // __THUMBNAIL_LOADER_H__
@@ -50,7 +50,13 @@ TmcStatusPanel::TmcStatusPanel(KWebSocketClient &c,
   lv_obj_add_flag(back_btn.get_container(), LV_OBJ_FLAG_FLOATING);  
   lv_obj_align(back_btn.get_container(), LV_ALIGN_BOTTOM_RIGHT, 0, -20);
 
-  ws.register_notify_update(this);    
+  ws.register_status_update(this, "tmcstatus", "", [this](const json &v) {
+    json tmc_status = v;
+    update(tmc_status);
+  });
+
+  // register dumps are only subscribed to while the panel is open
+  ws.set_status_active(this, false);
 }
 
 TmcStatusPanel::~TmcStatusPanel() {
@@ -58,13 +64,17 @@ TmcStatusPanel::~TmcStatusPanel() {
     lv_obj_del(cont);
     cont = NULL;
   }
+
+  ws.unregister_status_update(this);
 }
 
 void TmcStatusPanel::foreground() {
+  ws.set_status_active(this, true);
   lv_obj_move_foreground(cont);
 }
 
 void TmcStatusPanel::background() {
+  ws.set_status_active(this, false);
   lv_obj_move_background(cont);
 }
 
@@ -90,22 +100,22 @@ void TmcStatusPanel::init(json &j) {
   
 }
 
-void TmcStatusPanel::consume(json &j) {
-  std::lock_guard<std::mutex> lock(lv_lock);
-  auto tmc_status = j["/params/0/tmcstatus"_json_pointer];
-  if (!tmc_status.is_null()) {
-    for (auto &el : tmc_status.items()) {
-      const auto &s = metrics.find(el.key());
-      if (s != metrics.end()) {
-	// spdlog::debug("tmc stepper found {}", el.key());
+void TmcStatusPanel::update(json &tmc_status) {
+  if (!tmc_status.empty()) {
+    lv_obj_add_state(toggle, LV_STATE_CHECKED);
+  }
 
-	s->second->update(el.value());
-      } else {
-	spdlog::debug("tmc stepper created {}", el.key());
-	auto tmc_status_cont = std::make_shared<TmcStatusContainer>(ws, cont, el.key());
-	metrics.insert({el.key(), tmc_status_cont});      
-	tmc_status_cont->update(el.value());
-      }
+  for (auto &el : tmc_status.items()) {
+    const auto &s = metrics.find(el.key());
+    if (s != metrics.end()) {
+      // spdlog::debug("tmc stepper found {}", el.key());
+
+      s->second->update(el.value());
+    } else {
+      spdlog::debug("tmc stepper created {}", el.key());
+      auto tmc_status_cont = std::make_shared<TmcStatusContainer>(ws, cont, el.key());
+      metrics.insert({el.key(), tmc_status_cont});      
+      tmc_status_cont->update(el.value());
     }
   }
 
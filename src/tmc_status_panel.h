@@ -20,7 +20,7 @@ class TmcStatusPanel : public NotifyConsumer {
   void background();
 
   void init(json &);
-  void consume(json &j);
+  void update(json &tmc_status);
 
  private:
   KWebSocketClient &ws;
@@ -0,0 +1,153 @@
+#include "ui_reactor.h"
+#include "spdlog/spdlog.h"
+
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <linux/input.h>
+#endif
+
+UiReactor *UiReactor::instance = NULL;
+
+UiReactor::UiReactor()
+  : epoll_fd(-1)
+  , wake_fd(-1)
+  , input_fd(-1)
+  , wake_pending(false)
+{
+#ifdef __linux__
+  epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (epoll_fd < 0 || wake_fd < 0) {
+    spdlog::error("failed to create ui reactor, falling back to polling");
+    return;
+  }
+
+  struct epoll_event ev = {};
+  ev.events = EPOLLIN;
+  ev.data.fd = wake_fd;
+  epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wake_fd, &ev);
+#endif
+}
+
+UiReactor::~UiReactor() {
+  if (input_fd >= 0) {
+    close(input_fd);
+  }
+
+  if (wake_fd >= 0) {
+    close(wake_fd);
+  }
+
+  if (epoll_fd >= 0) {
+    close(epoll_fd);
+  }
+}
+
+UiReactor *UiReactor::get_instance() {
+  if (instance == NULL) {
+    instance = new UiReactor();
+  }
+  return instance;
+}
+
+bool UiReactor::watch_input(const char *path) {
+#ifdef __linux__
+  if (epoll_fd < 0 || input_fd >= 0) {
+    return false;
+  }
+
+  input_fd = open(path, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+  if (input_fd < 0) {
+    spdlog::warn("failed to open {} for input wakeups", path);
+    return false;
+  }
+
+  struct epoll_event ev = {};
+  ev.events = EPOLLIN;
+  ev.data.fd = input_fd;
+  if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, input_fd, &ev) != 0) {
+    close(input_fd);
+    input_fd = -1;
+    return false;
+  }
+
+  spdlog::debug("waking up on input from {}", path);
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool UiReactor::watch(int fd, std::function<void()> on_readable) {
+#ifdef __linux__
+  if (epoll_fd < 0) {
+    return false;
+  }
+
+  struct epoll_event ev = {};
+  ev.events = EPOLLIN;
+  ev.data.fd = fd;
+  if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev) != 0) {
+    return false;
+  }
+
+  watched[fd] = on_readable;
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool UiReactor::has_input() const {
+  return input_fd >= 0;
+}
+
+void UiReactor::wakeup() {
+#ifdef __linux__
+  // one write per sleep is enough, bursts of status updates collapse into it
+  if (wake_fd >= 0 && !wake_pending.exchange(true)) {
+    uint64_t one = 1;
+    ssize_t r = write(wake_fd, &one, sizeof(one));
+    (void)r;
+  }
+#endif
+}
+
+bool UiReactor::wait(uint32_t timeout_ms) {
+#ifdef __linux__
+  if (epoll_fd >= 0) {
+    int timeout = timeout_ms > INT32_MAX ? -1 : (int)timeout_ms;
+    struct epoll_event events[8];
+    int n = epoll_wait(epoll_fd, events, 8, timeout);
+
+    bool input = false;
+    for (int i = 0; i < n; i++) {
+      if (events[i].data.fd == wake_fd) {
+	uint64_t v;
+	ssize_t r = read(wake_fd, &v, sizeof(v));
+	(void)r;
+	wake_pending = false;
+      } else if (events[i].data.fd == input_fd) {
+	// only a wakeup, the lvgl driver reads the events from its own fd
+	struct input_event in[16];
+	while (read(input_fd, in, sizeof(in)) > 0) {
+	}
+	input = true;
+      } else {
+	const auto &w = watched.find(events[i].data.fd);
+	if (w != watched.end()) {
+	  w->second();
+	}
+      }
+    }
+    return input;
+  }
+#endif
+
+  usleep(std::min<uint32_t>(timeout_ms, 10) * 1000);
+  return false;
+}
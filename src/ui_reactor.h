@@ -0,0 +1,48 @@
+#ifndef __UI_REACTOR_H__
+#define __UI_REACTOR_H__
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+
+// Puts the LVGL thread to sleep until it has something to do: the next LVGL
+// timer is due, the touch device has input, or another thread (websocket,
+// wpa_supplicant) hands it work through wakeup(). Linux only, elsewhere
+// wait() falls back to a short sleep.
+class UiReactor {
+ private:
+  static UiReactor *instance;
+  UiReactor();
+
+ public:
+  UiReactor(UiReactor &o) = delete;
+  void operator=(const UiReactor &) = delete;
+  ~UiReactor();
+
+  static UiReactor *get_instance();
+
+  // watch an evdev device for input. opens its own fd, every evdev reader
+  // gets its own copy of the events so the LVGL driver isn't affected.
+  bool watch_input(const char *path);
+  bool has_input() const;
+
+  // on_readable runs on the LVGL thread from wait(), without lv_lock
+  bool watch(int fd, std::function<void()> on_readable);
+
+  // safe from any thread
+  void wakeup();
+
+  // blocks for up to timeout_ms (UINT32_MAX for no timeout) or until woken,
+  // returns true if input arrived
+  bool wait(uint32_t timeout_ms);
+
+ private:
+  int epoll_fd;
+  int wake_fd;
+  int input_fd;
+  std::atomic_bool wake_pending;
+  std::map<int, std::function<void()>> watched;
+};
+
+#endif // __UI_REACTOR_H__
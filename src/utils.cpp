@@ -4,6 +4,7 @@
 #include "state.h"
 #include "spdlog/spdlog.h"
 #include "platform.h"
+#include "lvgl/lvgl.h"
 
 #include <cmath>
 #include <time.h>
@@ -33,15 +34,12 @@ namespace fs = std::experimental::filesystem;
 namespace KUtils {
 
   bool is_homed() {
-    auto v = State::get_instance()
-      ->get_data("/printer_state/toolhead/homed_axes"_json_pointer);
-    if (!v.is_null()) {
-      std::string homed_axes = v.template get<std::string>();
-      return homed_axes.find("x") != std::string::npos
-        && homed_axes.find("y") != std::string::npos
-        && homed_axes.find("z") != std::string::npos;
-    }
-    return false;
+    State *s = State::get_instance();
+    static const StateKey homed_axes_key = s->key("toolhead", "homed_axes");
+    std::string homed_axes = s->get_string(homed_axes_key);
+    return homed_axes.find("x") != std::string::npos
+      && homed_axes.find("y") != std::string::npos
+      && homed_axes.find("z") != std::string::npos;
   }
 
   bool is_running_local() {
@@ -50,54 +48,48 @@ namespace KUtils {
     return df_host == "localhost" || df_host == "127.0.0.1";
   }
 
+  uint32_t input_age_ms() {
+    lv_indev_t *indev = lv_indev_get_act();
+    return indev == NULL ? 0 : lv_tick_elaps(indev->proc.pr_timestamp);
+  }
+
   std::string get_root_path(const std::string root_name) {
-    auto roots = State::get_instance()->get_data("/roots"_json_pointer);
-    json filtered;
-    std::copy_if(roots.begin(), roots.end(),
-      std::back_inserter(filtered), [&root_name](const json &item) {
-        return item.contains("name") && item["name"] == root_name;
-      });
-
-    spdlog::trace("roots {}, filtered {}", roots.dump(), filtered.dump());
-    if (!filtered.empty()) {
-      return filtered["/0/path"_json_pointer];
+    auto state = State::get_instance()->get_snapshot();
+    const auto &roots = state->find("roots");
+    if (roots != state->end()) {
+      spdlog::trace("roots {}", roots->dump());
+      for (const auto &item : *roots) {
+        if (item.contains("name") && item["name"] == root_name && item.contains("path")) {
+          return item["path"].template get<std::string>();
+        }
+      }
     }
 
     return "";
   }
 
-  std::pair<std::string, std::pair<size_t, size_t>> get_thumbnail(const std::string &gcode_file, json &j, double scale) {
+  ThumbnailSource get_thumbnail(const std::string &gcode_file, json &j, double scale) {
+    ThumbnailSource src;
     auto &thumbs = j["/result/thumbnails"_json_pointer];
     if (!thumbs.is_null() && !thumbs.empty()) {
       auto scaled_width = scale * 300;
       spdlog::debug("using thumb at scaled width {}", scaled_width);
       uint32_t closest_index = 0;
-      size_t thumb_width = 0;
-      size_t thumb_height = 0;
 
       auto width = thumbs.at(0)["width"].is_number()
         ? thumbs.at(0)["width"].template get<int>()
         : std::stoi(thumbs.at(0)["width"].template get<std::string>());
 
-      auto height = thumbs.at(0)["height"].is_number()
-        ? thumbs.at(0)["height"].template get<int>()
-        : std::stoi(thumbs.at(0)["height"].template get<std::string>());
-
       int closest = std::abs(scaled_width - width);
       for (int i = 0; i < thumbs.size(); i++) {
         width = thumbs.at(i)["width"].is_number()
           ? thumbs.at(i)["width"].template get<int>()
           : std::stoi(thumbs.at(i)["width"].template get<std::string>());
-        height = thumbs.at(i)["height"].is_number()
-          ? thumbs.at(i)["height"].template get<int>()
-          : std::stoi(thumbs.at(i)["height"].template get<std::string>());
 
         int cur_diff = std::abs(scaled_width - width);
         if (cur_diff < closest) {
           closest = cur_diff;
           closest_index = i;
-          thumb_width = width;
-          thumb_height = height;
         }
       }
 
@@ -115,24 +107,23 @@ namespace KUtils {
       std::string fname = relative_path.substr(relative_path.find_last_of("/\\") + 1);
       std::string fullpath = fmt::format("{}/{}", conf->get<std::string>("/thumbnail_path"), fname);
 
+      auto &modified = j["/result/modified"_json_pointer];
+      src.key = fmt::format("{}@{}", gcode_file, modified.is_number() ? modified.template get<double>() : 0);
+
       if (is_running_local()) {
         spdlog::debug("running locally, skipping thumbnail downloads");
         auto gcode_root = get_root_path("gcodes");
-        fullpath = fmt::format("{}/{}", gcode_root, relative_path);
+        src.path = fmt::format("{}/{}", gcode_root, relative_path);
       } else {
-        std::string thumb_url = fmt::format("http://{}:{}/server/files/gcodes/{}",
+        src.path = fullpath;
+        src.url = fmt::format("http://{}:{}/server/files/gcodes/{}",
           df_host,
           conf->get<uint32_t>(conf->df() + "moonraker_port"),
           HUrl::escape(relative_path));
-        spdlog::debug("thumb url {}", thumb_url);
-        auto size = requests::downloadFile(thumb_url.c_str(), fullpath.c_str());
-        spdlog::trace("downloaded size {}", size);
       }
-
-      return std::make_pair(fullpath, std::make_pair(thumb_width, thumb_height));
     }
 
-    return std::make_pair("", std::make_pair(0, 0));
+    return src;
   }
 
 
@@ -13,10 +13,21 @@ using json = nlohmann::json;
 namespace KUtils {
   bool is_homed();
   bool is_running_local();
+  // ms since the input device being handled was pressed, 0 outside of input events
+  uint32_t input_age_ms();
   std::string get_root_path(const std::string root_name);
 
-  // path, width
-  std::pair<std::string, std::pair<size_t, size_t>> get_thumbnail(const std::string &gcode_file, json &j, double scale);
+  // a gcode file's thumbnail (see ThumbnailLoader)
+  struct ThumbnailSource {
+    // png on disk, empty when there is no thumbnail
+    std::string path;
+    // when moonraker is remote, where to download it to path from
+    std::string url;
+    // gcode path and modified time, the scaled copies are cached under it
+    std::string key;
+  };
+
+  ThumbnailSource get_thumbnail(const std::string &gcode_file, json &j, double scale);
 
   std::string download_file(const std::string &root,
     const std::string &fname,
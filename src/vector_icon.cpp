@@ -0,0 +1,372 @@
+#include "vector_icon.h"
+#include "image_bin.h"
+#include "lvgl/lvgl.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+// sub-scanlines per pixel row
+#define VECTOR_ICON_SS 16
+// max distance of a flattened curve from the real one, in pixels
+#define VECTOR_ICON_TOLERANCE 0.05f
+
+namespace {
+
+// bounds checked little endian reads
+class Reader {
+ public:
+  Reader(const uint8_t *p, size_t len)
+    : cur(p)
+    , end(p + len)
+    , ok(true)
+  {
+  }
+
+  template <typename T> T get() {
+    T v = T();
+    if ((size_t)(end - cur) < sizeof(T)) {
+      ok = false;
+      return v;
+    }
+    memcpy(&v, cur, sizeof(T));
+    cur += sizeof(T);
+    return v;
+  }
+
+  const uint8_t *skip(size_t n) {
+    if ((size_t)(end - cur) < n) {
+      ok = false;
+      return NULL;
+    }
+    const uint8_t *p = cur;
+    cur += n;
+    return p;
+  }
+
+  const uint8_t *cur;
+  const uint8_t *end;
+  bool ok;
+};
+
+struct Path {
+  bool evenodd;
+  uint8_t color[4];  // r g b a
+  const uint8_t *cmds;
+  uint16_t ncmds;
+  const uint8_t *coords;
+  uint16_t ncoords;
+};
+
+struct Edge {
+  float x0;
+  float y0;
+  float y1;
+  float dxdy;
+  int dir;
+};
+
+int args(uint8_t cmd) {
+  switch (cmd) {
+  case 'M':
+  case 'L':
+    return 2;
+  case 'Q':
+    return 4;
+  case 'C':
+    return 6;
+  case 'Z':
+    return 0;
+  default:
+    return -1;
+  }
+}
+
+bool read_path(Reader &r, Path &p) {
+  p.evenodd = r.get<uint8_t>() != 0;
+  for (int c = 0; c < 4; c++) {
+    p.color[c] = r.get<uint8_t>();
+  }
+  p.ncmds = r.get<uint16_t>();
+  p.ncoords = r.get<uint16_t>();
+  p.cmds = r.skip(p.ncmds);
+  p.coords = r.skip(p.ncoords * sizeof(float));
+  if (!r.ok) {
+    return false;
+  }
+
+  int n = 0;
+  for (uint16_t i = 0; i < p.ncmds; i++) {
+    int a = args(p.cmds[i]);
+    if (a < 0 || (i == 0 && p.cmds[i] != 'M')) {
+      return false;
+    }
+    n += a;
+  }
+  return n == p.ncoords;
+}
+
+class Flattener {
+ public:
+  Flattener(std::vector<Edge> &e, float s, float ox, float oy)
+    : edges(e)
+    , scale(s)
+    , off_x(ox)
+    , off_y(oy)
+    , x(0)
+    , y(0)
+    , start_x(0)
+    , start_y(0)
+  {
+  }
+
+  void move(float px, float py) {
+    close();
+    x = start_x = px;
+    y = start_y = py;
+  }
+
+  void line(float px, float py) {
+    if (py != y) {
+      Edge e;
+      float x0 = x, y0 = y, x1 = px, y1 = py;
+      e.dir = 1;
+      if (y0 > y1) {
+	std::swap(x0, x1);
+	std::swap(y0, y1);
+	e.dir = -1;
+      }
+      e.x0 = x0;
+      e.y0 = y0;
+      e.y1 = y1;
+      e.dxdy = (x1 - x0) / (y1 - y0);
+      edges.push_back(e);
+    }
+    x = px;
+    y = py;
+  }
+
+  void quad(float cx, float cy, float px, float py) {
+    float dd = std::hypot(x - 2 * cx + px, y - 2 * cy + py);
+    int n = segments(dd / 4);
+    float x0 = x, y0 = y;
+    for (int i = 1; i <= n; i++) {
+      float t = (float)i / n;
+      float u = 1 - t;
+      line(u * u * x0 + 2 * u * t * cx + t * t * px,
+	   u * u * y0 + 2 * u * t * cy + t * t * py);
+    }
+  }
+
+  void cubic(float c1x, float c1y, float c2x, float c2y, float px, float py) {
+    float dd = std::max(std::hypot(x - 2 * c1x + c2x, y - 2 * c1y + c2y),
+			std::hypot(c1x - 2 * c2x + px, c1y - 2 * c2y + py));
+    int n = segments(dd * 0.75f);
+    float x0 = x, y0 = y;
+    for (int i = 1; i <= n; i++) {
+      float t = (float)i / n;
+      float u = 1 - t;
+      line(u * u * u * x0 + 3 * u * u * t * c1x + 3 * u * t * t * c2x + t * t * t * px,
+	   u * u * u * y0 + 3 * u * u * t * c1y + 3 * u * t * t * c2y + t * t * t * py);
+    }
+  }
+
+  // fills close every subpath
+  void close() {
+    line(start_x, start_y);
+  }
+
+  float tx(float v) const {
+    return v * scale + off_x;
+  }
+
+  float ty(float v) const {
+    return v * scale + off_y;
+  }
+
+ private:
+  // segments needed to keep a curve with this second difference (in
+  // pixels) within tolerance
+  static int segments(float dd) {
+    int n = (int)std::ceil(std::sqrt(dd / VECTOR_ICON_TOLERANCE));
+    return std::min(std::max(n, 1), 100);
+  }
+
+  std::vector<Edge> &edges;
+  float scale;
+  float off_x;
+  float off_y;
+  float x;
+  float y;
+  float start_x;
+  float start_y;
+};
+
+void flatten(const Path &p, Flattener &f) {
+  float c[6];
+  const uint8_t *coords = p.coords;
+  for (uint16_t i = 0; i < p.ncmds; i++) {
+    int n = std::max(args(p.cmds[i]), 0);
+    memcpy(c, coords, n * sizeof(float));
+    coords += n * sizeof(float);
+    for (int k = 0; k < n; k += 2) {
+      c[k] = f.tx(c[k]);
+      c[k + 1] = f.ty(c[k + 1]);
+    }
+
+    switch (p.cmds[i]) {
+    case 'M':
+      f.move(c[0], c[1]);
+      break;
+    case 'L':
+      f.line(c[0], c[1]);
+      break;
+    case 'Q':
+      f.quad(c[0], c[1], c[2], c[3]);
+      break;
+    case 'C':
+      f.cubic(c[0], c[1], c[2], c[3], c[4], c[5]);
+      break;
+    case 'Z':
+      f.close();
+      break;
+    }
+  }
+  f.close();
+}
+
+// adds w to row over [x0, x1), partial pixels by the covered fraction
+void add_span(float *row, uint32_t size, float x0, float x1, float w) {
+  x0 = std::max(x0, 0.0f);
+  x1 = std::min(x1, (float)size);
+  if (x1 <= x0) {
+    return;
+  }
+
+  uint32_t i0 = (uint32_t)x0;
+  uint32_t i1 = (uint32_t)x1;
+  if (i0 == i1) {
+    row[i0] += (x1 - x0) * w;
+    return;
+  }
+
+  row[i0] += (i0 + 1 - x0) * w;
+  for (uint32_t i = i0 + 1; i < i1; i++) {
+    row[i] += w;
+  }
+  if (i1 < size) {
+    row[i1] += (x1 - i1) * w;
+  }
+}
+
+// coverage (0..1) of a path's edges, per pixel
+void coverage(const std::vector<Edge> &edges, bool evenodd, uint32_t w, uint32_t h,
+	      std::vector<float> &cov) {
+  std::fill(cov.begin(), cov.end(), 0.0f);
+
+  std::vector<const Edge *> active;
+  std::vector<std::pair<float, int>> xs;
+  const float sub = 1.0f / VECTOR_ICON_SS;
+
+  for (uint32_t py = 0; py < h; py++) {
+    active.clear();
+    for (const Edge &e : edges) {
+      if (e.y0 < py + 1 && e.y1 > py) {
+	active.push_back(&e);
+      }
+    }
+    if (active.empty()) {
+      continue;
+    }
+
+    float *row = &cov[py * w];
+    for (int s = 0; s < VECTOR_ICON_SS; s++) {
+      float y = py + (s + 0.5f) * sub;
+      xs.clear();
+      for (const Edge *e : active) {
+	if (y >= e->y0 && y < e->y1) {
+	  xs.emplace_back(e->x0 + (y - e->y0) * e->dxdy, e->dir);
+	}
+      }
+      std::sort(xs.begin(), xs.end());
+
+      int wind = 0;
+      for (size_t i = 0; i + 1 < xs.size(); i++) {
+	wind += xs[i].second;
+	bool inside = evenodd ? (wind & 1) != 0 : wind != 0;
+	if (inside) {
+	  add_span(row, w, xs[i].first, xs[i + 1].first, sub);
+	}
+      }
+    }
+  }
+}
+
+bool walk(const uint8_t *prog, size_t len, float vb[4], std::vector<Path> &paths) {
+  Reader r(prog, len);
+  for (int i = 0; i < 4; i++) {
+    vb[i] = r.get<float>();
+  }
+  uint16_t n = r.get<uint16_t>();
+  if (!r.ok || !(vb[2] > 0) || !(vb[3] > 0)) {
+    return false;
+  }
+
+  paths.resize(n);
+  for (Path &p : paths) {
+    if (!read_path(r, p)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+bool VectorIcon::valid(const uint8_t *prog, size_t len) {
+  float vb[4];
+  std::vector<Path> paths;
+  return walk(prog, len, vb, paths);
+}
+
+bool VectorIcon::render(const uint8_t *prog, size_t len, uint32_t w, uint32_t h, uint8_t *out) {
+  float vb[4];
+  std::vector<Path> paths;
+  if (w == 0 || h == 0 || !walk(prog, len, vb, paths)) {
+    return false;
+  }
+
+  // preserveAspectRatio xMidYMid meet
+  float scale = std::min(w / vb[2], h / vb[3]);
+  float off_x = (w - vb[2] * scale) / 2 - vb[0] * scale;
+  float off_y = (h - vb[3] * scale) / 2 - vb[1] * scale;
+
+  size_t px = (size_t)w * h;
+  std::vector<float> cov(px);
+  std::vector<float> acc(px * 4, 0.0f);  // premultiplied r g b a
+  std::vector<Edge> edges;
+
+  for (const Path &p : paths) {
+    edges.clear();
+    Flattener f(edges, scale, off_x, off_y);
+    flatten(p, f);
+    coverage(edges, p.evenodd, w, h, cov);
+
+    float opa = p.color[3] / 255.0f;
+    for (size_t i = 0; i < px; i++) {
+      float a = std::min(cov[i], 1.0f) * opa;
+      if (a <= 0) {
+	continue;
+      }
+      float *d = &acc[i * 4];
+      for (int c = 0; c < 3; c++) {
+	d[c] = p.color[c] * a + d[c] * (1 - a);
+      }
+      d[3] = a + d[3] * (1 - a);
+    }
+  }
+
+  ImageBin::unpremultiply(acc.data(), px, out);
+  return true;
+}
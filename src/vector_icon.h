@@ -0,0 +1,20 @@
+#ifndef __VECTOR_ICON_H__
+#define __VECTOR_ICON_H__
+
+#include <cstddef>
+#include <cstdint>
+
+// Rasterizer for the path programs assets/img-pack.py embeds in packed icons
+// (filled M/L/Q/C/Z paths, nonzero or evenodd, flat colors), enough for the
+// material_svg icons. Curves are flattened to lines and each pixel row is
+// sampled on 16 sub-scanlines with exact horizontal coverage.
+namespace VectorIcon {
+  // false if the program is malformed
+  bool valid(const uint8_t *prog, size_t len);
+
+  // renders into w x h LV_IMG_CF_TRUE_COLOR_ALPHA pixels, the viewBox scaled
+  // to fit and centered
+  bool render(const uint8_t *prog, size_t len, uint32_t w, uint32_t h, uint8_t *out);
+}
+
+#endif // __VECTOR_ICON_H__
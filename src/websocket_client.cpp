@@ -11,17 +11,44 @@
  */
 
 #include "websocket_client.h"
+#include "config.h"
+#include "utils.h"
 #include "spdlog/spdlog.h"
 
 #include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
+#include <future>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
 
 using namespace hv;
 using json = nlohmann::json;
 
 KWebSocketClient::KWebSocketClient(EventLoopPtr loop)
   : WebSocketClient(loop)
+  , wheel(WHEEL_SLOTS)
+  , wheel_tick(0)
+  , wheel_timer(INVALID_TIMER_ID)
+  , batch_count(0)
+  , loop_thread(WebSocketClient::loop())
+  , use_unix(false)
+  , uds_io(NULL)
+  , uds_priority_io(NULL)
+  , uds_retry_ms(0)
+  , priority_ws(WebSocketClient::loop())
+  , status_subscribed(false)
+  , resubscribe_pending(false)
   , id(0)
 {
+  uds_unpack.mode = UNPACK_BY_DELIMITER;
+  uds_unpack.package_max_length = 1 << 23;
+  uds_unpack.delimiter[0] = 0x03;
+  uds_unpack.delimiter_bytes = 1;
 }
 
 KWebSocketClient::~KWebSocketClient() {
@@ -33,30 +60,72 @@ int KWebSocketClient::connect(const char* url,
   spdlog::debug("websocket connecting");
   // set callbacks
   onopen = [this, connected]() {
-    const HttpResponsePtr& resp = getHttpResponse();
-    spdlog::debug("onopen {}", resp->body.c_str());
+    if (!use_unix) {
+      const HttpResponsePtr& resp = getHttpResponse();
+      spdlog::debug("onopen {}", resp->body.c_str());
+#ifdef GUPPY_WS_DEFLATE
+      if (deflate.accept(resp->GetHeader("Sec-WebSocket-Extensions"))) {
+	spdlog::info("websocket permessage-deflate enabled");
+      } else {
+	spdlog::debug("websocket permessage-deflate not offered by server");
+      }
+#endif
+    }
+    if (wheel_timer == INVALID_TIMER_ID) {
+      wheel_timer = this->loop()->setInterval(WHEEL_TICK_MS, [this](hv::TimerID) {
+        expire_requests();
+      });
+    }
     connected();
   };
-  onmessage = [this, connected, disconnected](const std::string &msg) {
+  onmessage = [this, connected, disconnected](const std::string &raw) {
+    const std::string *text = &raw;
+#ifdef GUPPY_WS_DEFLATE
+    if (!use_unix && deflate.is_offered()) {
+      bool compressed = false;
+      if (!deflate.next_message(raw.size(), compressed)) {
+        spdlog::error("dropping websocket message, lost track of the frames");
+        return;
+      }
+
+      if (compressed) {
+        if (!deflate.is_enabled() || !deflate.inflate_message(raw, inflated)) {
+          spdlog::warn("dropping websocket message, inflate failed");
+          return;
+        }
+        text = &inflated;
+      }
+    }
+#endif
+    const std::string &msg = *text;
     // if (msg.find("notify_proc_stat_update") == std::string::npos) {
     //   spdlog::trace("onmessage(type={} len={}): {}", opcode() == WS_OPCODE_TEXT ? "text" : "binary",
     // 	     (int)msg.size(), msg);
     // }
-    auto j = json::parse(msg);
+    // status updates are the bulk of the traffic, stream them into deltas
+    // instead of building a DOM. everything else (rpc replies) stays json.
+    if (StatusUpdateParser::is_status_update(msg) && status_parser.parse(msg)) {
+      handle_status_update(status_parser.get_update());
+      return;
+    }
 
-    if (j.contains("id")) {
-      // XXX: get rid of consumers and use function ptrs for callback
-      const auto &entry = consumers.find(j["id"]);
-      if (entry != consumers.end()) {
-        entry->second->consume(j);
-        consumers.erase(entry);
-      }
+    // a parse error must not throw out of libhv's callback
+    auto j = json::parse(msg, nullptr, false);
+    if (j.is_discarded()) {
+      spdlog::warn("dropping malformed message ({} bytes)", msg.size());
+      return;
+    }
 
-      const auto &cb_entry = callbacks.find(j["id"]);
-      if (cb_entry != callbacks.end()) {
-        cb_entry->second(j);
-        callbacks.erase(cb_entry);
+    // replies to a batch come back as an array
+    if (j.is_array()) {
+      for (auto &reply : j) {
+        handle_reply(reply);
       }
+      return;
+    }
+
+    if (j.contains("id")) {
+      handle_reply(j);
     }
 
     if (j.contains("method")) {
@@ -71,6 +140,7 @@ int KWebSocketClient::connect(const char* url,
       // 	}
       // }
       else if ("notify_klippy_disconnected" == method) {
+        status_subscribed = false;
         disconnected();
       } else if ("notify_klippy_ready" == method) {
         connected();
@@ -86,8 +156,13 @@ int KWebSocketClient::connect(const char* url,
     }
   };
 
-  onclose = [disconnected]() {
+  onclose = [this, disconnected]() {
     spdlog::debug("onclose");
+#ifdef GUPPY_WS_DEFLATE
+    deflate.reset();
+#endif
+    status_subscribed = false;
+    fail_all(RPC_ERROR_DISCONNECTED, "disconnected");
     disconnected();
   };
 
@@ -101,48 +176,523 @@ int KWebSocketClient::connect(const char* url,
   reconn.delay_policy = 2;
   setReconnect(&reconn);
 
+  std::string uds = unix_socket_path();
+  if (!uds.empty()) {
+    spdlog::info("connecting to moonraker over {}", uds);
+    close();
+    priority_ws.close();
+    return connect_unix(uds);
+  }
+  close_unix();
+
   http_headers headers;
-  return open(url, headers);
+#ifdef GUPPY_WS_DEFLATE
+  // local connections gain nothing from compression
+  Config *conf = Config::get_instance();
+  auto &compression = conf->get_json(conf->df() + "moonraker_compression");
+  bool compress = compression.is_boolean() ? compression.template get<bool>() : true;
+  if (compress && !KUtils::is_running_local()) {
+    headers["Sec-WebSocket-Extensions"] = WsDeflate::offer();
+  }
+#endif
+
+  // open() installs libhv's handshake and frame parser as onMessage, which
+  // the loop thread calls on every read, reconnects included. it runs on
+  // the loop thread so the parser can be wrapped before any read comes in:
+  // the connect it starts completes on a later turn of the loop.
+  if (!loop()->isRunning()) {
+    loop_thread.start();
+  }
+
+  std::promise<int> opened;
+  std::future<int> result = opened.get_future();
+  std::string ws_url(url);
+  loop()->runInLoop([this, &opened, ws_url, headers]() {
+#ifdef GUPPY_WS_DEFLATE
+    // the scanner belongs to the loop thread, the old connection is closed
+    // by open() without another read in between
+    deflate.start(headers.find("Sec-WebSocket-Extensions") != headers.end());
+#endif
+    int r = open(ws_url.c_str(), headers);
+
+#ifdef GUPPY_WS_DEFLATE
+    // every byte read goes through the RSV1 scanner before libhv parses
+    // it, from the upgrade response on: frames can arrive in the same read
+    // as the response, and libhv parses them right after calling onopen.
+    auto parse = onMessage;
+    if (parse && deflate.is_offered()) {
+      onMessage = [this, parse](const hv::WebSocketChannelPtr &channel, hv::Buffer *buf) {
+	deflate.scan((const char *)buf->data(), buf->size());
+	parse(channel, buf);
+      };
+    }
+#endif
+
+    opened.set_value(r);
+  });
+  int ret = result.get();
+
+  priority_ws.close();
+  if (ret == 0 && priority_connection_enabled()) {
+    // only written to, replies and notifications are dropped
+    priority_ws.onmessage = [](const std::string &) {};
+    priority_ws.setPingInterval(10000);
+    priority_ws.setReconnect(&reconn);
+    priority_ws.open(url, http_headers());
+  }
+
+  return ret;
 };
 
-int KWebSocketClient::send_jsonrpc(const std::string &method,
-				   const json &params,
-				   std::function<void(json&)> cb) {
-  const auto &entry = callbacks.find(id);
-  if (entry == callbacks.end()) {
-    // spdlog::debug("registering consume %d, %x\n", id, consumer);
-    callbacks.insert({id, cb});
-    // XXX: check success, remove consumer if send is unsuccessfull
-    return send_jsonrpc(method, params);
-  } else {
-    // spdlog::debug("WARN: id %d is already register with a consumer\n", id);
+std::string KWebSocketClient::unix_socket_path() {
+  Config *conf = Config::get_instance();
+  auto &v = conf->get_json(conf->df() + "moonraker_socket");
+  if (v.is_string()) {
+    return v.template get<std::string>();
+  }
+
+  if ((v.is_boolean() && !v.template get<bool>()) || !KUtils::is_running_local()) {
+    return "";
+  }
+
+  // default moonraker locations, K1 first
+  std::vector<std::string> candidates = { "/usr/data/printer_data/comms/moonraker.sock" };
+  const char *home = std::getenv("HOME");
+  if (home != NULL) {
+    candidates.push_back(std::string(home) + "/printer_data/comms/moonraker.sock");
   }
 
+  struct stat buffer;
+  for (const auto &c : candidates) {
+    if (stat(c.c_str(), &buffer) == 0 && S_ISSOCK(buffer.st_mode)) {
+      return c;
+    }
+  }
+
+  return "";
+}
+
+bool KWebSocketClient::is_unix_socket() const {
+  return use_unix;
+}
+
+int KWebSocketClient::connect_unix(const std::string &path) {
+  close_unix();
+  use_unix = true;
+  uds_path = path;
+  uds_retry_ms = 0;
+
+  if (!loop()->isRunning()) {
+    loop_thread.start();
+  }
+
+  loop()->runInLoop([this]() { open_unix(); });
   return 0;
 }
 
-int KWebSocketClient::send_jsonrpc(const std::string &method,
-				   std::function<void(json&)> cb) {
-  const auto &entry = callbacks.find(id);
-  if (entry == callbacks.end()) {
-    // spdlog::debug("registering consume %d, %x\n", id, consumer);
-    callbacks.insert({id, cb});
-    // XXX: check success, remove consumer if send is unsuccessfull
-    return send_jsonrpc(method);
+// loop thread, returns NULL if moonraker isn't listening
+hio_t *KWebSocketClient::open_unix_io(hloop_t *loop, const std::string &path) {
+  struct sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+
+  int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd < 0 || ::connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+    spdlog::debug("failed to connect to {}: {}", path, strerror(errno));
+    if (fd >= 0) {
+      ::close(fd);
+    }
+    return NULL;
+  }
+
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+  return hio_get(loop, fd);
+}
+
+// loop thread
+void KWebSocketClient::open_unix() {
+  if (!use_unix || uds_io != NULL) {
+    return;
+  }
+
+  hio_t *io = open_unix_io(loop()->loop(), uds_path);
+  if (io == NULL) {
+    // same backoff as the websocket reconnect
+    uds_retry_ms = uds_retry_ms == 0 ? 200 : std::min<uint32_t>(uds_retry_ms * 2, 2000);
+    loop()->setTimeout(uds_retry_ms, [this](hv::TimerID) { open_unix(); });
+    return;
+  }
+
+  uds_retry_ms = 0;
+  hio_set_context(io, this);
+  hio_set_unpack(io, &uds_unpack);
+  hio_setcb_read(io, &KWebSocketClient::on_unix_read);
+  hio_setcb_close(io, &KWebSocketClient::on_unix_close);
+  hio_read(io);
+  uds_io = io;
+
+  if (uds_priority_io == NULL && priority_connection_enabled()) {
+    hio_t *pio = open_unix_io(loop()->loop(), uds_path);
+    if (pio != NULL) {
+      // only written to, replies and notifications are dropped
+      hio_set_context(pio, this);
+      hio_setcb_read(pio, [](hio_t *, void *, int) {});
+      hio_setcb_close(pio, &KWebSocketClient::on_unix_priority_close);
+      hio_read(pio);
+      uds_priority_io = pio;
+    }
+  }
+
+  spdlog::debug("connected to {}", uds_path);
+  onopen();
+}
+
+void KWebSocketClient::close_unix() {
+  use_unix = false;
+  loop()->runInLoop([this]() {
+    hio_t *io = uds_priority_io;
+    if (io != NULL) {
+      hio_close(io);
+    }
+
+    io = uds_io;
+    if (io != NULL) {
+      hio_close(io);
+    }
+  });
+}
+
+void KWebSocketClient::on_unix_read(hio_t *io, void *buf, int len) {
+  KWebSocketClient *ws = (KWebSocketClient *)hio_context(io);
+  const char *data = (const char *)buf;
+  // packets are unpacked with their ETX
+  if (len > 0 && data[len - 1] == 0x03) {
+    len--;
+  }
+
+  ws->uds_msg.assign(data, len);
+  ws->onmessage(ws->uds_msg);
+}
+
+void KWebSocketClient::on_unix_close(hio_t *io) {
+  KWebSocketClient *ws = (KWebSocketClient *)hio_context(io);
+  ws->uds_io = NULL;
+
+  spdlog::debug("disconnected from {}", ws->uds_path);
+  ws->onclose();
+
+  if (ws->use_unix) {
+    ws->uds_retry_ms = 200;
+    ws->loop()->setTimeout(ws->uds_retry_ms, [ws](hv::TimerID) { ws->open_unix(); });
+  }
+}
+
+void KWebSocketClient::on_unix_priority_close(hio_t *io) {
+  KWebSocketClient *ws = (KWebSocketClient *)hio_context(io);
+  // reopened along with the main connection
+  ws->uds_priority_io = NULL;
+}
+
+int KWebSocketClient::transport_send(const std::string &frame) {
+  if (!use_unix) {
+    return send(frame);
+  }
+
+  hio_t *io = uds_io;
+  if (io == NULL) {
+    return -1;
+  }
+
+  uds_out.assign(frame);
+  uds_out += (char)0x03;
+  return hio_write(io, uds_out.data(), uds_out.size());
+}
+
+bool KWebSocketClient::priority_connection_enabled() {
+  Config *conf = Config::get_instance();
+  auto &v = conf->get_json(conf->df() + "moonraker_priority_connection");
+  return v.is_boolean() && v.template get<bool>();
+}
+
+int KWebSocketClient::send_priority(const std::string &method, uint32_t input_age_ms) {
+  auto start = std::chrono::steady_clock::now();
+  uint64_t rid = id++;
+  int ret = -1;
+  uint32_t send_us;
+  uint32_t total_ms;
+  {
+    std::lock_guard<std::mutex> guard(priority_lock);
+    const std::string &frame = priority_encoder.request(method, NULL, rid);
+
+    if (use_unix) {
+      hio_t *io = uds_priority_io;
+      if (io == NULL) {
+	io = uds_io;
+      }
+
+      if (io != NULL) {
+	priority_out.assign(frame);
+	priority_out += (char)0x03;
+	ret = hio_write(io, priority_out.data(), priority_out.size());
+      }
+    } else if (priority_ws.isConnected()) {
+      ret = priority_ws.send(frame);
+    } else {
+      ret = send(frame);
+    }
+
+    send_us = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start).count();
+    total_ms = input_age_ms + send_us / 1000;
+
+    priority_latency.count++;
+    priority_latency.last_ms = total_ms;
+    priority_latency.max_ms = std::max(priority_latency.max_ms, total_ms);
+    priority_latency.last_send_us = send_us;
+    priority_latency.max_send_us = std::max(priority_latency.max_send_us, send_us);
+  }
+
+  if (ret < 0) {
+    spdlog::error("failed to send {}", method);
   } else {
-    // spdlog::debug("WARN: id %d is already register with a consumer\n", id);
+    spdlog::info("{} on the wire {}ms after input ({}us to send)", method, total_ms, send_us);
   }
+  return ret;
+}
 
-  return 0;
+KWebSocketClient::PriorityLatency KWebSocketClient::get_priority_latency() {
+  std::lock_guard<std::mutex> guard(priority_lock);
+  return priority_latency;
+}
+
+// requests moonraker only answers once the printer is done with them
+static bool is_long_running(const std::string &method) {
+  return method == "printer.gcode.script"
+    || method.rfind("printer.print.", 0) == 0
+    || method == "printer.restart"
+    || method == "printer.firmware_restart"
+    || method == "machine.device_power.post_device";
+}
+
+int KWebSocketClient::send_jsonrpc(const std::string &method,
+				   const json &params,
+				   std::function<void(json&)> cb) {
+  return send_request(method, &params, {cb, nullptr, NULL, 0}, 0);
+}
+
+int KWebSocketClient::send_jsonrpc(const std::string &method,
+				   std::function<void(json&)> cb) {
+  return send_request(method, NULL, {cb, nullptr, NULL, 0}, 0);
 }
 
 int KWebSocketClient::send_jsonrpc(const std::string &method, const json &params, NotifyConsumer *consumer) {
-  const auto &entry = consumers.find(id);
-  if (entry == consumers.end()) {
-    consumers.insert({id, consumer});
-    return send_jsonrpc(method, params);
+  return send_request(method, &params, {nullptr, nullptr, consumer, 0}, 0);
+}
+
+int KWebSocketClient::send_jsonrpc(const std::string &method,
+				   const json &params,
+				   std::function<void(json&)> cb,
+				   std::function<void(json&)> on_error,
+				   uint32_t timeout_ms) {
+  return send_request(method, &params, {cb, on_error, NULL, 0}, timeout_ms);
+}
+
+int KWebSocketClient::send_request(const std::string &method,
+				   const json *params,
+				   RpcRequest req,
+				   uint32_t timeout_ms) {
+  // moonraker works through a batch in order, so anything that only returns
+  // once the printer is done with it (and e-stop) goes out on its own
+  bool batchable = !is_long_running(method) && method != "printer.emergency_stop";
+  bool tracked = req.cb || req.on_error || req.consumer != NULL;
+  uint64_t rid = id++;
+  int ret = 0;
+  {
+    std::lock_guard<std::mutex> guard(rpc_lock);
+    const std::string &frame = encoder.request(method, params, rid);
+    spdlog::debug("send_jsonrpc: {}", frame);
+
+    if (tracked) {
+      req.expire_tick = 0;
+      // a request without on_error has nobody to tell it timed out, it
+      // waits for its reply (however long moonraker takes) or a disconnect
+      if (timeout_ms > 0 && req.on_error) {
+	req.expire_tick = wheel_tick + (timeout_ms + WHEEL_TICK_MS - 1) / WHEEL_TICK_MS;
+	wheel[req.expire_tick % WHEEL_SLOTS].push_back(rid);
+      }
+      inflight.insert({rid, std::move(req)});
+    }
+
+    if (batchable) {
+      if (batch_count > 0) {
+	batch_buf += ',';
+      }
+      batch_buf += frame;
+      batch_ids.push_back(rid);
+      if (++batch_count == 1) {
+	loop()->queueInLoop([this]() { flush_batch(); });
+      }
+      return 0;
+    }
+
+    ret = transport_send(frame);
+  }
+
+  if (ret < 0) {
+    fail_request(rid, RPC_ERROR_SEND, "send failed");
+  }
+  return ret;
+}
+
+// websocket loop thread only, which is the sole user of flush_buf/flush_ids
+void KWebSocketClient::flush_batch() {
+  int ret;
+  {
+    std::lock_guard<std::mutex> guard(rpc_lock);
+    if (batch_count == 0) {
+      return;
+    }
+
+    if (batch_count == 1) {
+      flush_buf.swap(batch_buf);
+    } else {
+      flush_buf.assign(1, '[');
+      flush_buf += batch_buf;
+      flush_buf += ']';
+    }
+    batch_buf.clear();
+    batch_count = 0;
+    flush_ids.swap(batch_ids);
+    batch_ids.clear();
+
+    ret = transport_send(flush_buf);
+  }
+
+  if (ret < 0) {
+    for (uint64_t rid : flush_ids) {
+      fail_request(rid, RPC_ERROR_SEND, "send failed");
+    }
+  }
+}
+
+void KWebSocketClient::handle_reply(json &j) {
+  if (!j.contains("id") || !j["id"].is_number_integer()) {
+    return;
+  }
+
+  RpcRequest req;
+  {
+    std::lock_guard<std::mutex> guard(rpc_lock);
+    const auto &entry = inflight.find(j["id"].template get<uint64_t>());
+    if (entry == inflight.end()) {
+      return;
+    }
+
+    req = std::move(entry->second);
+    inflight.erase(entry);
+  }
+
+  if (j.contains("error") && req.on_error) {
+    req.on_error(j["error"]);
+    return;
+  }
+
+  if (req.consumer != NULL) {
+    req.consumer->consume(j);
+  }
+
+  if (req.cb) {
+    req.cb(j);
+  }
+}
+
+void KWebSocketClient::fail_request(uint64_t rid, int code, const std::string &message) {
+  RpcRequest req;
+  {
+    std::lock_guard<std::mutex> guard(rpc_lock);
+    const auto &entry = inflight.find(rid);
+    if (entry == inflight.end()) {
+      // already answered
+      return;
+    }
+
+    req = std::move(entry->second);
+    inflight.erase(entry);
+  }
+
+  spdlog::debug("rpc {} failed: {}", rid, message);
+  if (req.on_error) {
+    json error = {{ "code", code }, { "message", message }};
+    req.on_error(error);
+  }
+}
+
+void KWebSocketClient::fail_all(int code, const std::string &message) {
+  std::map<uint64_t, RpcRequest> failed;
+  {
+    std::lock_guard<std::mutex> guard(rpc_lock);
+    failed.swap(inflight);
+    for (auto &bucket : wheel) {
+      bucket.clear();
+    }
+    batch_buf.clear();
+    batch_count = 0;
+    batch_ids.clear();
+  }
+
+  json error = {{ "code", code }, { "message", message }};
+  for (auto &entry : failed) {
+    if (entry.second.on_error) {
+      json e = error;
+      entry.second.on_error(e);
+    }
+  }
+}
+
+void KWebSocketClient::expire_requests() {
+  std::vector<uint64_t> expired;
+  {
+    std::lock_guard<std::mutex> guard(rpc_lock);
+    wheel_tick++;
+    auto &bucket = wheel[wheel_tick % WHEEL_SLOTS];
+    bucket.erase(std::remove_if(bucket.begin(), bucket.end(), [this, &expired](uint64_t rid) {
+      const auto &entry = inflight.find(rid);
+      if (entry == inflight.end()) {
+	return true;
+      }
+
+      if (entry->second.expire_tick <= wheel_tick) {
+	expired.push_back(rid);
+	return true;
+      }
+
+      // due in a later round of the wheel
+      return false;
+    }), bucket.end());
+  }
+
+  for (uint64_t rid : expired) {
+    spdlog::warn("rpc {} timed out", rid);
+    fail_request(rid, RPC_ERROR_TIMEOUT, "timeout");
+  }
+}
+
+void KWebSocketClient::handle_status_update(const StatusUpdate &update) {
+  for (const auto &entry : notify_consumers) {
+    entry->consume_status(update);
+  }
+
+  if (status_registry.enqueue(update) && status_ready) {
+    status_ready();
+  }
+
+  const auto &entry = method_resp_cbs.find("notify_status_update");
+  if (entry != method_resp_cbs.end()) {
+    for (const auto &handler_entry : entry->second) {
+      handler_entry.second(update.to_json());
+    }
   }
-  return 0;
 }
 
 void KWebSocketClient::register_notify_update(NotifyConsumer *consumer) {
@@ -159,31 +709,136 @@ void KWebSocketClient::unregister_notify_update(NotifyConsumer *consumer) {
     }));
 }
 
+void KWebSocketClient::register_status_update(NotifyConsumer *consumer,
+					      const std::string &object,
+					      const std::string &field,
+					      StatusHandler handler) {
+  status_registry.add(consumer, object, field, handler);
+  schedule_resubscribe();
+}
+
+void KWebSocketClient::unregister_status_update(NotifyConsumer *consumer) {
+  status_registry.remove(consumer);
+  schedule_resubscribe();
+}
+
+void KWebSocketClient::unregister_status_update(NotifyConsumer *consumer,
+						const std::string &object) {
+  status_registry.remove(consumer, object);
+  schedule_resubscribe();
+}
+
+void KWebSocketClient::process_status_updates() {
+  status_registry.drain();
+}
+
+void KWebSocketClient::on_status_ready(std::function<void()> cb) {
+  status_ready = cb;
+}
+
+int KWebSocketClient::subscribe_status(std::function<void(json&)> cb) {
+  subscribed_objects = status_registry.get_subscription();
+  status_subscribed = true;
+
+  json subs = {{ "objects", subscribed_objects }};
+  spdlog::debug("subcribing to {}", subs.dump());
+  return send_jsonrpc("printer.objects.subscribe", subs, cb);
+}
+
+void KWebSocketClient::set_status_active(NotifyConsumer *consumer, bool active) {
+  if (status_registry.set_active(consumer, active)) {
+    schedule_resubscribe();
+  }
+}
+
+void KWebSocketClient::schedule_resubscribe() {
+  if (!status_subscribed || resubscribe_pending.exchange(true)) {
+    return;
+  }
+
+  // panels register and switch in bursts (e.g. creating all fans, moving
+  // between panels), coalesce them into a single subscribe
+  loop()->runInLoop([this]() {
+    loop()->setTimeout(100, [this](hv::TimerID) {
+      resubscribe();
+    });
+  });
+}
+
+// true if subs, a printer.objects.subscribe "objects" param, covers the field
+static bool is_subscribed(const json &subs, const std::string &object, const std::string &field) {
+  const auto &o = subs.find(object);
+  if (o == subs.end()) {
+    return false;
+  }
+  return o->is_null() || std::find(o->begin(), o->end(), field) != o->end();
+}
+
+void KWebSocketClient::resubscribe() {
+  resubscribe_pending = false;
+  if (!status_subscribed) {
+    return;
+  }
+
+  json objs = status_registry.get_subscription();
+  if (objs == subscribed_objects) {
+    return;
+  }
+
+  json prev = subscribed_objects;
+  subscribed_objects = objs;
+  json subs = {{ "objects", objs }};
+  spdlog::debug("resubcribing to {}", subs.dump());
+  send_jsonrpc("printer.objects.subscribe", subs, [this, prev](json &j) {
+    // the reply carries the current values of everything subscribed. only
+    // the fields new to the subscription are news: the others already reach
+    // their handlers through notify_status_update, and handlers take a delta
+    // to mean a change
+    if (j.contains("result")) {
+      json added = json::object();
+      const json &status = j["result"]["status"];
+      if (status.is_object()) {
+	for (const auto &o : status.items()) {
+	  if (!o.value().is_object()) {
+	    continue;
+	  }
+
+	  for (const auto &f : o.value().items()) {
+	    if (!is_subscribed(prev, o.key(), f.key())) {
+	      added[o.key()][f.key()] = f.value();
+	    }
+	  }
+	}
+      }
+
+      subscribe_update.assign(added);
+      if (j["result"].contains("eventtime") && j["result"]["eventtime"].is_number()) {
+	subscribe_update.set_eventtime(j["result"]["eventtime"].template get<double>());
+      }
+
+      if (!subscribe_update.empty()) {
+	handle_status_update(subscribe_update);
+      }
+    }
+  });
+}
+
 int KWebSocketClient::send_jsonrpc(const std::string &method,
 				   const json &params) {
-  json rpc;
-  rpc["jsonrpc"] = "2.0";
-  rpc["method"] = method;
-  rpc["params"] = params;
-  rpc["id"] = id++;
-
-  spdlog::debug("send_jsonrpc: {}", rpc.dump());
-  return send(rpc.dump());
+  return send_request(method, &params, {nullptr, nullptr, NULL, 0}, 0);
 }
 
 int KWebSocketClient::send_jsonrpc(const std::string &method) {
-  json rpc;
-  rpc["jsonrpc"] = "2.0";
-  rpc["method"] = method;
-  rpc["id"] = id++;
-
-  spdlog::debug("send_jsonrpc: {}", rpc.dump());
-  return send(rpc.dump());
+  return send_request(method, NULL, {nullptr, nullptr, NULL, 0}, 0);
 }
 
 int KWebSocketClient::gcode_script(const std::string &gcode) {
-  json cmd = {{ "script", gcode }};
-  return send_jsonrpc("printer.gcode.script", cmd);
+  // fire and forget, nothing to track
+  uint64_t rid = id++;
+  std::lock_guard<std::mutex> guard(rpc_lock);
+  const std::string &frame = encoder.gcode_script(gcode, rid);
+  spdlog::debug("send_jsonrpc: {}", frame);
+  return transport_send(frame);
 }
 
 void KWebSocketClient::register_method_callback(std::string resp_method,
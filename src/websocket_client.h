@@ -2,10 +2,17 @@
 #define __KWEBSOCKET_CLIENT_H__
 
 #include "hv/WebSocketClient.h"
+#include "hv/EventLoopThread.h"
 #include "notify_consumer.h"
+#include "status_update.h"
+#include "status_registry.h"
+#include "rpc_encoder.h"
+#include "ws_deflate.h"
 #include "hv/json.hpp"
 
 #include <map>
+#include <mutex>
+#include <string>
 #include <vector>
 #include <atomic>
 #include <functional>
@@ -24,6 +31,30 @@ class KWebSocketClient : public hv::WebSocketClient {
   void register_notify_update(NotifyConsumer *consumer);
   void unregister_notify_update(NotifyConsumer *consumer);
 
+  // deliver only deltas of object.field (or every field of object if field
+  // is empty) to handler. handlers run from process_status_updates().
+  void register_status_update(NotifyConsumer *consumer,
+			      const std::string &object,
+			      const std::string &field,
+			      StatusHandler handler);
+  void unregister_status_update(NotifyConsumer *consumer);
+  void unregister_status_update(NotifyConsumer *consumer, const std::string &object);
+
+  // run the status handlers for the updates received since the last call,
+  // from the LVGL thread with lv_lock held
+  void process_status_updates();
+  // called from the websocket thread when process_status_updates() has work
+  void on_status_ready(std::function<void()> cb);
+
+  // printer.objects.subscribe to the fields registered above. once
+  // subscribed, the subscription follows the registrations and is re-issued
+  // whenever the set of needed fields changes.
+  int subscribe_status(std::function<void(json&)> cb);
+
+  // inactive (off screen) consumers keep their registrations but don't
+  // count towards the subscription
+  void set_status_active(NotifyConsumer *consumer, bool active);
+
   // void register_gcode_resp(std::function<void(json&)> cb);
 
   int send_jsonrpc(const std::string &method, std::function<void(json&)> cb);
@@ -31,15 +62,143 @@ class KWebSocketClient : public hv::WebSocketClient {
   int send_jsonrpc(const std::string &method, const json &params, NotifyConsumer *consumer);  
   int send_jsonrpc(const std::string &method, const json &params);
   int send_jsonrpc(const std::string &method);
+  // on_error gets a json-rpc error object ({"code", "message"}) if the
+  // request fails to send, times out, the connection drops or moonraker
+  // replies with an error. exactly one of cb/on_error is called. a
+  // timeout_ms of 0 waits for the reply until disconnected, as the
+  // overloads above without on_error always do.
+  int send_jsonrpc(const std::string &method,
+		   const json &params,
+		   std::function<void(json&)> cb,
+		   std::function<void(json&)> on_error,
+		   uint32_t timeout_ms);
   int gcode_script(const std::string &gcode);
 
+  // emergency stop and pause must not wait behind batched or queued
+  // traffic. they are encoded on a lane of their own and written to the
+  // socket from the calling thread, over the priority connection if one is
+  // open. replies aren't tracked. input_age_ms is how long ago the input
+  // that triggered the request happened, for the latency stats.
+  int send_priority(const std::string &method, uint32_t input_age_ms = 0);
+
+  struct PriorityLatency {
+    uint32_t count = 0;
+    // input to wire
+    uint32_t last_ms = 0;
+    uint32_t max_ms = 0;
+    // time spent encoding and writing
+    uint32_t last_send_us = 0;
+    uint32_t max_send_us = 0;
+  };
+  PriorityLatency get_priority_latency();
+
+  // error codes passed to on_error for failures on our side
+  static const int RPC_ERROR_SEND = -1;
+  static const int RPC_ERROR_TIMEOUT = -2;
+  static const int RPC_ERROR_DISCONNECTED = -3;
+
   void register_method_callback(std::string resp_method,
 				std::string handler_name,
 				std::function<void(json&)> cb);
+
+  // true while talking to moonraker over its unix socket
+  bool is_unix_socket() const;
   
  private:
-  std::map<uint32_t, std::function<void(json&)>> callbacks;
-  std::map<uint32_t, NotifyConsumer*> consumers;
+  struct RpcRequest {
+    std::function<void(json&)> cb;
+    std::function<void(json&)> on_error;
+    NotifyConsumer *consumer = NULL;
+    // wheel tick the request expires at, 0 for none
+    uint64_t expire_tick = 0;
+  };
+
+  int send_request(const std::string &method, const json *params, RpcRequest req, uint32_t timeout_ms);
+  static bool priority_connection_enabled();
+  void flush_batch();
+  void handle_reply(json &j);
+  void fail_request(uint64_t rid, int code, const std::string &message);
+  void fail_all(int code, const std::string &message);
+  void expire_requests();
+
+  // moonraker's unix socket speaks the same json-rpc as the websocket, with
+  // each message terminated by ETX (0x03) instead of websocket framing.
+  // picked over the websocket when moonraker runs on this machine.
+  static std::string unix_socket_path();
+  int connect_unix(const std::string &path);
+  void open_unix();
+  void close_unix();
+  static hio_t *open_unix_io(hloop_t *loop, const std::string &path);
+  static void on_unix_read(hio_t *io, void *buf, int len);
+  static void on_unix_close(hio_t *io);
+  static void on_unix_priority_close(hio_t *io);
+  // frames go out over whichever transport is connected. callers hold rpc_lock.
+  int transport_send(const std::string &frame);
+
+  void handle_status_update(const StatusUpdate &update);
+  void schedule_resubscribe();
+  void resubscribe();
+
+  // in-flight requests by id. deadlines are tracked on a timer wheel of
+  // WHEEL_SLOTS buckets, WHEEL_TICK_MS apart. requests that complete early
+  // leave a stale id in their bucket, dropped when the bucket comes around.
+  static const uint32_t WHEEL_TICK_MS = 250;
+  static const size_t WHEEL_SLOTS = 128;
+
+  std::mutex rpc_lock;
+  std::map<uint64_t, RpcRequest> inflight;
+  std::vector<std::vector<uint64_t>> wheel;
+  uint64_t wheel_tick;
+  hv::TimerID wheel_timer;
+
+  // frames are encoded and sent under rpc_lock
+  RpcEncoder encoder;
+
+  // requests issued within one loop iteration go out as one json-rpc batch.
+  // the buffers are swapped rather than reallocated between flushes.
+  std::string batch_buf;
+  size_t batch_count;
+  std::vector<uint64_t> batch_ids;
+  std::string flush_buf;
+  std::vector<uint64_t> flush_ids;
+
+  // libhv only runs the websocket's loop from open(). loop_thread runs it
+  // before that, for the unix socket transport and so open() itself can be
+  // called on the loop thread.
+  hv::EventLoopThread loop_thread;
+
+  // unix socket transport
+  std::atomic_bool use_unix;
+  std::string uds_path;
+  // set and cleared on the loop thread
+  std::atomic<hio_t *> uds_io;
+  std::atomic<hio_t *> uds_priority_io;
+  unpack_setting_t uds_unpack;
+  std::string uds_out;
+  std::string uds_msg;
+  uint32_t uds_retry_ms;
+
+  // priority lane, see send_priority. the optional second connection
+  // (moonraker_priority_connection) only ever carries priority requests.
+  std::mutex priority_lock;
+  RpcEncoder priority_encoder;
+  std::string priority_out;
+  PriorityLatency priority_latency;
+  hv::WebSocketClient priority_ws;
+
+#ifdef GUPPY_WS_DEFLATE
+  WsDeflate deflate;
+  std::string inflated;
+#endif
+
+  StatusUpdateParser status_parser;
+  StatusRegistry status_registry;
+  StatusUpdate subscribe_update;
+  // last "objects" sent with printer.objects.subscribe
+  json subscribed_objects;
+  std::atomic_bool status_subscribed;
+  std::atomic_bool resubscribe_pending;
+  std::function<void()> status_ready;
   std::vector<NotifyConsumer*> notify_consumers;
   // std::vector<std::function<void(json&)>> gcode_resp_cbs;
 
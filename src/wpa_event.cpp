@@ -1,6 +1,7 @@
 #include "wpa_event.h"
 #include "wpa_ctrl.h"
 #include "config.h"
+#include "ui_reactor.h"
 #include "spdlog/spdlog.h"
 
 #include <memory>
@@ -103,6 +104,9 @@ void WpaEvent::handle_wpa_events(void *data, int len) {
   for (const auto &entry : callbacks) {
     entry.second(event);
   }
+
+  // callbacks update the wifi panel, let the LVGL thread redraw
+  UiReactor::get_instance()->wakeup();
 }
 
 std::string WpaEvent::send_command(const std::string &cmd) {
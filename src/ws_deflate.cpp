@@ -0,0 +1,210 @@
+#ifdef GUPPY_WS_DEFLATE
+
+#include "ws_deflate.h"
+#include "spdlog/spdlog.h"
+
+#include <cstring>
+
+// appended to every message before inflating, see RFC 7692 7.2.2
+static const uint8_t DEFLATE_TAIL[4] = { 0x00, 0x00, 0xff, 0xff };
+
+WsDeflate::WsDeflate()
+  : offered(false)
+  , enabled(false)
+  , no_context_takeover(false)
+  , handshake_end(0)
+  , header_len(0)
+  , header_need(2)
+  , payload_left(0)
+{
+  std::memset(&zs, 0, sizeof(zs));
+  // raw deflate, the largest window covers any server_max_window_bits
+  inflateInit2(&zs, -MAX_WBITS);
+}
+
+WsDeflate::~WsDeflate() {
+  inflateEnd(&zs);
+}
+
+const char *WsDeflate::offer() {
+  return "permessage-deflate; client_max_window_bits";
+}
+
+void WsDeflate::start(bool o) {
+  reset();
+  offered = o;
+}
+
+bool WsDeflate::is_offered() const {
+  return offered;
+}
+
+// called from onopen, after libhv parsed the upgrade response but before it
+// parses the frames that came in the same read, which scan() already saw
+bool WsDeflate::accept(const std::string &extensions) {
+  enabled = false;
+  no_context_takeover = false;
+  inflateReset(&zs);
+  if (!offered || extensions.find("permessage-deflate") == std::string::npos) {
+    return false;
+  }
+
+  no_context_takeover = extensions.find("server_no_context_takeover") != std::string::npos;
+  enabled = true;
+  return true;
+}
+
+bool WsDeflate::is_enabled() const {
+  return enabled;
+}
+
+void WsDeflate::reset() {
+  enabled = false;
+  no_context_takeover = false;
+  handshake_end = 0;
+  header_len = 0;
+  header_need = 2;
+  payload_left = 0;
+  messages.clear();
+  inflateReset(&zs);
+}
+
+void WsDeflate::scan(const char *data, size_t len) {
+  if (!offered) {
+    return;
+  }
+
+  static const char CRLFCRLF[4] = { '\r', '\n', '\r', '\n' };
+  const uint8_t *p = reinterpret_cast<const uint8_t *>(data);
+  while (len > 0) {
+    if (handshake_end < sizeof(CRLFCRLF)) {
+      // a 101 response has no body, the frames start right after the headers
+      char c = *p++;
+      len--;
+      if (c == CRLFCRLF[handshake_end]) {
+	handshake_end++;
+      } else {
+	handshake_end = c == CRLFCRLF[0] ? 1 : 0;
+      }
+      continue;
+    }
+
+    if (payload_left > 0) {
+      size_t n = payload_left < len ? payload_left : len;
+      p += n;
+      len -= n;
+      payload_left -= n;
+      continue;
+    }
+
+    header[header_len++] = *p++;
+    len--;
+
+    if (header_len == 2) {
+      uint8_t l = header[1] & 0x7f;
+      header_need = 2 + (l == 126 ? 2 : l == 127 ? 8 : 0) + (header[1] & 0x80 ? 4 : 0);
+    }
+
+    if (header_len < header_need) {
+      continue;
+    }
+
+    uint64_t l = header[1] & 0x7f;
+    if (l == 126) {
+      l = (uint64_t)header[2] << 8 | header[3];
+    } else if (l == 127) {
+      l = 0;
+      for (int i = 2; i < 10; i++) {
+	l = l << 8 | header[i];
+      }
+    }
+
+    uint8_t opcode = header[0] & 0x0f;
+    if (opcode == 0x1 || opcode == 0x2) {
+      // RSV1 is only set on the first frame of a data message
+      messages.push_back({(header[0] & 0x40) != 0, l});
+    } else if (opcode == 0x0 && !messages.empty()) {
+      // continuation frames belong to the last message, which libhv can't
+      // have delivered before its final frame
+      messages.back().size += l;
+    }
+
+    payload_left = l;
+    header_len = 0;
+    header_need = 2;
+  }
+}
+
+bool WsDeflate::next_message(size_t size, bool &compressed) {
+  if (messages.empty()) {
+    return false;
+  }
+
+  Message m = messages.front();
+  messages.pop_front();
+  if (m.size != size) {
+    // out of step, whatever was scanned is suspect. records start over
+    // with the next read.
+    messages.clear();
+    return false;
+  }
+
+  compressed = m.compressed;
+  return true;
+}
+
+bool WsDeflate::inflate_message(const std::string &in, std::string &out) {
+  out.clear();
+  size_t used = 0;
+  bool end = false;
+  bool ok = run_inflate(reinterpret_cast<const uint8_t *>(in.data()), in.size(), out, used, end);
+  // a message may end the stream with a final block (RFC 7692 7.2.3.4),
+  // there is nothing to flush then and the next message starts a new one
+  if (ok && !end) {
+    ok = run_inflate(DEFLATE_TAIL, sizeof(DEFLATE_TAIL), out, used, end);
+  }
+  out.resize(used);
+
+  if (!ok || end || no_context_takeover) {
+    inflateReset(&zs);
+  }
+
+  return ok;
+}
+
+bool WsDeflate::run_inflate(const uint8_t *in, size_t len, std::string &out, size_t &used,
+			    bool &end) {
+  zs.next_in = const_cast<Bytef *>(in);
+  zs.avail_in = len;
+
+  do {
+    if (out.size() - used < 4096) {
+      out.resize(out.size() + (in == DEFLATE_TAIL ? 4096 : len * 4 + 4096));
+    }
+
+    zs.next_out = reinterpret_cast<Bytef *>(&out[used]);
+    zs.avail_out = out.size() - used;
+    int ret = inflate(&zs, Z_SYNC_FLUSH);
+    used = out.size() - zs.avail_out;
+
+    if (ret == Z_STREAM_END) {
+      end = true;
+      return true;
+    }
+
+    // room on both sides and still no progress, looping won't change that
+    if (ret == Z_BUF_ERROR && zs.avail_in > 0 && zs.avail_out > 0) {
+      spdlog::warn("permessage-deflate inflate stalled");
+      return false;
+    }
+
+    if (ret != Z_OK && ret != Z_BUF_ERROR) {
+      spdlog::warn("permessage-deflate inflate failed: {}", zs.msg ? zs.msg : "unknown");
+      return false;
+    }
+  } while (zs.avail_in > 0 || zs.avail_out == 0);
+
+  return true;
+}
+
+#endif // GUPPY_WS_DEFLATE
@@ -0,0 +1,82 @@
+#ifndef __WS_DEFLATE_H__
+#define __WS_DEFLATE_H__
+
+#ifdef GUPPY_WS_DEFLATE
+
+#include <zlib.h>
+
+#include <deque>
+#include <string>
+#include <cstdint>
+
+// Receive side of RFC 7692 permessage-deflate. We offer the extension in the
+// handshake and inflate what the server compresses; our own frames go out
+// uncompressed, which the extension allows.
+//
+// libhv hands us reassembled messages without the RSV1 bit that marks a
+// message as compressed, so scan() follows the raw stream from the first
+// byte of each connection: it skips the HTTP upgrade response, then follows
+// the frame headers and records RSV1 and the payload size of every data
+// message, in the order they are delivered. The size checks each delivered
+// message against its record, so a stream we lost track of never gets
+// inflated or parsed on a guess.
+class WsDeflate {
+ public:
+  WsDeflate();
+  ~WsDeflate();
+  WsDeflate(WsDeflate &o) = delete;
+  void operator=(const WsDeflate &) = delete;
+
+  // Sec-WebSocket-Extensions value for the handshake request
+  static const char *offer();
+
+  // on the loop thread before opening a connection, offered is whether the
+  // handshake asks for the extension. nothing is scanned when it doesn't.
+  void start(bool offered);
+  bool is_offered() const;
+
+  // checks the server's Sec-WebSocket-Extensions response, returns false
+  // (and stays disabled) if permessage-deflate wasn't accepted
+  bool accept(const std::string &extensions);
+  bool is_enabled() const;
+  // connection closed, the next one starts with a handshake again
+  void reset();
+
+  // raw bytes read from the socket, handshake response included
+  void scan(const char *data, size_t len);
+  // pops the record of the next delivered data message, false if it doesn't
+  // match a message of size bytes
+  bool next_message(size_t size, bool &compressed);
+
+  // inflates one message into out, reusing the stream and out's buffer
+  bool inflate_message(const std::string &in, std::string &out);
+
+ private:
+  // false on a corrupt stream. end is set once a block with BFINAL ended the
+  // deflate stream, zlib takes nothing more after it
+  bool run_inflate(const uint8_t *in, size_t len, std::string &out, size_t &used, bool &end);
+
+  struct Message {
+    bool compressed;
+    uint64_t size;
+  };
+
+  z_stream zs;
+  bool offered;
+  bool enabled;
+  bool no_context_takeover;
+
+  // bytes of the "\r\n\r\n" ending the upgrade response matched so far,
+  // 4 once the frames start
+  size_t handshake_end;
+  // frame header scanner
+  uint8_t header[14];
+  size_t header_len;
+  size_t header_need;
+  uint64_t payload_left;
+  std::deque<Message> messages;
+};
+
+#endif // GUPPY_WS_DEFLATE
+
+#endif // __WS_DEFLATE_H__
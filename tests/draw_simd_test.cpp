@@ -0,0 +1,257 @@
+// DrawSimd against LVGL's own software renderer. Both draw contexts get the
+// same background and the same draw calls: fills and maps, with and without
+// a mask, for every opa, and ARGB images with and without recolor. The mask
+// value and the image alpha run through 0..255 along each row, rows are wider
+// than 256 pixels with an odd tail so the vector loops and their leftovers
+// both get hit, and the clip area is inset so the strides matter.
+//
+// Only the color channels are compared, DrawSimd leaves the alpha byte at
+// 0xFF (see draw_simd.h).
+//
+// make test, prints the first mismatches and exits non zero on any.
+
+#include "lvgl/lvgl.h"
+#include "src/draw_simd.h"
+#ifdef GUPPY_PARALLEL_DRAW
+#include "src/draw_pool.h"
+#endif
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+// lv_conf.h's LV_TICK_CUSTOM_SYS_TIME_EXPR, guppyscreen.cpp isn't linked in
+uint32_t custom_tick_get(void) {
+  static auto start = std::chrono::steady_clock::now();
+  auto now = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count();
+}
+
+#if LV_COLOR_DEPTH == 32
+
+// 256 mask/alpha values plus an odd tail; enough pixels for DrawPool to split
+#define TEST_W (256 + 7)
+#define TEST_H 72
+
+// mismatches printed before giving up on the details
+#define TEST_MAX_REPORTS 10
+
+struct Target {
+  lv_draw_sw_ctx_t ctx;
+  std::vector<lv_color_t> buf;
+};
+
+static lv_area_t buf_area = {0, 0, TEST_W - 1, TEST_H - 1};
+static lv_area_t clip_area = {3, 1, TEST_W - 3, TEST_H - 2};
+
+static uint32_t failures = 0;
+
+static uint32_t rand_px(uint32_t &seed) {
+  // xorshift32, the same sequence on every run
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  return seed;
+}
+
+static void init_target(Target &t, lv_disp_drv_t *drv, bool simd) {
+  if (simd) {
+    DrawSimd::init_ctx(drv, (lv_draw_ctx_t *)&t.ctx);
+  } else {
+    lv_draw_sw_init_ctx(drv, (lv_draw_ctx_t *)&t.ctx);
+  }
+
+  t.buf.resize(TEST_W * TEST_H);
+  t.ctx.base_draw.buf = t.buf.data();
+  t.ctx.base_draw.buf_area = &buf_area;
+  t.ctx.base_draw.clip_area = &clip_area;
+}
+
+// the same random background in both, alpha included
+static void fill_bg(Target &lvgl, Target &simd, uint32_t seed) {
+  for (size_t i = 0; i < lvgl.buf.size(); i++) {
+    lvgl.buf[i].full = rand_px(seed);
+    simd.buf[i].full = lvgl.buf[i].full;
+  }
+}
+
+static void compare(const char *what, uint32_t opa, uint32_t extra,
+		    const Target &lvgl, const Target &simd) {
+  for (size_t i = 0; i < lvgl.buf.size(); i++) {
+    uint32_t want = lvgl.buf[i].full;
+    uint32_t got = simd.buf[i].full;
+    if (((want ^ got) & 0x00ffffff) == 0) {
+      continue;
+    }
+
+    if (failures < TEST_MAX_REPORTS) {
+      printf("%s opa %u (%u) at %u,%u: lvgl %06x, %s %06x\n",
+	     what, opa, extra, (uint32_t)(i % TEST_W), (uint32_t)(i / TEST_W),
+	     want & 0x00ffffff, DrawSimd::kernel_name(), got & 0x00ffffff);
+    }
+    failures++;
+    return;
+  }
+}
+
+static void blend_both(Target &lvgl, Target &simd, const lv_draw_sw_blend_dsc_t &dsc) {
+  lv_draw_sw_blend((lv_draw_ctx_t *)&lvgl.ctx, &dsc);
+  lv_draw_sw_blend((lv_draw_ctx_t *)&simd.ctx, &dsc);
+}
+
+static void test_blend(Target &lvgl, Target &simd) {
+  uint32_t seed = 0x2545f491;
+  std::vector<lv_color_t> src(TEST_W * TEST_H);
+  std::vector<lv_opa_t> mask(TEST_W * TEST_H);
+  for (int32_t y = 0; y < TEST_H; y++) {
+    for (int32_t x = 0; x < TEST_W; x++) {
+      src[y * TEST_W + x].full = rand_px(seed);
+      // every value in each row, shifted from row to row
+      mask[y * TEST_W + x] = (x + y * 37) & 0xff;
+    }
+  }
+
+  lv_draw_sw_blend_dsc_t dsc;
+  lv_memset_00(&dsc, sizeof(dsc));
+  dsc.blend_area = &buf_area;
+  dsc.mask_area = &buf_area;
+  dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+
+  for (uint32_t opa = 0; opa <= 255; opa++) {
+    dsc.opa = opa;
+    dsc.color.full = rand_px(seed);
+
+    // fill
+    dsc.src_buf = NULL;
+    dsc.mask_buf = NULL;
+    dsc.mask_res = LV_DRAW_MASK_RES_FULL_COVER;
+    fill_bg(lvgl, simd, opa);
+    blend_both(lvgl, simd, dsc);
+    compare("fill", opa, 0, lvgl, simd);
+
+    // masked fill (glyphs, rounded corners)
+    dsc.mask_buf = mask.data();
+    dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+    fill_bg(lvgl, simd, opa);
+    blend_both(lvgl, simd, dsc);
+    compare("masked fill", opa, 0, lvgl, simd);
+
+    // map
+    dsc.src_buf = src.data();
+    dsc.mask_buf = NULL;
+    dsc.mask_res = LV_DRAW_MASK_RES_FULL_COVER;
+    fill_bg(lvgl, simd, opa);
+    blend_both(lvgl, simd, dsc);
+    compare("map", opa, 0, lvgl, simd);
+
+    // masked map (images with their alpha split off)
+    dsc.mask_buf = mask.data();
+    dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+    fill_bg(lvgl, simd, opa);
+    blend_both(lvgl, simd, dsc);
+    compare("masked map", opa, 0, lvgl, simd);
+  }
+}
+
+static void img_both(Target &lvgl, Target &simd, const lv_draw_img_dsc_t &dsc,
+		     const std::vector<lv_color_t> &img) {
+  const uint8_t *src = (const uint8_t *)img.data();
+  lvgl.ctx.base_draw.draw_img_decoded((lv_draw_ctx_t *)&lvgl.ctx, &dsc, &buf_area,
+				      src, LV_IMG_CF_TRUE_COLOR_ALPHA);
+  simd.ctx.base_draw.draw_img_decoded((lv_draw_ctx_t *)&simd.ctx, &dsc, &buf_area,
+				      src, LV_IMG_CF_TRUE_COLOR_ALPHA);
+}
+
+static void test_img(Target &lvgl, Target &simd) {
+  uint32_t seed = 0x9e3779b9;
+  std::vector<lv_color_t> img(TEST_W * TEST_H);
+  for (int32_t y = 0; y < TEST_H; y++) {
+    for (int32_t x = 0; x < TEST_W; x++) {
+      // the image alpha runs through every value like the mask above
+      uint32_t a = (x + y * 37) & 0xff;
+      img[y * TEST_W + x].full = (rand_px(seed) & 0x00ffffff) | (a << 24);
+    }
+  }
+
+  // recolor off, at the LVGL thresholds, and a few in between
+  static const lv_opa_t recolors[] = {
+    LV_OPA_TRANSP, LV_OPA_MIN, LV_OPA_MIN + 1, LV_OPA_30, LV_OPA_50,
+    LV_OPA_80, LV_OPA_MAX - 1, LV_OPA_MAX, LV_OPA_COVER
+  };
+
+  lv_draw_img_dsc_t dsc;
+  lv_draw_img_dsc_init(&dsc);
+
+  for (uint32_t opa = 0; opa <= 255; opa++) {
+    dsc.opa = opa;
+    for (lv_opa_t recolor_opa : recolors) {
+      dsc.recolor.full = rand_px(seed);
+      dsc.recolor_opa = recolor_opa;
+      fill_bg(lvgl, simd, opa);
+      img_both(lvgl, simd, dsc, img);
+      compare("image", opa, recolor_opa, lvgl, simd);
+    }
+  }
+
+  // every recolor opa on an opaque draw
+  dsc.opa = LV_OPA_COVER;
+  for (uint32_t recolor_opa = 0; recolor_opa <= 255; recolor_opa++) {
+    dsc.recolor.full = rand_px(seed);
+    dsc.recolor_opa = recolor_opa;
+    fill_bg(lvgl, simd, recolor_opa);
+    img_both(lvgl, simd, dsc, img);
+    compare("recolored image", LV_OPA_COVER, recolor_opa, lvgl, simd);
+  }
+}
+
+static void flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p) {
+  lv_disp_flush_ready(drv);
+}
+
+int main(void) {
+  lv_init();
+
+  // blend_basic and the kernels look at the display being refreshed
+  static std::vector<lv_color_t> disp_buf(TEST_W * TEST_H);
+  static lv_disp_draw_buf_t draw_buf;
+  lv_disp_draw_buf_init(&draw_buf, disp_buf.data(), NULL, disp_buf.size());
+
+  static lv_disp_drv_t drv;
+  lv_disp_drv_init(&drv);
+  drv.hor_res = TEST_W;
+  drv.ver_res = TEST_H;
+  drv.draw_buf = &draw_buf;
+  drv.flush_cb = flush_cb;
+  lv_disp_t *disp = lv_disp_drv_register(&drv);
+  _lv_refr_set_disp_refreshing(disp);
+
+#ifdef GUPPY_PARALLEL_DRAW
+  DrawPool::get_instance()->start(0);
+#endif
+
+  static Target lvgl;
+  static Target simd;
+  init_target(lvgl, &drv, false);
+  init_target(simd, &drv, true);
+
+  test_blend(lvgl, simd);
+  test_img(lvgl, simd);
+
+  if (failures > 0) {
+    printf("draw_simd_test: %u mismatched draw calls (%s)\n", failures, DrawSimd::kernel_name());
+    return 1;
+  }
+
+  printf("draw_simd_test: %s kernels match lvgl\n", DrawSimd::kernel_name());
+  return 0;
+}
+
+#else
+
+int main(void) {
+  // 16 bpp builds draw with LVGL's own code, nothing to compare
+  printf("draw_simd_test: %s kernels, skipped\n", DrawSimd::kernel_name());
+  return 0;
+}
+
+#endif  // LV_COLOR_DEPTH == 32